@@ -1,111 +1,160 @@
-/*! \file
-    \brief A channel.
-
-    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
-*/
-
-#if !defined(TETENGO_JSON_CHANNEL_HPP)
-#define TETENGO_JSON_CHANNEL_HPP
-
-#include <cstddef>
-#include <exception>
-#include <memory>
-
-#include <boost/core/noncopyable.hpp>
-
-
-namespace tetengo::json
-{
-    class element;
-
-
-    /*!
-        \brief A channel.
-    */
-    class channel : private boost::noncopyable
-    {
-    public:
-        // constructors and destructor
-
-        /*!
-            \brief Creates a channel.
-
-            \param capacity A capacity. Must be greater than 0.
-
-            \throw std::invalid_argument When capacity is 0.
-        */
-        explicit channel(std::size_t capacity);
-
-        /*!
-            \brief Destroys the JSON parser.
-        */
-        ~channel();
-
-
-        // functions
-
-        /*!
-            \brief Inserts an element.
-
-            The element inserted after a close() call are just discarded.
-
-            \param element_ An element.
-        */
-        void insert(element element_);
-
-        /*!
-            \brief Inserts an exception.
-
-            The exception inserted after a close() call are just discarded.
-
-            \param p_exception An exception pointer.
-        */
-        void insert(std::exception_ptr&& p_exception);
-
-        /*!
-            \brief Returns the front element.
-
-            \return The front element.
-
-            \throw unspecified      An exception inserted with insert(std::exception_ptr&&).
-            \throw std::logic_error When the channel is already closed.
-        */
-        [[nodiscard]] const element& peek() const;
-
-        /*!
-            \brief Takes an element.
-
-            \throw std::logic_error When the channel is already closed.
-        */
-        void take();
-
-        /*!
-            \brief Returns true the channel is closed.
-
-            \retval true  When the channel is closed.
-            \retval false Otherwise.
-        */
-        [[nodiscard]] bool closed() const;
-
-        /*!
-            \brief Closes the channel.
-        */
-        void close();
-
-
-    private:
-        // types
-
-        class impl;
-
-
-        // variables
-
-        const std::unique_ptr<impl> m_p_impl;
-    };
-
-
-}
-
-
-#endif
+/*! \file
+    \brief A channel.
+
+    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
+*/
+
+#if !defined(TETENGO_JSON_CHANNEL_HPP)
+#define TETENGO_JSON_CHANNEL_HPP
+
+#include <cstddef>
+#include <exception>
+#include <memory>
+
+#include <boost/core/noncopyable.hpp>
+
+
+namespace tetengo::json
+{
+    class element;
+    class element_view;
+
+
+    /*!
+        \brief A channel.
+
+        A bounded single-producer single-consumer ring buffer.
+        insert(), flush() and close() must be called in one thread, and peek(), take() and closed() in one thread.
+        A thread blocks only when the channel is empty or full.
+
+        The inserted elements are handed off to the consumer in batches. The write position is advanced once for each
+        batch, and the consumer is notified only when it is waiting.
+
+        Each slot keeps the buffers for an element inserted as an element view, and reuses them for the next one. So
+        an element inserted as an element view is copied into the channel without an allocation once the buffers have
+        grown enough.
+    */
+    class channel : private boost::noncopyable
+    {
+    public:
+        // constructors and destructor
+
+        /*!
+            \brief Creates a channel.
+
+            A batch is handed off when batch_size elements are inserted into it, when the channel gets full, and when
+            flush() or close() is called. The elements of a batch which is not handed off yet cannot be peeked.
+
+            \param capacity   A capacity. Must be greater than 0.
+            \param batch_size A batch size. Must be greater than 0 and not greater than capacity.
+                              When it is 1, each element is handed off as soon as it is inserted.
+
+            \throw std::invalid_argument When capacity is 0.
+            \throw std::invalid_argument When batch_size is 0 or greater than capacity.
+        */
+        explicit channel(std::size_t capacity, std::size_t batch_size = 1);
+
+        /*!
+            \brief Destroys the JSON parser.
+        */
+        ~channel();
+
+
+        // functions
+
+        /*!
+            \brief Inserts an element.
+
+            The element inserted after a close() call are just discarded.
+
+            \param element_ An element.
+        */
+        void insert(element element_);
+
+        /*!
+            \brief Inserts an element view.
+
+            The value, the name and the file location are copied into the buffers of the slot.
+            The element view inserted after a close() call are just discarded.
+
+            \param element_view_ An element view.
+        */
+        void insert(const element_view& element_view_);
+
+        /*!
+            \brief Inserts an exception.
+
+            The exception inserted after a close() call are just discarded.
+
+            \param p_exception An exception pointer.
+        */
+        void insert(std::exception_ptr&& p_exception);
+
+        /*!
+            \brief Returns the front element.
+
+            \return The front element.
+
+            \throw unspecified      An exception inserted with insert(std::exception_ptr&&).
+            \throw std::logic_error When the channel is already closed.
+        */
+        [[nodiscard]] const element& peek() const;
+
+        /*!
+            \brief Returns a view of the front element.
+
+            Unlike peek(), it does not make an element from an element view inserted.
+
+            \return A view of the front element. It is valid until take() is called.
+
+            \throw unspecified      An exception inserted with insert(std::exception_ptr&&).
+            \throw std::logic_error When the channel is already closed.
+        */
+        [[nodiscard]] element_view peek_view() const;
+
+        /*!
+            \brief Takes an element.
+
+            \throw std::logic_error When the channel is already closed.
+        */
+        void take();
+
+        /*!
+            \brief Returns true the channel is closed.
+
+            \retval true  When the channel is closed.
+            \retval false Otherwise.
+        */
+        [[nodiscard]] bool closed() const;
+
+        /*!
+            \brief Hands off the inserted elements.
+
+            Hands off the batch even when it has fewer than the batch size elements.
+        */
+        void flush();
+
+        /*!
+            \brief Closes the channel.
+
+            The inserted elements are handed off with the closing.
+        */
+        void close();
+
+
+    private:
+        // types
+
+        class impl;
+
+
+        // variables
+
+        const std::unique_ptr<impl> m_p_impl;
+    };
+
+
+}
+
+
+#endif
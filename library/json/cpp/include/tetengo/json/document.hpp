@@ -0,0 +1,256 @@
+/*! \file
+    \brief A document.
+
+    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
+*/
+
+#if !defined(TETENGO_JSON_DOCUMENT_HPP)
+#define TETENGO_JSON_DOCUMENT_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <string_view>
+
+#include <boost/core/noncopyable.hpp>
+#include <boost/stl_interfaces/iterator_interface.hpp>
+
+#include <tetengo/json/element.hpp>
+
+
+namespace tetengo::json
+{
+    class json_parser;
+
+
+    /*!
+        \brief A document.
+
+        Builds a tree from the elements of a JSON parser.
+        The nodes, the child index tables and the strings are stored in three flat buffers owned by the document, and
+        a node is just an index into them.
+    */
+    class document : private boost::noncopyable
+    {
+    public:
+        // types
+
+        class node_iterator;
+
+        /*!
+            \brief A node.
+
+            Valid while the document exists.
+        */
+        class node
+        {
+        public:
+            // constructors and destructor
+
+            /*!
+                \brief Creates an empty node.
+
+                It refers to no document.
+            */
+            node();
+
+
+            // functions
+
+            /*!
+                \brief Returns the type name.
+
+                \return The type name. One of string, number, boolean, null, object and array.
+            */
+            [[nodiscard]] element::type_name_type type() const;
+
+            /*!
+                \brief Returns the value.
+
+                The escape sequences in a string are decoded into UTF-8.
+
+                \return The value. Or an empty string when the node is an object or an array.
+            */
+            [[nodiscard]] std::string_view value() const;
+
+            /*!
+                \brief Returns the name.
+
+                \return The decoded member name when the node is a member value of an object. Or an empty string
+                        otherwise.
+            */
+            [[nodiscard]] std::string_view name() const;
+
+            /*!
+                \brief Returns the child count.
+
+                \return The child count. Or 0 when the node is neither an object nor an array.
+            */
+            [[nodiscard]] std::size_t size() const;
+
+            /*!
+                \brief Returns a child.
+
+                The children of an object are its member values in the document order.
+
+                \param index An index.
+
+                \return The child.
+
+                \throw std::out_of_range When index is not less than the child count.
+            */
+            [[nodiscard]] node operator[](std::size_t index) const;
+
+            /*!
+                \brief Finds a member value.
+
+                When the object has members with the same name, the first one in the document order is found.
+
+                \param name A decoded member name.
+
+                \return The member value. Or std::nullopt when the node is not an object or no such member exists.
+            */
+            [[nodiscard]] std::optional<node> find(std::string_view name) const;
+
+            /*!
+                \brief Returns the first iterator of the children.
+
+                \return The first iterator.
+            */
+            [[nodiscard]] node_iterator begin() const;
+
+            /*!
+                \brief Returns the last iterator of the children.
+
+                \return The last iterator.
+            */
+            [[nodiscard]] node_iterator end() const;
+
+
+        private:
+            // friends
+
+            friend class document;
+
+
+            // constructors
+
+            node(const document& document_, std::size_t index);
+
+
+            // variables
+
+            const document* m_p_document;
+
+            std::size_t m_index;
+        };
+
+        //! A node iterator.
+        class node_iterator :
+        public boost::stl_interfaces::proxy_iterator_interface<node_iterator, std::random_access_iterator_tag, node>
+        {
+        public:
+            // constructors and destructor
+
+            /*!
+                \brief Creates an iterator.
+
+                It refers to no document.
+            */
+            node_iterator();
+
+
+            // functions
+
+            /*!
+                \brief Dereferences the iterator.
+
+                \return The dereferenced value.
+            */
+            [[nodiscard]] node operator*() const;
+
+            /*!
+                \brief Advances the iterator.
+
+                \param n A distance.
+
+                \return This iterator.
+            */
+            node_iterator& operator+=(std::ptrdiff_t n);
+
+            /*!
+                \brief Returns the distance between two iterators.
+
+                \param one     One iterator.
+                \param another Another iterator.
+
+                \return The distance.
+            */
+            friend std::ptrdiff_t operator-(const node_iterator& one, const node_iterator& another);
+
+
+        private:
+            // friends
+
+            friend class node;
+
+
+            // constructors
+
+            node_iterator(const document& document_, const std::size_t* p_child_index);
+
+
+            // variables
+
+            const document* m_p_document;
+
+            const std::size_t* m_p_child_index;
+        };
+
+
+        // constructors and destructor
+
+        /*!
+            \brief Creates a document.
+
+            Reads all the elements of the parser.
+
+            \param parser A JSON parser.
+
+            \throw std::runtime_error When the JSON text is invalid or empty.
+        */
+        explicit document(json_parser& parser);
+
+        /*!
+            \brief Destroys the document.
+        */
+        ~document();
+
+
+        // functions
+
+        /*!
+            \brief Returns the root node.
+
+            \return The root node.
+        */
+        [[nodiscard]] node root() const;
+
+
+    private:
+        // types
+
+        class impl;
+
+
+        // variables
+
+        const std::unique_ptr<impl> m_p_impl;
+    };
+
+
+}
+
+
+#endif
@@ -0,0 +1,149 @@
+/*! \file
+    \brief An element view.
+
+    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
+*/
+
+#if !defined(TETENGO_JSON_ELEMENTVIEW_HPP)
+#define TETENGO_JSON_ELEMENTVIEW_HPP
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include <tetengo/json/element.hpp>
+
+
+namespace tetengo::json
+{
+    class file_location;
+
+
+    /*!
+        \brief An element view.
+
+        Refers to a value, a name and a file location owned by someone else, typically a JSON parser.
+        Only a member has a name. It is the member name for the member opening and empty otherwise.
+    */
+    class element_view
+    {
+    public:
+        // constructors and destructor
+
+        /*!
+            \brief Creates an element view.
+
+            \param type           A type.
+            \param value          A value.
+            \param name           A name.
+            \param file_location_ A file location.
+
+            \throw std::invalid_argument When the arguments are mismatched.
+        */
+        element_view(
+            element::type_type   type,
+            std::string_view     value,
+            std::string_view     name,
+            const file_location& file_location_);
+
+        /*!
+            \brief Creates an element view of an element.
+
+            \param element_ An element. It must outlive the element view.
+        */
+        explicit element_view(const element& element_);
+
+
+        // functions
+
+        /*!
+            \brief Returns the type.
+
+            \return The type.
+        */
+        [[nodiscard]] const element::type_type& type() const;
+
+        /*!
+            \brief Returns the value.
+
+            \return The value.
+        */
+        [[nodiscard]] std::string_view value() const;
+
+        /*!
+            \brief Returns the name.
+
+            \return The name.
+        */
+        [[nodiscard]] std::string_view name() const;
+
+        /*!
+            \brief Returns the decoded value.
+
+            Decodes the escape sequences in a string into UTF-8.
+            When the value has no backslash, the value itself is returned and buffer is not touched.
+
+            \param buffer A buffer for the decoded value.
+
+            \return The decoded value. It refers to either the value or buffer.
+        */
+        [[nodiscard]] std::string_view decoded_value(std::string& buffer) const;
+
+        /*!
+            \brief Returns the decoded name.
+
+            \param buffer A buffer for the decoded name.
+
+            \return The decoded name. It refers to either the name or buffer.
+        */
+        [[nodiscard]] std::string_view decoded_name(std::string& buffer) const;
+
+        /*!
+            \brief Returns the value as an integer.
+
+            \return The integer value. Or std::nullopt when the element is not a number, or the number has a fraction
+                    or an exponent, or the number is out of the range.
+        */
+        [[nodiscard]] std::optional<std::int64_t> integer_value() const;
+
+        /*!
+            \brief Returns the value as a floating point number.
+
+            \return The floating point value. Or std::nullopt when the element is not a number or the number is out of
+                    the range.
+        */
+        [[nodiscard]] std::optional<double> double_value() const;
+
+        /*!
+            \brief Returns the file location.
+
+            \return The file location.
+        */
+        [[nodiscard]] const file_location& get_file_location() const;
+
+        /*!
+            \brief Makes an owning copy.
+
+            \return An element.
+        */
+        [[nodiscard]] element to_element() const;
+
+
+    private:
+        // variables
+
+        element::type_type m_type;
+
+        std::string_view m_value;
+
+        std::string_view m_name;
+
+        const file_location* m_p_file_location;
+    };
+
+
+}
+
+
+#endif
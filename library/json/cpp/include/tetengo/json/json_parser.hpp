@@ -1,102 +1,156 @@
-/*! \file
-    \brief A JSON parser.
-
-    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
-*/
-
-#if !defined(TETENGO_JSON_JSONPARSER_HPP)
-#define TETENGO_JSON_JSONPARSER_HPP
-
-#include <cstddef>
-#include <memory>
-
-#include <boost/core/noncopyable.hpp>
-
-
-namespace tetengo::json
-{
-    class element;
-    class reader;
-
-
-    /*!
-        \brief A JSON parser.
-
-        Based on <a href="https://tools.ietf.org/html/rfc8259">RFC 8259</a>.
-    */
-    class json_parser : private boost::noncopyable
-    {
-    public:
-        // static functions
-
-        /*!
-            \brief Returns the default buffer capacity.
-
-            \return The default buffer capacity.
-        */
-        [[nodiscard]] static std::size_t default_buffer_capacity();
-
-
-        // constructors and destructor
-
-        /*!
-            \brief Creates a JSON parser.
-
-            \param p_reader        A unique pointer to a reader.
-            \param buffer_capacity A buffer capacity.
-
-            \throw std::invalid_argument When p_reader is nullptr.
-        */
-        explicit json_parser(
-            std::unique_ptr<reader>&& p_reader,
-            std::size_t               buffer_capacity = default_buffer_capacity());
-
-        /*!
-            \brief Destroys the JSON parser.
-        */
-        ~json_parser();
-
-
-        // functions
-
-        /*!
-            \brief Returns true when the next element exists.
-
-            \retval true  When the next element exists.
-            \retval false Otherwise.
-        */
-        [[nodiscard]] bool has_next() const;
-
-        /*!
-            \brief Returns the current element.
-
-            \return The current element.
-
-            \throw std::logic_error When the current position is beyond the termination point.
-        */
-        [[nodiscard]] const element& peek() const;
-
-        /*!
-            \brief Moves to the next element.
-
-            \throw std::logic_error When the current position is beyond the termination point.
-        */
-        void next();
-
-
-    private:
-        // types
-
-        class impl;
-
-
-        // variables
-
-        const std::unique_ptr<impl> m_p_impl;
-    };
-
-
-}
-
-
-#endif
+/*! \file
+    \brief A JSON parser.
+
+    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
+*/
+
+#if !defined(TETENGO_JSON_JSONPARSER_HPP)
+#define TETENGO_JSON_JSONPARSER_HPP
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include <boost/core/noncopyable.hpp>
+
+#include <tetengo/json/json_grammar.hpp>
+#include <tetengo/json/json_pointer.hpp>
+
+
+namespace tetengo::json
+{
+    class element;
+    class element_view;
+    class reader;
+
+
+    /*!
+        \brief A JSON parser.
+
+        Based on <a href="https://tools.ietf.org/html/rfc8259">RFC 8259</a>.
+    */
+    class json_parser : private boost::noncopyable
+    {
+    public:
+        // types
+
+        //! The parsing mode type.
+        enum class parsing_mode_type
+        {
+            worker_thread, //!< Parses in a worker thread and passes the elements through a channel.
+            synchronous, //!< Parses in the caller's thread on demand.
+        };
+
+
+        // static functions
+
+        /*!
+            \brief Returns the default buffer capacity.
+
+            \return The default buffer capacity.
+        */
+        [[nodiscard]] static std::size_t default_buffer_capacity();
+
+
+        // constructors and destructor
+
+        /*!
+            \brief Creates a JSON parser.
+
+            In the worker thread mode, the elements are handed off to the caller's thread through a channel of
+            buffer_capacity elements, in batches of a quarter of it.
+
+            In the synchronous mode, no thread is created. Each has_next() call parses just enough of the text to find
+            the next element, and buffer_capacity is not used.
+
+            When filters are given, only the elements of the values the filters refer to are produced, and the other
+            subtrees are skipped without building elements. Skipped values are not fully validated.
+
+            The reader is wrapped in a line_counting_reader and a comment_removing_reader. When the chunks of the
+            reader are persistent, as those of an mmap_reader are, they pass the lines without comments through
+            without copying them. The element values are still copied into the elements.
+
+            \param p_reader        A unique pointer to a reader.
+            \param buffer_capacity A buffer capacity.
+            \param grammar_backend A grammar backend.
+            \param parsing_mode    A parsing mode.
+            \param filters         Filters. When empty, all the elements are produced.
+
+            \throw std::invalid_argument When p_reader is nullptr.
+            \throw std::invalid_argument When parsing_mode is synchronous and grammar_backend is not hand_written.
+            \throw std::invalid_argument When filters are not empty and grammar_backend is not hand_written.
+        */
+        explicit json_parser(
+            std::unique_ptr<reader>&&  p_reader,
+            std::size_t                buffer_capacity = default_buffer_capacity(),
+            json_grammar::backend_type grammar_backend = json_grammar::backend_type::spirit,
+            parsing_mode_type          parsing_mode = parsing_mode_type::worker_thread,
+            std::vector<json_pointer>  filters = std::vector<json_pointer>{});
+
+        /*!
+            \brief Destroys the JSON parser.
+        */
+        ~json_parser();
+
+
+        // functions
+
+        /*!
+            \brief Returns true when the next element exists.
+
+            \retval true  When the next element exists.
+            \retval false Otherwise.
+        */
+        [[nodiscard]] bool has_next() const;
+
+        /*!
+            \brief Returns the current element.
+
+            \return The current element.
+
+            \throw unspecified      An exception thrown while parsing, such as std::runtime_error for a syntax error.
+            \throw std::logic_error When the current position is beyond the termination point.
+        */
+        [[nodiscard]] const element& peek() const;
+
+        /*!
+            \brief Returns a view of the current element.
+
+            The value and the name refer to the buffers owned by the parser, and no element is allocated for each
+            token. In the worker thread mode, the buffers are the slots of the channel, which are reused for the
+            following tokens. Call element_view::to_element() to keep the element.
+
+            \return A view of the current element. It is valid until next() is called.
+
+            \throw unspecified      An exception thrown while parsing, such as std::runtime_error for a syntax error.
+            \throw std::logic_error When the current position is beyond the termination point.
+        */
+        [[nodiscard]] element_view peek_view() const;
+
+        /*!
+            \brief Moves to the next element.
+
+            An exception thrown while parsing takes the position of an element. peek() and peek_view() throw it, and
+            this function moves beyond it without throwing it, in both the parsing modes. No element follows it.
+
+            \throw std::logic_error When the current position is beyond the termination point.
+        */
+        void next();
+
+
+    private:
+        // types
+
+        class impl;
+
+
+        // variables
+
+        const std::unique_ptr<impl> m_p_impl;
+    };
+
+
+}
+
+
+#endif
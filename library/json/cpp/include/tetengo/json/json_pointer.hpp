@@ -0,0 +1,71 @@
+/*! \file
+    \brief A JSON pointer.
+
+    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
+*/
+
+#if !defined(TETENGO_JSON_JSONPOINTER_HPP)
+#define TETENGO_JSON_JSONPOINTER_HPP
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+namespace tetengo::json
+{
+    /*!
+        \brief A JSON pointer.
+
+        Based on <a href="https://tools.ietf.org/html/rfc6901">RFC 6901</a>.
+        As an extension, the reference token "*" matches any member name and any array index.
+    */
+    class json_pointer
+    {
+    public:
+        // static functions
+
+        /*!
+            \brief Returns the wildcard reference token.
+
+            \return The wildcard reference token.
+        */
+        [[nodiscard]] static const std::string& wildcard();
+
+
+        // constructors and destructor
+
+        /*!
+            \brief Creates a JSON pointer.
+
+            \param pointer A JSON pointer string. An empty string refers to the whole document. Otherwise it must start
+                           with '/'.
+
+            \throw std::invalid_argument When pointer is not a valid JSON pointer.
+        */
+        explicit json_pointer(std::string_view pointer);
+
+
+        // functions
+
+        /*!
+            \brief Returns the reference tokens.
+
+            The escape sequences "~0" and "~1" are decoded.
+
+            \return The reference tokens.
+        */
+        [[nodiscard]] const std::vector<std::string>& reference_tokens() const;
+
+
+    private:
+        // variables
+
+        std::vector<std::string> m_reference_tokens;
+    };
+
+
+}
+
+
+#endif
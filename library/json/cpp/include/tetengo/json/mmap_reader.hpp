@@ -0,0 +1,90 @@
+/*! \file
+    \brief A memory-mapped file reader.
+
+    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
+*/
+
+#if !defined(TETENGO_JSON_MMAPREADER_HPP)
+#define TETENGO_JSON_MMAPREADER_HPP
+
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+#include <string_view>
+
+#include <tetengo/json/reader.hpp>
+
+
+namespace tetengo::json
+{
+    /*!
+        \brief A memory-mapped file reader.
+
+        Maps a whole file into the memory and reads it as one contiguous chunk.
+
+        The chunks are persistent. So line_counting_reader and comment_removing_reader wrapping this reader pass the
+        lines through without copying them, except for the lines with comments.
+    */
+    class mmap_reader : public reader
+    {
+    public:
+        // constructors and destructor
+
+        /*!
+            \brief Creates a memory-mapped file reader.
+
+            \param path A file path.
+
+            \throw std::ios_base::failure When the file cannot be mapped.
+        */
+        explicit mmap_reader(const std::filesystem::path& path);
+
+        /*!
+            \brief Destroys the memory-mapped file reader.
+        */
+        virtual ~mmap_reader();
+
+
+        // functions
+
+        /*!
+            \brief Returns the whole content of the file.
+
+            \return The content. It is valid while the reader exists.
+        */
+        [[nodiscard]] std::string_view content() const;
+
+
+    private:
+        // types
+
+        class impl;
+
+
+        // variables
+
+        const std::unique_ptr<impl> m_p_impl;
+
+
+        // virtual functions
+
+        virtual bool has_next_impl() const override;
+
+        virtual char peek_impl() const override;
+
+        virtual void next_impl() override;
+
+        virtual std::string_view peek_chunk_impl() const override;
+
+        virtual void consume_impl(std::size_t length) override;
+
+        virtual bool chunks_persistent_impl() const override;
+
+        virtual const reader& base_reader_impl() const override;
+    };
+
+
+}
+
+
+#endif
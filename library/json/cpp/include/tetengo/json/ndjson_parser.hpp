@@ -0,0 +1,119 @@
+/*! \file
+    \brief An NDJSON parser.
+
+    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
+*/
+
+#if !defined(TETENGO_JSON_NDJSONPARSER_HPP)
+#define TETENGO_JSON_NDJSONPARSER_HPP
+
+#include <cstddef>
+#include <memory>
+
+#include <boost/core/noncopyable.hpp>
+
+#include <tetengo/json/json_parser.hpp>
+
+
+namespace tetengo::json
+{
+    class element;
+    class reader;
+
+
+    /*!
+        \brief An NDJSON parser.
+
+        Parses a text whose lines are JSON texts, such as <a href="https://github.com/ndjson/ndjson-spec">NDJSON</a>
+        and JSON Lines. Blank lines are ignored.
+
+        A reader thread splits the text into batches of whole lines, worker threads parse the batches, and an
+        emitter thread passes the elements to a channel in the original order. Each worker thread keeps one grammar
+        and parses the lines in place in the batch text. The line indices of the file locations are counted from the
+        beginning of the whole text.
+
+        Unlike json_parser, comments are not removed.
+
+        The batches in flight are limited to twice the thread count, and the channel blocks the emitter thread when
+        buffer_capacity elements are waiting. So the memory usage does not depend on the text size.
+    */
+    class ndjson_parser : private boost::noncopyable
+    {
+    public:
+        // static functions
+
+        /*!
+            \brief Returns the default thread count.
+
+            \return The default thread count.
+        */
+        [[nodiscard]] static std::size_t default_thread_count();
+
+
+        // constructors and destructor
+
+        /*!
+            \brief Creates an NDJSON parser.
+
+            \param p_reader        A unique pointer to a reader.
+            \param thread_count    A worker thread count.
+            \param buffer_capacity A buffer capacity.
+
+            \throw std::invalid_argument When p_reader is nullptr.
+            \throw std::invalid_argument When thread_count or buffer_capacity is 0.
+        */
+        explicit ndjson_parser(
+            std::unique_ptr<reader>&& p_reader,
+            std::size_t               thread_count = default_thread_count(),
+            std::size_t               buffer_capacity = json_parser::default_buffer_capacity());
+
+        /*!
+            \brief Destroys the NDJSON parser.
+        */
+        ~ndjson_parser();
+
+
+        // functions
+
+        /*!
+            \brief Returns true when the next element exists.
+
+            \retval true  When the next element exists.
+            \retval false Otherwise.
+        */
+        [[nodiscard]] bool has_next() const;
+
+        /*!
+            \brief Returns the current element.
+
+            \return The current element.
+
+            \throw std::logic_error When the current position is beyond the termination point.
+            \throw std::runtime_error When a line is not a valid JSON text.
+        */
+        [[nodiscard]] const element& peek() const;
+
+        /*!
+            \brief Moves to the next element.
+
+            \throw std::logic_error When the current position is beyond the termination point.
+        */
+        void next();
+
+
+    private:
+        // types
+
+        class impl;
+
+
+        // variables
+
+        const std::unique_ptr<impl> m_p_impl;
+    };
+
+
+}
+
+
+#endif
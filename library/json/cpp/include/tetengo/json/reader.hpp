@@ -1,81 +1,134 @@
-/*! \file
-    \brief A reader.
-
-    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
-*/
-
-#if !defined(TETENGO_JSON_READER_HPP)
-#define TETENGO_JSON_READER_HPP
-
-#include <boost/core/noncopyable.hpp>
-
-
-namespace tetengo::json
-{
-    /*!
-        \brief A reader.
-    */
-    class reader : private boost::noncopyable
-    {
-    public:
-        // constructors and destructor
-
-        /*!
-            \brief Destroys the reader.
-        */
-        virtual ~reader();
-
-
-        // functions
-
-        /*!
-            \brief Returns true when the next character exists.
-
-            \retval true  When the next character exists.
-            \retval false Otherwise.
-        */
-        [[nodiscard]] bool has_next() const;
-
-        /*!
-            \brief Returns the current character.
-
-            \return The current character.
-
-            \throw std::logic_error When current position is beyond the termination point.
-        */
-        [[nodiscard]] char peek() const;
-
-        /*!
-            \brief Moves to the next character.
-
-            \throw std::logic_error When current position is beyond the termination point.
-        */
-        void next();
-
-        /*!
-            \brief Returns the base reader.
-
-            \return The base reader.
-
-            \throw std::logic_error When this reader does not have a base reader.
-        */
-        const reader& base_reader() const;
-
-
-    private:
-        // virtual functions
-
-        virtual bool has_next_impl() const = 0;
-
-        virtual char peek_impl() const = 0;
-
-        virtual void next_impl() = 0;
-
-        virtual const reader& base_reader_impl() const = 0;
-    };
-
-
-}
-
-
-#endif
+/*! \file
+    \brief A reader.
+
+    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
+*/
+
+#if !defined(TETENGO_JSON_READER_HPP)
+#define TETENGO_JSON_READER_HPP
+
+#include <cstddef>
+#include <string_view>
+
+#include <boost/core/noncopyable.hpp>
+
+
+namespace tetengo::json
+{
+    /*!
+        \brief A reader.
+
+        The characters can be read one by one with has_next(), peek() and next(), or chunk by chunk with peek_chunk()
+        and consume().
+        A derived class which overrides only the per-character functions gets a chunk of one character.
+    */
+    class reader : private boost::noncopyable
+    {
+    public:
+        // constructors and destructor
+
+        /*!
+            \brief Creates a reader.
+        */
+        reader();
+
+        /*!
+            \brief Destroys the reader.
+        */
+        virtual ~reader();
+
+
+        // functions
+
+        /*!
+            \brief Returns true when the next character exists.
+
+            \retval true  When the next character exists.
+            \retval false Otherwise.
+        */
+        [[nodiscard]] bool has_next() const;
+
+        /*!
+            \brief Returns the current character.
+
+            \return The current character.
+
+            \throw std::logic_error When current position is beyond the termination point.
+        */
+        [[nodiscard]] char peek() const;
+
+        /*!
+            \brief Moves to the next character.
+
+            \throw std::logic_error When current position is beyond the termination point.
+        */
+        void next();
+
+        /*!
+            \brief Returns the current chunk.
+
+            The chunk is the characters from the current position which the reader can provide at once.
+            It is valid until the next call to a non-const function.
+
+            \return The current chunk. Or an empty one when the current position is at the termination point.
+        */
+        [[nodiscard]] std::string_view peek_chunk() const;
+
+        /*!
+            \brief Consumes characters.
+
+            \param length A length. Must be less than or equal to the length of the current chunk.
+
+            \throw std::logic_error When length is greater than the length of the current chunk.
+        */
+        void consume(std::size_t length);
+
+        /*!
+            \brief Returns true when the chunks are persistent.
+
+            The chunks of a persistent reader stay valid until the reader is destroyed, even after they are consumed.
+            So a decorating reader can refer to them instead of copying them.
+
+            \retval true  When the chunks are persistent.
+            \retval false Otherwise.
+        */
+        [[nodiscard]] bool chunks_persistent() const;
+
+        /*!
+            \brief Returns the base reader.
+
+            \return The base reader.
+
+            \throw std::logic_error When this reader does not have a base reader.
+        */
+        const reader& base_reader() const;
+
+
+    private:
+        // variables
+
+        mutable char m_single_character_chunk;
+
+
+        // virtual functions
+
+        virtual bool has_next_impl() const = 0;
+
+        virtual char peek_impl() const = 0;
+
+        virtual void next_impl() = 0;
+
+        virtual std::string_view peek_chunk_impl() const;
+
+        virtual void consume_impl(std::size_t length);
+
+        virtual bool chunks_persistent_impl() const;
+
+        virtual const reader& base_reader_impl() const = 0;
+    };
+
+
+}
+
+
+#endif
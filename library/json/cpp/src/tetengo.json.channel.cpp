@@ -1,197 +1,389 @@
-/*! \file
-    \brief A channel.
-
-    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
-*/
-
-#include <cassert>
-#include <condition_variable>
-#include <cstddef>
-#include <exception>
-#include <iterator>
-#include <memory>
-#include <mutex>
-#include <optional>
-#include <queue>
-#include <stdexcept>
-#include <utility>
-#include <variant>
-#include <vector>
-
-#include <boost/core/noncopyable.hpp>
-
-#include <tetengo/json/channel.hpp>
-#include <tetengo/json/element.hpp>
-
-
-namespace tetengo::json
-{
-    class channel::impl : private boost::noncopyable
-    {
-    public:
-        // constructors and destructor
-
-        explicit impl(const std::size_t capacity) : m_capacity{ capacity }, m_queue{}, m_mutex{}, m_condition_variable{}
-        {
-            if (m_capacity == 0)
-            {
-                throw std::invalid_argument{ "capacity is 0." };
-            }
-        }
-
-
-        // functions
-
-        void insert(element element_)
-        {
-            std::unique_lock lock{ m_mutex };
-            m_condition_variable.wait(lock, [this]() { return can_insert(); });
-
-            if (can_take() && !m_queue.back())
-            {
-                m_condition_variable.notify_all();
-                return;
-            }
-
-            m_queue.emplace(std::move(element_));
-
-            m_condition_variable.notify_all();
-        }
-
-        void insert(std::exception_ptr&& p_exception)
-        {
-            std::unique_lock<std::mutex> lock{ m_mutex };
-            m_condition_variable.wait(lock, [this]() { return can_insert(); });
-
-            if (can_take() && !m_queue.back())
-            {
-                m_condition_variable.notify_all();
-                return;
-            }
-
-            m_queue.emplace(std::move(p_exception));
-
-            m_condition_variable.notify_all();
-        }
-
-        const element& peek() const
-        {
-            std::unique_lock<std::mutex> lock{ m_mutex };
-            m_condition_variable.wait(lock, [this]() { return can_take(); });
-            if (closed_impl())
-            {
-                throw std::logic_error{ "The channel is already closed." };
-            }
-
-            if (std::holds_alternative<element>(*m_queue.front()))
-            {
-                return std::get<element>(*m_queue.front());
-            }
-            else
-            {
-                assert(std::holds_alternative<std::exception_ptr>(*m_queue.front()));
-                std::rethrow_exception(std::get<std::exception_ptr>(*m_queue.front()));
-            }
-        }
-
-        void take()
-        {
-            std::unique_lock<std::mutex> lock{ m_mutex };
-            m_condition_variable.wait(lock, [this]() { return can_take(); });
-            if (closed_impl())
-            {
-                throw std::logic_error{ "The channel is already closed." };
-            }
-
-            m_queue.pop();
-
-            m_condition_variable.notify_all();
-        }
-
-        bool closed() const
-        {
-            std::unique_lock<std::mutex> lock{ m_mutex };
-            m_condition_variable.wait(lock, [this]() { return can_take(); });
-            return closed_impl();
-        }
-
-        void close()
-        {
-            std::unique_lock<std::mutex> lock{ m_mutex };
-            m_condition_variable.wait(lock, [this]() { return can_insert(); });
-            if (!can_take() || m_queue.back())
-            {
-                decltype(m_queue)::value_type nullopt_{};
-                m_queue.push(nullopt_);
-            }
-            m_condition_variable.notify_all();
-        }
-
-
-    private:
-        // variables
-
-        const std::size_t m_capacity;
-
-        std::queue<std::optional<std::variant<element, std::exception_ptr>>> m_queue;
-
-        mutable std::mutex m_mutex;
-
-        mutable std::condition_variable m_condition_variable;
-
-
-        // functions
-
-        bool can_insert() const
-        {
-            return std::size(m_queue) < m_capacity;
-        }
-
-        bool can_take() const
-        {
-            return !std::empty(m_queue);
-        }
-
-        bool closed_impl() const
-        {
-            return !std::empty(m_queue) && !m_queue.front();
-        }
-    };
-
-
-    channel::channel(const std::size_t capacity) : m_p_impl{ std::make_unique<impl>(capacity) } {}
-
-    channel::~channel() = default;
-
-    void channel::insert(element element_)
-    {
-        m_p_impl->insert(element_);
-    }
-
-    void channel::insert(std::exception_ptr&& p_exception)
-    {
-        m_p_impl->insert(std::move(p_exception));
-    }
-
-    const element& channel::peek() const
-    {
-        return m_p_impl->peek();
-    }
-
-    void channel::take()
-    {
-        m_p_impl->take();
-    }
-
-    bool channel::closed() const
-    {
-        return m_p_impl->closed();
-    }
-
-    void channel::close()
-    {
-        m_p_impl->close();
-    }
-
-
-}
+/*! \file
+    \brief A channel.
+
+    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
+*/
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/core/noncopyable.hpp>
+
+#include <tetengo/json/channel.hpp>
+#include <tetengo/json/element.hpp>
+#include <tetengo/json/element_view.hpp>
+#include <tetengo/json/file_location.hpp>
+
+
+namespace tetengo::json
+{
+    namespace
+    {
+        constexpr std::size_t cache_line_size()
+        {
+            return 64;
+        }
+
+
+    }
+
+
+    class channel::impl : private boost::noncopyable
+    {
+    public:
+        // constructors and destructor
+
+        impl(const std::size_t capacity, const std::size_t batch_size) :
+        m_capacity{ capacity },
+        m_batch_size{ batch_size },
+        m_slots{},
+        m_head{ 0 },
+        m_consumer_waiting{ false },
+        m_cached_tail{ 0 },
+        m_o_front_element{},
+        m_tail{ 0 },
+        m_producer_waiting{ false },
+        m_cached_head{ 0 },
+        m_staged_tail{ 0 },
+        m_close_inserted{ false }
+        {
+            if (m_capacity == 0)
+            {
+                throw std::invalid_argument{ "capacity is 0." };
+            }
+            if (m_batch_size == 0 || m_batch_size > m_capacity)
+            {
+                throw std::invalid_argument{ "batch_size is 0 or greater than capacity." };
+            }
+            m_slots.resize(m_capacity);
+        }
+
+
+        // functions
+
+        void insert(element&& element_)
+        {
+            if (m_close_inserted)
+            {
+                return;
+            }
+            push([&element_](slot_type& slot) {
+                slot.kind = slot_kind_type::element;
+                slot.o_element.emplace(std::move(element_));
+            });
+        }
+
+        void insert(const element_view& element_view_)
+        {
+            if (m_close_inserted)
+            {
+                return;
+            }
+            push([&element_view_](slot_type& slot) {
+                // The buffers keep their capacity, so no allocation is made once they have grown enough.
+                slot.kind = slot_kind_type::element_view;
+                slot.view_type = element_view_.type();
+                slot.view_value.assign(element_view_.value());
+                slot.view_name.assign(element_view_.name());
+                if (slot.o_view_file_location)
+                {
+                    *slot.o_view_file_location = element_view_.get_file_location();
+                }
+                else
+                {
+                    slot.o_view_file_location.emplace(element_view_.get_file_location());
+                }
+            });
+        }
+
+        void insert(std::exception_ptr&& p_exception)
+        {
+            if (m_close_inserted)
+            {
+                return;
+            }
+            push([&p_exception](slot_type& slot) {
+                slot.kind = slot_kind_type::exception;
+                slot.p_exception = std::move(p_exception);
+            });
+        }
+
+        const element& peek() const
+        {
+            const auto& front = front_element_slot();
+            if (front.kind == slot_kind_type::element)
+            {
+                assert(front.o_element);
+                return *front.o_element;
+            }
+
+            if (!m_o_front_element)
+            {
+                m_o_front_element.emplace(view_of(front).to_element());
+            }
+            return *m_o_front_element;
+        }
+
+        element_view peek_view() const
+        {
+            const auto& front = front_element_slot();
+            if (front.kind == slot_kind_type::element)
+            {
+                assert(front.o_element);
+                return element_view{ *front.o_element };
+            }
+            return view_of(front);
+        }
+
+        void take()
+        {
+            auto& front = wait_for_front();
+            if (front.kind == slot_kind_type::closing)
+            {
+                throw std::logic_error{ "The channel is already closed." };
+            }
+
+            front.o_element.reset();
+            front.p_exception = nullptr;
+            m_o_front_element.reset();
+            const auto head = m_head.load(std::memory_order_relaxed) + 1;
+            m_head.store(head, std::memory_order_seq_cst);
+            if (m_producer_waiting.load(std::memory_order_seq_cst))
+            {
+                m_head.notify_one();
+            }
+        }
+
+        bool closed() const
+        {
+            return wait_for_front().kind == slot_kind_type::closing;
+        }
+
+        void flush()
+        {
+            const auto tail = m_tail.load(std::memory_order_relaxed);
+            if (m_staged_tail == tail)
+            {
+                return;
+            }
+
+            m_tail.store(m_staged_tail, std::memory_order_seq_cst);
+            if (m_consumer_waiting.load(std::memory_order_seq_cst))
+            {
+                m_tail.notify_one();
+            }
+        }
+
+        void close()
+        {
+            if (m_close_inserted)
+            {
+                return;
+            }
+            push([](slot_type& slot) { slot.kind = slot_kind_type::closing; });
+            m_close_inserted = true;
+            flush();
+        }
+
+
+    private:
+        // types
+
+        enum class slot_kind_type
+        {
+            closing,
+            element,
+            element_view,
+            exception,
+        };
+
+        struct slot_type
+        {
+            slot_kind_type kind{ slot_kind_type::closing };
+
+            std::optional<element> o_element{};
+
+            element::type_type view_type{};
+
+            std::string view_value{};
+
+            std::string view_name{};
+
+            std::optional<file_location> o_view_file_location{};
+
+            std::exception_ptr p_exception{};
+        };
+
+
+        // static functions
+
+        static element_view view_of(const slot_type& slot)
+        {
+            assert(slot.kind == slot_kind_type::element_view);
+            assert(slot.o_view_file_location);
+            return element_view{ slot.view_type, slot.view_value, slot.view_name, *slot.o_view_file_location };
+        }
+
+
+        // variables
+
+        const std::size_t m_capacity;
+
+        const std::size_t m_batch_size;
+
+        mutable std::vector<slot_type> m_slots;
+
+        // Written by the consumer.
+
+        alignas(cache_line_size()) std::atomic<std::size_t> m_head;
+
+        mutable std::atomic<bool> m_consumer_waiting;
+
+        mutable std::size_t m_cached_tail;
+
+        mutable std::optional<element> m_o_front_element;
+
+        // Written by the producer.
+
+        alignas(cache_line_size()) std::atomic<std::size_t> m_tail;
+
+        std::atomic<bool> m_producer_waiting;
+
+        std::size_t m_cached_head;
+
+        std::size_t m_staged_tail;
+
+        bool m_close_inserted;
+
+
+        // functions
+
+        template <typename Fill>
+        void push(const Fill& fill)
+        {
+            // The slots are filled ahead of the write position, and the write position is advanced by flush() once for
+            // a batch.
+            if (m_staged_tail - m_cached_head == m_capacity)
+            {
+                // The batch is handed off before waiting, or the consumer could not make room for it.
+                flush();
+                m_cached_head = wait_for_change(m_head, m_staged_tail - m_capacity, m_producer_waiting);
+            }
+
+            fill(m_slots[m_staged_tail % m_capacity]);
+            ++m_staged_tail;
+            if (m_staged_tail - m_tail.load(std::memory_order_relaxed) >= m_batch_size)
+            {
+                flush();
+            }
+        }
+
+        const slot_type& front_element_slot() const
+        {
+            const auto& front = wait_for_front();
+            if (front.kind == slot_kind_type::closing)
+            {
+                throw std::logic_error{ "The channel is already closed." };
+            }
+            if (front.kind == slot_kind_type::exception)
+            {
+                std::rethrow_exception(front.p_exception);
+            }
+            return front;
+        }
+
+        slot_type& wait_for_front() const
+        {
+            const auto head = m_head.load(std::memory_order_relaxed);
+            if (m_cached_tail == head)
+            {
+                m_cached_tail = wait_for_change(m_tail, head, m_consumer_waiting);
+            }
+            return m_slots[head % m_capacity];
+        }
+
+        static std::size_t wait_for_change(
+            const std::atomic<std::size_t>& index,
+            const std::size_t               old_value,
+            std::atomic<bool>&              waiting)
+        {
+            // The other side is notified only when this side declares that it is waiting, so no system call is made
+            // while the ring buffer is neither empty nor full.
+            auto value = index.load(std::memory_order_acquire);
+            while (value == old_value)
+            {
+                waiting.store(true, std::memory_order_seq_cst);
+                value = index.load(std::memory_order_seq_cst);
+                if (value == old_value)
+                {
+                    index.wait(old_value, std::memory_order_acquire);
+                    value = index.load(std::memory_order_acquire);
+                }
+                waiting.store(false, std::memory_order_relaxed);
+            }
+            return value;
+        }
+    };
+
+
+    channel::channel(const std::size_t capacity, const std::size_t batch_size /*= 1*/) :
+    m_p_impl{ std::make_unique<impl>(capacity, batch_size) }
+    {}
+
+    channel::~channel() = default;
+
+    void channel::insert(element element_)
+    {
+        m_p_impl->insert(std::move(element_));
+    }
+
+    void channel::insert(const element_view& element_view_)
+    {
+        m_p_impl->insert(element_view_);
+    }
+
+    void channel::insert(std::exception_ptr&& p_exception)
+    {
+        m_p_impl->insert(std::move(p_exception));
+    }
+
+    const element& channel::peek() const
+    {
+        return m_p_impl->peek();
+    }
+
+    element_view channel::peek_view() const
+    {
+        return m_p_impl->peek_view();
+    }
+
+    void channel::take()
+    {
+        m_p_impl->take();
+    }
+
+    bool channel::closed() const
+    {
+        return m_p_impl->closed();
+    }
+
+    void channel::flush()
+    {
+        m_p_impl->flush();
+    }
+
+    void channel::close()
+    {
+        m_p_impl->close();
+    }
+
+
+}
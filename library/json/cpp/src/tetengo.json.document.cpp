@@ -0,0 +1,310 @@
+/*! \file
+    \brief A document.
+
+    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
+*/
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <boost/core/noncopyable.hpp>
+
+#include <tetengo/json/document.hpp>
+#include <tetengo/json/element.hpp>
+#include <tetengo/json/element_view.hpp>
+#include <tetengo/json/json_parser.hpp>
+
+
+namespace tetengo::json
+{
+    class document::impl : private boost::noncopyable
+    {
+    public:
+        // types
+
+        struct record_type
+        {
+            element::type_name_type type;
+
+            std::size_t value_offset;
+
+            std::size_t value_length;
+
+            std::size_t name_offset;
+
+            std::size_t name_length;
+
+            std::size_t children_offset;
+
+            std::size_t child_count;
+
+            std::size_t sorted_children_offset;
+        };
+
+
+        // constructors and destructor
+
+        explicit impl(json_parser& parser) : m_records{}, m_child_indices{}, m_strings{}
+        {
+            build(parser);
+        }
+
+
+        // functions
+
+        const record_type& record(const std::size_t index) const
+        {
+            assert(index < std::size(m_records));
+            return m_records[index];
+        }
+
+        std::string_view value_of(const record_type& record_) const
+        {
+            return std::string_view{ m_strings }.substr(record_.value_offset, record_.value_length);
+        }
+
+        std::string_view name_of(const record_type& record_) const
+        {
+            return std::string_view{ m_strings }.substr(record_.name_offset, record_.name_length);
+        }
+
+        const std::size_t* children_of(const record_type& record_) const
+        {
+            return std::data(m_child_indices) + record_.children_offset;
+        }
+
+        std::optional<std::size_t> find_child(const record_type& record_, const std::string_view& name) const
+        {
+            if (record_.type != element::type_name_type::object)
+            {
+                return std::nullopt;
+            }
+
+            const auto first = std::next(std::begin(m_child_indices), record_.sorted_children_offset);
+            const auto last = std::next(first, record_.child_count);
+            const auto found = std::lower_bound(first, last, name, [this](const auto& index, const auto& name_) {
+                return name_of(m_records[index]) < name_;
+            });
+            if (found == last || name_of(m_records[*found]) != name)
+            {
+                return std::nullopt;
+            }
+            return std::make_optional(*found);
+        }
+
+
+    private:
+        // variables
+
+        std::vector<record_type> m_records;
+
+        std::vector<std::size_t> m_child_indices;
+
+        std::string m_strings;
+
+
+        // functions
+
+        void build(json_parser& parser)
+        {
+            std::vector<std::size_t>              open_containers{};
+            std::vector<std::vector<std::size_t>> children_stack{};
+            std::size_t                           name_offset = 0;
+            std::size_t                           name_length = 0;
+            std::string                           buffer{};
+            auto                                  root_completed = false;
+            while (parser.has_next())
+            {
+                if (root_completed)
+                {
+                    throw std::runtime_error{ "Extra JSON value." };
+                }
+
+                const auto view = parser.peek_view();
+                if (view.type().name == element::type_name_type::member)
+                {
+                    if (view.type().category == element::type_category_type::structure_open)
+                    {
+                        name_offset = std::size(m_strings);
+                        m_strings.append(view.decoded_name(buffer));
+                        name_length = std::size(m_strings) - name_offset;
+                    }
+                }
+                else if (view.type().category == element::type_category_type::structure_close)
+                {
+                    assert(!std::empty(open_containers));
+                    close_container(open_containers.back(), children_stack[std::size(open_containers) - 1]);
+                    open_containers.pop_back();
+                    root_completed = std::empty(open_containers);
+                }
+                else
+                {
+                    const auto index = std::size(m_records);
+                    const auto value_offset = std::size(m_strings);
+                    m_strings.append(view.decoded_value(buffer));
+                    m_records.push_back({ view.type().name,
+                                          value_offset,
+                                          std::size(m_strings) - value_offset,
+                                          name_offset,
+                                          name_length,
+                                          0,
+                                          0,
+                                          0 });
+                    name_length = 0;
+
+                    if (!std::empty(open_containers))
+                    {
+                        children_stack[std::size(open_containers) - 1].push_back(index);
+                    }
+                    if (view.type().category == element::type_category_type::structure_open)
+                    {
+                        open_containers.push_back(index);
+                        if (std::size(children_stack) < std::size(open_containers))
+                        {
+                            children_stack.emplace_back();
+                        }
+                    }
+                    else
+                    {
+                        root_completed = std::empty(open_containers);
+                    }
+                }
+
+                parser.next();
+            }
+            if (!root_completed)
+            {
+                throw std::runtime_error{ "No JSON value." };
+            }
+        }
+
+        void close_container(const std::size_t index, std::vector<std::size_t>& children)
+        {
+            auto& record_ = m_records[index];
+            record_.children_offset = std::size(m_child_indices);
+            record_.child_count = std::size(children);
+            m_child_indices.insert(std::end(m_child_indices), std::begin(children), std::end(children));
+            if (record_.type == element::type_name_type::object)
+            {
+                record_.sorted_children_offset = std::size(m_child_indices);
+                m_child_indices.insert(std::end(m_child_indices), std::begin(children), std::end(children));
+                std::stable_sort(
+                    std::next(std::begin(m_child_indices), record_.sorted_children_offset),
+                    std::end(m_child_indices),
+                    [this](const auto& one, const auto& another) {
+                        return name_of(m_records[one]) < name_of(m_records[another]);
+                    });
+            }
+            children.clear();
+        }
+    };
+
+
+    document::node::node() : m_p_document{ nullptr }, m_index{ 0 } {}
+
+    element::type_name_type document::node::type() const
+    {
+        return m_p_document->m_p_impl->record(m_index).type;
+    }
+
+    std::string_view document::node::value() const
+    {
+        const auto& impl_ = *m_p_document->m_p_impl;
+        return impl_.value_of(impl_.record(m_index));
+    }
+
+    std::string_view document::node::name() const
+    {
+        const auto& impl_ = *m_p_document->m_p_impl;
+        return impl_.name_of(impl_.record(m_index));
+    }
+
+    std::size_t document::node::size() const
+    {
+        return m_p_document->m_p_impl->record(m_index).child_count;
+    }
+
+    document::node document::node::operator[](const std::size_t index) const
+    {
+        const auto& impl_ = *m_p_document->m_p_impl;
+        const auto& record_ = impl_.record(m_index);
+        if (index >= record_.child_count)
+        {
+            throw std::out_of_range{ "index is out of the range." };
+        }
+        return node{ *m_p_document, impl_.children_of(record_)[index] };
+    }
+
+    std::optional<document::node> document::node::find(const std::string_view name) const
+    {
+        const auto& impl_ = *m_p_document->m_p_impl;
+        const auto  o_index = impl_.find_child(impl_.record(m_index), name);
+        if (!o_index)
+        {
+            return std::nullopt;
+        }
+        return std::make_optional(node{ *m_p_document, *o_index });
+    }
+
+    document::node_iterator document::node::begin() const
+    {
+        const auto& impl_ = *m_p_document->m_p_impl;
+        return node_iterator{ *m_p_document, impl_.children_of(impl_.record(m_index)) };
+    }
+
+    document::node_iterator document::node::end() const
+    {
+        const auto& impl_ = *m_p_document->m_p_impl;
+        const auto& record_ = impl_.record(m_index);
+        return node_iterator{ *m_p_document, impl_.children_of(record_) + record_.child_count };
+    }
+
+    document::node::node(const document& document_, const std::size_t index) :
+    m_p_document{ &document_ },
+    m_index{ index }
+    {}
+
+
+    document::node_iterator::node_iterator() : m_p_document{ nullptr }, m_p_child_index{ nullptr } {}
+
+    document::node document::node_iterator::operator*() const
+    {
+        return node{ *m_p_document, *m_p_child_index };
+    }
+
+    document::node_iterator& document::node_iterator::operator+=(const std::ptrdiff_t n)
+    {
+        m_p_child_index += n;
+        return *this;
+    }
+
+    std::ptrdiff_t operator-(const document::node_iterator& one, const document::node_iterator& another)
+    {
+        return one.m_p_child_index - another.m_p_child_index;
+    }
+
+    document::node_iterator::node_iterator(const document& document_, const std::size_t* const p_child_index) :
+    m_p_document{ &document_ },
+    m_p_child_index{ p_child_index }
+    {}
+
+
+    document::document(json_parser& parser) : m_p_impl{ std::make_unique<impl>(parser) } {}
+
+    document::~document() = default;
+
+    document::node document::root() const
+    {
+        return node{ *this, 0 };
+    }
+
+
+}
@@ -0,0 +1,54 @@
+/*! \file
+    \brief An element type converter.
+
+    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
+*/
+
+#include <cassert>
+
+#include <tetengo/json/element.hpp>
+#include <tetengo/json/json_grammar.hpp>
+
+#include "tetengo.json.element_type_converter.hpp"
+
+
+namespace tetengo::json
+{
+    element::type_type element_type_converter::to_element_type(const json_grammar::primitive_type_type primitive_type)
+    {
+        switch (primitive_type)
+        {
+        case json_grammar::primitive_type_type::string:
+            return { element::type_name_type::string, element::type_category_type::primitive };
+        case json_grammar::primitive_type_type::number:
+            return { element::type_name_type::number, element::type_category_type::primitive };
+        case json_grammar::primitive_type_type::boolean:
+            return { element::type_name_type::boolean, element::type_category_type::primitive };
+        default:
+            assert(primitive_type == json_grammar::primitive_type_type::null);
+            return { element::type_name_type::null, element::type_category_type::primitive };
+        }
+    }
+
+    element::type_type element_type_converter::to_element_type(
+        const json_grammar::structure_type_type       structure_type,
+        const json_grammar::structure_open_close_type structure_open_close)
+    {
+        switch (const element::type_category_type element_category =
+                    structure_open_close == json_grammar::structure_open_close_type::open ?
+                        element::type_category_type::structure_open :
+                        element::type_category_type::structure_close;
+                structure_type)
+        {
+        case json_grammar::structure_type_type::object:
+            return { element::type_name_type::object, element_category };
+        case json_grammar::structure_type_type::member:
+            return { element::type_name_type::member, element_category };
+        default:
+            assert(structure_type == json_grammar::structure_type_type::array);
+            return { element::type_name_type::array, element_category };
+        }
+    }
+
+
+}
@@ -0,0 +1,55 @@
+/*! \file
+    \brief An element type converter.
+
+    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
+*/
+
+#if !defined(TETENGO_JSON_ELEMENTTYPECONVERTER_HPP)
+#define TETENGO_JSON_ELEMENTTYPECONVERTER_HPP
+
+#include <tetengo/json/element.hpp>
+#include <tetengo/json/json_grammar.hpp>
+
+
+namespace tetengo::json
+{
+    /*!
+        \brief An element type converter.
+    */
+    class element_type_converter
+    {
+    public:
+        // static functions
+
+        /*!
+            \brief Converts a primitive type into an element type.
+
+            \param primitive_type A primitive type.
+
+            \return The element type.
+        */
+        [[nodiscard]] static element::type_type to_element_type(json_grammar::primitive_type_type primitive_type);
+
+        /*!
+            \brief Converts a structure type into an element type.
+
+            \param structure_type       A structure type.
+            \param structure_open_close A structure open-close type.
+
+            \return The element type.
+        */
+        [[nodiscard]] static element::type_type to_element_type(
+            json_grammar::structure_type_type       structure_type,
+            json_grammar::structure_open_close_type structure_open_close);
+
+
+        // constructors
+
+        element_type_converter() = delete;
+    };
+
+
+}
+
+
+#endif
@@ -0,0 +1,157 @@
+/*! \file
+    \brief An element view.
+
+    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
+*/
+
+#include <charconv>
+#include <cstdint>
+#include <iterator>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <unordered_map>
+#include <utility>
+
+#include <tetengo/json/element.hpp>
+#include <tetengo/json/element_view.hpp>
+#include <tetengo/json/file_location.hpp>
+
+#include "tetengo.json.string_decoder.hpp"
+
+
+namespace tetengo::json
+{
+    namespace
+    {
+        bool is_primitive(const element::type_name_type type_name)
+        {
+            return type_name == element::type_name_type::string || type_name == element::type_name_type::number ||
+                   type_name == element::type_name_type::boolean || type_name == element::type_name_type::null;
+        }
+
+        bool is_member_open(const element::type_type& type)
+        {
+            return type.name == element::type_name_type::member &&
+                   type.category == element::type_category_type::structure_open;
+        }
+
+        std::string_view name_of(const element& element_)
+        {
+            if (!is_member_open(element_.type()))
+            {
+                return std::string_view{};
+            }
+            return element_.attributes().at("name");
+        }
+
+        template <typename T>
+        std::optional<T> parse_number(const std::string_view& string)
+        {
+            T                 value{};
+            const auto* const p_last = std::data(string) + string.length();
+            const auto        result = std::from_chars(std::data(string), p_last, value);
+            if (result.ec != std::errc{} || result.ptr != p_last)
+            {
+                return std::nullopt;
+            }
+            return std::make_optional(value);
+        }
+
+
+    }
+
+
+    element_view::element_view(
+        element::type_type   type,
+        std::string_view     value,
+        std::string_view     name,
+        const file_location& file_location_) :
+    m_type{ type },
+    m_value{ value },
+    m_name{ name },
+    m_p_file_location{ &file_location_ }
+    {
+        if (is_primitive(m_type.name) != (m_type.category == element::type_category_type::primitive))
+        {
+            throw std::invalid_argument{ "Mismatch between type name and type category." };
+        }
+        if (m_type.category != element::type_category_type::primitive && !std::empty(m_value))
+        {
+            throw std::invalid_argument{ "Mismatch between type and value." };
+        }
+        if (!is_member_open(m_type) && !std::empty(m_name))
+        {
+            throw std::invalid_argument{ "Mismatch between type and name." };
+        }
+    }
+
+    element_view::element_view(const element& element_) :
+    m_type{ element_.type() },
+    m_value{ element_.value() },
+    m_name{ name_of(element_) },
+    m_p_file_location{ &element_.get_file_location() }
+    {}
+
+    const element::type_type& element_view::type() const
+    {
+        return m_type;
+    }
+
+    std::string_view element_view::value() const
+    {
+        return m_value;
+    }
+
+    std::string_view element_view::name() const
+    {
+        return m_name;
+    }
+
+    std::string_view element_view::decoded_value(std::string& buffer) const
+    {
+        return string_decoder::decode(m_value, buffer);
+    }
+
+    std::string_view element_view::decoded_name(std::string& buffer) const
+    {
+        return string_decoder::decode(m_name, buffer);
+    }
+
+    std::optional<std::int64_t> element_view::integer_value() const
+    {
+        if (m_type.name != element::type_name_type::number)
+        {
+            return std::nullopt;
+        }
+        return parse_number<std::int64_t>(m_value);
+    }
+
+    std::optional<double> element_view::double_value() const
+    {
+        if (m_type.name != element::type_name_type::number)
+        {
+            return std::nullopt;
+        }
+        return parse_number<double>(m_value);
+    }
+
+    const file_location& element_view::get_file_location() const
+    {
+        return *m_p_file_location;
+    }
+
+    element element_view::to_element() const
+    {
+        std::unordered_map<std::string, std::string> attributes{};
+        if (is_member_open(m_type))
+        {
+            attributes.insert({ "name", std::string{ m_name } });
+        }
+        return element{ m_type, std::string{ m_value }, std::move(attributes), *m_p_file_location };
+    }
+
+
+}
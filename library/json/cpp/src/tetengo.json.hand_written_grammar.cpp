@@ -0,0 +1,949 @@
+/*! \file
+    \brief A hand-written JSON grammar.
+
+    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
+*/
+
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <boost/core/noncopyable.hpp>
+
+#include <tetengo/json/json_grammar.hpp>
+#include <tetengo/json/json_pointer.hpp>
+#include <tetengo/json/reader.hpp>
+
+#include "tetengo.json.hand_written_grammar.hpp"
+#include "tetengo.json.string_decoder.hpp"
+
+
+namespace tetengo::json
+{
+    namespace
+    {
+        enum class character_class_type : unsigned char
+        {
+            other,
+            whitespace,
+            structural,
+            quotation_mark,
+            escape,
+            control,
+            digit,
+            minus,
+            literal_head,
+        };
+
+        constexpr std::array<character_class_type, 256> make_character_class_table()
+        {
+            std::array<character_class_type, 256> table{};
+            for (auto i = static_cast<std::size_t>(0); i < 0x20; ++i)
+            {
+                table[i] = character_class_type::control;
+            }
+            table[static_cast<unsigned char>(' ')] = character_class_type::whitespace;
+            table[static_cast<unsigned char>('\t')] = character_class_type::whitespace;
+            table[static_cast<unsigned char>('\n')] = character_class_type::whitespace;
+            table[static_cast<unsigned char>('\r')] = character_class_type::whitespace;
+            for (const auto c: std::string_view{ "{}[]:," })
+            {
+                table[static_cast<unsigned char>(c)] = character_class_type::structural;
+            }
+            table[static_cast<unsigned char>('"')] = character_class_type::quotation_mark;
+            table[static_cast<unsigned char>('\\')] = character_class_type::escape;
+            for (auto c = '0'; c <= '9'; ++c)
+            {
+                table[static_cast<unsigned char>(c)] = character_class_type::digit;
+            }
+            table[static_cast<unsigned char>('-')] = character_class_type::minus;
+            table[static_cast<unsigned char>('f')] = character_class_type::literal_head;
+            table[static_cast<unsigned char>('n')] = character_class_type::literal_head;
+            table[static_cast<unsigned char>('t')] = character_class_type::literal_head;
+            return table;
+        }
+
+        constexpr std::array<character_class_type, 256> character_class_table = make_character_class_table();
+
+        constexpr character_class_type character_class_of(const char c)
+        {
+            return character_class_table[static_cast<unsigned char>(c)];
+        }
+
+        constexpr bool is_digit(const char c)
+        {
+            return character_class_of(c) == character_class_type::digit;
+        }
+
+        constexpr bool is_xdigit(const char c)
+        {
+            return is_digit(c) || ('a' <= c && c <= 'f') || ('A' <= c && c <= 'F');
+        }
+
+        constexpr bool is_string_special_character(const char c)
+        {
+            const auto class_ = character_class_of(c);
+            return class_ == character_class_type::quotation_mark || class_ == character_class_type::escape ||
+                   class_ == character_class_type::control;
+        }
+
+        constexpr std::uint64_t broadcast(const unsigned char byte)
+        {
+            return 0x0101010101010101ULL * byte;
+        }
+
+        constexpr std::uint64_t has_byte_less_than(const std::uint64_t word, const unsigned char byte)
+        {
+            return (word - broadcast(byte)) & ~word & broadcast(0x80);
+        }
+
+        constexpr std::uint64_t has_byte_equal_to(const std::uint64_t word, const unsigned char byte)
+        {
+            return has_byte_less_than(word ^ broadcast(byte), 1);
+        }
+
+        std::size_t find_string_special_character(const std::string_view& chunk)
+        {
+            // Checks eight characters at a time for a quotation mark, a reverse solidus and a control character.
+            auto offset = static_cast<std::size_t>(0);
+            for (; offset + sizeof(std::uint64_t) <= chunk.length(); offset += sizeof(std::uint64_t))
+            {
+                std::uint64_t word = 0;
+                std::memcpy(&word, std::data(chunk) + offset, sizeof(std::uint64_t));
+                if ((has_byte_equal_to(word, '"') | has_byte_equal_to(word, '\\') | has_byte_less_than(word, 0x20)) !=
+                    0)
+                {
+                    break;
+                }
+            }
+            for (; offset < chunk.length(); ++offset)
+            {
+                if (is_string_special_character(chunk[offset]))
+                {
+                    return offset;
+                }
+            }
+            return std::string_view::npos;
+        }
+
+        constexpr bool is_container_special_character(const char c)
+        {
+            return c == '"' || c == '{' || c == '}' || c == '[' || c == ']';
+        }
+
+        std::size_t find_container_special_character(const std::string_view& chunk)
+        {
+            // Checks eight characters at a time for a quotation mark and a bracket.
+            auto offset = static_cast<std::size_t>(0);
+            for (; offset + sizeof(std::uint64_t) <= chunk.length(); offset += sizeof(std::uint64_t))
+            {
+                std::uint64_t word = 0;
+                std::memcpy(&word, std::data(chunk) + offset, sizeof(std::uint64_t));
+                if ((has_byte_equal_to(word, '"') | has_byte_equal_to(word, '{') | has_byte_equal_to(word, '}') |
+                     has_byte_equal_to(word, '[') | has_byte_equal_to(word, ']')) != 0)
+                {
+                    break;
+                }
+            }
+            for (; offset < chunk.length(); ++offset)
+            {
+                if (is_container_special_character(chunk[offset]))
+                {
+                    return offset;
+                }
+            }
+            return std::string_view::npos;
+        }
+
+
+        class parsing_context : private boost::noncopyable
+        {
+        public:
+            // constructors and destructor
+
+            parsing_context(
+                const json_grammar::primitive_handler_type& primitive_handler,
+                const json_grammar::structure_handler_type& structure_handler,
+                const std::vector<json_pointer>&            filters,
+                reader&                                     reader_) :
+            m_primitive_handler{ primitive_handler },
+            m_structure_handler{ structure_handler },
+            m_filters{ filters },
+            m_reader{ reader_ },
+            m_state{ state_type::text_begin },
+            m_status{ hand_written_grammar::parsing_status_type::in_progress },
+            m_token{},
+            m_containers{},
+            m_path{},
+            m_o_emitting_depth{ std::empty(filters) ? std::make_optional<std::size_t>(0) : std::nullopt },
+            m_decoding_buffer{},
+            m_no_attributes{},
+            m_name_attributes{ { "name", std::string_view{} } }
+            {}
+
+
+            // functions
+
+            hand_written_grammar::parsing_status_type parse_step()
+            {
+                if (m_status != hand_written_grammar::parsing_status_type::in_progress)
+                {
+                    return m_status;
+                }
+
+                switch (m_state)
+                {
+                case state_type::text_begin:
+                    skip_whitespaces();
+                    m_state = state_type::value;
+                    break;
+                case state_type::value:
+                    if (!parse_value())
+                    {
+                        m_status = hand_written_grammar::parsing_status_type::failed;
+                    }
+                    break;
+                case state_type::member_name:
+                    if (!parse_member_name())
+                    {
+                        m_status = hand_written_grammar::parsing_status_type::failed;
+                    }
+                    m_state = state_type::value;
+                    break;
+                default:
+                    if (std::empty(m_containers))
+                    {
+                        skip_whitespaces();
+                        m_status = m_reader.has_next() ? hand_written_grammar::parsing_status_type::failed :
+                                                         hand_written_grammar::parsing_status_type::succeeded;
+                    }
+                    else if (!parse_after_value())
+                    {
+                        m_status = hand_written_grammar::parsing_status_type::failed;
+                    }
+                    break;
+                }
+                return m_status;
+            }
+
+
+        private:
+            // types
+
+            enum class state_type
+            {
+                text_begin,
+                value,
+                member_name,
+                after_value,
+            };
+
+            enum class container_type
+            {
+                object,
+                array,
+            };
+
+            enum class match_type
+            {
+                none,
+                prefix,
+                full,
+            };
+
+            struct path_step_type
+            {
+                std::string name;
+
+                std::size_t index;
+            };
+
+
+            // static functions
+
+            static json_grammar::structure_type_type to_structure_type(const container_type container)
+            {
+                return container == container_type::object ? json_grammar::structure_type_type::object :
+                                                             json_grammar::structure_type_type::array;
+            }
+
+
+            // variables
+
+            const json_grammar::primitive_handler_type& m_primitive_handler;
+
+            const json_grammar::structure_handler_type& m_structure_handler;
+
+            const std::vector<json_pointer>& m_filters;
+
+            reader& m_reader;
+
+            state_type m_state;
+
+            hand_written_grammar::parsing_status_type m_status;
+
+            std::string m_token;
+
+            std::vector<container_type> m_containers;
+
+            std::vector<path_step_type> m_path;
+
+            std::optional<std::size_t> m_o_emitting_depth;
+
+            std::string m_decoding_buffer;
+
+            const std::unordered_map<std::string_view, std::string_view> m_no_attributes;
+
+            std::unordered_map<std::string_view, std::string_view> m_name_attributes;
+
+
+            // functions
+
+            bool parse_value()
+            {
+                if (!m_reader.has_next())
+                {
+                    return false;
+                }
+                if (!emits_at(std::size(m_containers)))
+                {
+                    switch (match_path())
+                    {
+                    case match_type::full:
+                        m_o_emitting_depth = std::size(m_containers);
+                        break;
+                    case match_type::prefix:
+                        if (m_reader.peek() == '{' || m_reader.peek() == '[')
+                        {
+                            break;
+                        }
+                        [[fallthrough]];
+                    default:
+                        m_state = state_type::after_value;
+                        return skip_value();
+                    }
+                }
+                switch (const auto c = m_reader.peek(); character_class_of(c))
+                {
+                case character_class_type::structural:
+                    if (c == '{')
+                    {
+                        return open_container(container_type::object, '}');
+                    }
+                    else if (c == '[')
+                    {
+                        return open_container(container_type::array, ']');
+                    }
+                    return false;
+                case character_class_type::quotation_mark:
+                    m_state = state_type::after_value;
+                    return read_string() && emit_primitive(json_grammar::primitive_type_type::string, string_content());
+                case character_class_type::digit:
+                case character_class_type::minus:
+                    m_state = state_type::after_value;
+                    return read_number() && emit_primitive(json_grammar::primitive_type_type::number, m_token);
+                case character_class_type::literal_head:
+                    m_state = state_type::after_value;
+                    if (c == 'f')
+                    {
+                        return read_literal("false") &&
+                               emit_primitive(json_grammar::primitive_type_type::boolean, m_token);
+                    }
+                    else if (c == 'n')
+                    {
+                        return read_literal("null") && emit_primitive(json_grammar::primitive_type_type::null, m_token);
+                    }
+                    else
+                    {
+                        return read_literal("true") &&
+                               emit_primitive(json_grammar::primitive_type_type::boolean, m_token);
+                    }
+                default:
+                    return false;
+                }
+            }
+
+            bool parse_member_name()
+            {
+                if (!m_reader.has_next() || m_reader.peek() != '"' || !read_string())
+                {
+                    return false;
+                }
+                if (emits_at(std::size(m_containers) - 1))
+                {
+                    m_name_attributes.begin()->second = string_content();
+                    if (!m_structure_handler(
+                            json_grammar::structure_type_type::member,
+                            json_grammar::structure_open_close_type::open,
+                            m_name_attributes))
+                    {
+                        return false;
+                    }
+                }
+                else
+                {
+                    m_path[std::size(m_containers) - 1].name.assign(
+                        string_decoder::decode(string_content(), m_decoding_buffer));
+                }
+
+                skip_whitespaces();
+                if (!m_reader.has_next() || m_reader.peek() != ':')
+                {
+                    return false;
+                }
+                m_reader.next();
+                skip_whitespaces();
+                return true;
+            }
+
+            bool parse_after_value()
+            {
+                const auto container = m_containers.back();
+                if (container == container_type::object && emits_at(std::size(m_containers) - 1) &&
+                    !m_structure_handler(
+                        json_grammar::structure_type_type::member,
+                        json_grammar::structure_open_close_type::close,
+                        m_no_attributes))
+                {
+                    return false;
+                }
+
+                skip_whitespaces();
+                if (!m_reader.has_next())
+                {
+                    return false;
+                }
+                if (m_reader.peek() == ',')
+                {
+                    m_reader.next();
+                    skip_whitespaces();
+                    if (!std::empty(m_filters))
+                    {
+                        ++m_path[std::size(m_containers) - 1].index;
+                    }
+                    m_state = container == container_type::object ? state_type::member_name : state_type::value;
+                    return true;
+                }
+                return close_container(container, container == container_type::object ? '}' : ']');
+            }
+
+            bool open_container(const container_type container, const char close_char)
+            {
+                m_reader.next();
+                skip_whitespaces();
+                if (emits_at(std::size(m_containers)) &&
+                    !m_structure_handler(
+                        to_structure_type(container), json_grammar::structure_open_close_type::open, m_no_attributes))
+                {
+                    return false;
+                }
+                m_containers.push_back(container);
+                if (!std::empty(m_filters))
+                {
+                    if (std::size(m_path) < std::size(m_containers))
+                    {
+                        m_path.emplace_back();
+                    }
+                    m_path[std::size(m_containers) - 1].name.clear();
+                    m_path[std::size(m_containers) - 1].index = 0;
+                }
+
+                if (m_reader.has_next() && m_reader.peek() == close_char)
+                {
+                    return close_container(container, close_char);
+                }
+                m_state = container == container_type::object ? state_type::member_name : state_type::value;
+                return true;
+            }
+
+            bool close_container(const container_type container, const char close_char)
+            {
+                if (!m_reader.has_next() || m_reader.peek() != close_char)
+                {
+                    return false;
+                }
+                m_reader.next();
+                skip_whitespaces();
+                m_containers.pop_back();
+                m_state = state_type::after_value;
+                if (!emits_at(std::size(m_containers)))
+                {
+                    return true;
+                }
+                const auto result = m_structure_handler(
+                    to_structure_type(container), json_grammar::structure_open_close_type::close, m_no_attributes);
+                end_emission_at_matched_value();
+                return result;
+            }
+
+            bool emit_primitive(const json_grammar::primitive_type_type type, const std::string_view& value)
+            {
+                const auto result = m_primitive_handler(type, value);
+                end_emission_at_matched_value();
+                return result;
+            }
+
+            bool emits_at(const std::size_t depth) const
+            {
+                return m_o_emitting_depth && depth >= *m_o_emitting_depth;
+            }
+
+            void end_emission_at_matched_value()
+            {
+                if (!std::empty(m_filters) && std::size(m_containers) == *m_o_emitting_depth)
+                {
+                    m_o_emitting_depth.reset();
+                }
+            }
+
+            match_type match_path() const
+            {
+                auto result = match_type::none;
+                for (const auto& filter: m_filters)
+                {
+                    const auto& tokens = filter.reference_tokens();
+                    if (std::size(tokens) < std::size(m_containers))
+                    {
+                        continue;
+                    }
+                    auto matched = true;
+                    for (auto i = static_cast<std::size_t>(0); matched && i < std::size(m_containers); ++i)
+                    {
+                        matched = matches_path_step(tokens[i], i);
+                    }
+                    if (!matched)
+                    {
+                        continue;
+                    }
+                    if (std::size(tokens) == std::size(m_containers))
+                    {
+                        return match_type::full;
+                    }
+                    result = match_type::prefix;
+                }
+                return result;
+            }
+
+            bool matches_path_step(const std::string& token, const std::size_t depth) const
+            {
+                if (token == json_pointer::wildcard())
+                {
+                    return true;
+                }
+                if (m_containers[depth] == container_type::object)
+                {
+                    return token == m_path[depth].name;
+                }
+                std::array<char, 24> index_chars{};
+                auto* const          p_first = std::data(index_chars);
+                const auto           result =
+                    std::to_chars(p_first, p_first + std::size(index_chars), m_path[depth].index);
+                return token == std::string_view{ p_first, static_cast<std::size_t>(result.ptr - p_first) };
+            }
+
+            bool skip_value()
+            {
+                switch (const auto c = m_reader.peek(); character_class_of(c))
+                {
+                case character_class_type::structural:
+                    return (c == '{' || c == '[') && skip_container();
+                case character_class_type::quotation_mark:
+                    m_reader.next();
+                    return skip_string_rest();
+                case character_class_type::digit:
+                case character_class_type::minus:
+                case character_class_type::literal_head:
+                    skip_scalar();
+                    return true;
+                default:
+                    return false;
+                }
+            }
+
+            bool skip_container()
+            {
+                auto depth = static_cast<std::size_t>(0);
+                for (;;)
+                {
+                    const auto chunk = m_reader.peek_chunk();
+                    if (std::empty(chunk))
+                    {
+                        return false;
+                    }
+                    const auto offset = find_container_special_character(chunk);
+                    if (offset == std::string_view::npos)
+                    {
+                        m_reader.consume(chunk.length());
+                        continue;
+                    }
+                    const auto c = chunk[offset];
+                    m_reader.consume(offset + 1);
+                    if (c == '"')
+                    {
+                        if (!skip_string_rest())
+                        {
+                            return false;
+                        }
+                    }
+                    else if (c == '{' || c == '[')
+                    {
+                        ++depth;
+                    }
+                    else if (--depth == 0)
+                    {
+                        return true;
+                    }
+                }
+            }
+
+            bool skip_string_rest()
+            {
+                for (;;)
+                {
+                    const auto chunk = m_reader.peek_chunk();
+                    if (std::empty(chunk))
+                    {
+                        return false;
+                    }
+                    const auto offset = find_string_special_character(chunk);
+                    if (offset == std::string_view::npos)
+                    {
+                        m_reader.consume(chunk.length());
+                        continue;
+                    }
+                    switch (character_class_of(chunk[offset]))
+                    {
+                    case character_class_type::quotation_mark:
+                        m_reader.consume(offset + 1);
+                        return true;
+                    case character_class_type::escape:
+                        m_reader.consume(offset + 1);
+                        if (!m_reader.has_next())
+                        {
+                            return false;
+                        }
+                        m_reader.next();
+                        break;
+                    default:
+                        return false;
+                    }
+                }
+            }
+
+            void skip_scalar()
+            {
+                for (;;)
+                {
+                    const auto chunk = m_reader.peek_chunk();
+                    auto       length = static_cast<std::size_t>(0);
+                    while (length < chunk.length())
+                    {
+                        const auto class_ = character_class_of(chunk[length]);
+                        if (class_ == character_class_type::whitespace || class_ == character_class_type::structural ||
+                            class_ == character_class_type::quotation_mark)
+                        {
+                            break;
+                        }
+                        ++length;
+                    }
+                    m_reader.consume(length);
+                    if (length < chunk.length() || std::empty(chunk))
+                    {
+                        return;
+                    }
+                }
+            }
+
+            void skip_whitespaces()
+            {
+                for (;;)
+                {
+                    const auto chunk = m_reader.peek_chunk();
+                    auto       length = static_cast<std::size_t>(0);
+                    while (length < chunk.length() &&
+                           character_class_of(chunk[length]) == character_class_type::whitespace)
+                    {
+                        ++length;
+                    }
+                    m_reader.consume(length);
+                    if (length < chunk.length() || std::empty(chunk))
+                    {
+                        return;
+                    }
+                }
+            }
+
+            bool read_string()
+            {
+                m_token.clear();
+                m_token.push_back(m_reader.peek());
+                m_reader.next();
+                for (;;)
+                {
+                    const auto chunk = m_reader.peek_chunk();
+                    if (std::empty(chunk))
+                    {
+                        return false;
+                    }
+                    const auto offset = find_string_special_character(chunk);
+                    if (offset == std::string_view::npos)
+                    {
+                        m_token.append(chunk);
+                        m_reader.consume(chunk.length());
+                        continue;
+                    }
+                    const auto c = chunk[offset];
+                    m_token.append(chunk.substr(0, offset));
+                    m_reader.consume(offset);
+
+                    switch (character_class_of(c))
+                    {
+                    case character_class_type::quotation_mark:
+                        m_token.push_back(c);
+                        m_reader.next();
+                        return true;
+                    case character_class_type::escape:
+                        if (!read_escape())
+                        {
+                            return false;
+                        }
+                        break;
+                    default:
+                        return false;
+                    }
+                }
+            }
+
+            bool read_escape()
+            {
+                m_token.push_back(m_reader.peek());
+                m_reader.next();
+                if (!m_reader.has_next())
+                {
+                    return false;
+                }
+                const auto c = m_reader.peek();
+                switch (c)
+                {
+                case '"':
+                case '\\':
+                case '/':
+                case 'b':
+                case 'f':
+                case 'n':
+                case 'r':
+                case 't':
+                    m_token.push_back(c);
+                    m_reader.next();
+                    return true;
+                case 'u':
+                    m_token.push_back(c);
+                    m_reader.next();
+                    for (auto i = static_cast<std::size_t>(0); i < 4; ++i)
+                    {
+                        if (!m_reader.has_next() || !is_xdigit(m_reader.peek()))
+                        {
+                            return false;
+                        }
+                        m_token.push_back(m_reader.peek());
+                        m_reader.next();
+                    }
+                    return true;
+                default:
+                    return false;
+                }
+            }
+
+            std::string_view string_content() const
+            {
+                return std::string_view{ m_token }.substr(1, m_token.length() - 2);
+            }
+
+            bool read_number()
+            {
+                m_token.clear();
+                if (m_reader.peek() == '-')
+                {
+                    m_token.push_back('-');
+                    m_reader.next();
+                }
+
+                if (!m_reader.has_next() || !is_digit(m_reader.peek()))
+                {
+                    return false;
+                }
+                if (m_reader.peek() == '0')
+                {
+                    m_token.push_back('0');
+                    m_reader.next();
+                }
+                else
+                {
+                    read_digits();
+                }
+
+                if (m_reader.has_next() && m_reader.peek() == '.')
+                {
+                    m_token.push_back('.');
+                    m_reader.next();
+                    if (read_digits() == 0)
+                    {
+                        return false;
+                    }
+                }
+
+                if (m_reader.has_next() && (m_reader.peek() == 'e' || m_reader.peek() == 'E'))
+                {
+                    m_token.push_back(m_reader.peek());
+                    m_reader.next();
+                    if (m_reader.has_next() && (m_reader.peek() == '+' || m_reader.peek() == '-'))
+                    {
+                        m_token.push_back(m_reader.peek());
+                        m_reader.next();
+                    }
+                    if (read_digits() == 0)
+                    {
+                        return false;
+                    }
+                }
+
+                return true;
+            }
+
+            std::size_t read_digits()
+            {
+                auto count = static_cast<std::size_t>(0);
+                for (;;)
+                {
+                    const auto chunk = m_reader.peek_chunk();
+                    auto       length = static_cast<std::size_t>(0);
+                    while (length < chunk.length() && is_digit(chunk[length]))
+                    {
+                        ++length;
+                    }
+                    m_token.append(chunk.substr(0, length));
+                    m_reader.consume(length);
+                    count += length;
+                    if (length < chunk.length() || std::empty(chunk))
+                    {
+                        return count;
+                    }
+                }
+            }
+
+            bool read_literal(const std::string_view& literal)
+            {
+                m_token.clear();
+                for (const auto c: literal)
+                {
+                    if (!m_reader.has_next() || m_reader.peek() != c)
+                    {
+                        return false;
+                    }
+                    m_token.push_back(c);
+                    m_reader.next();
+                }
+                return true;
+            }
+        };
+
+
+    }
+
+
+    class hand_written_grammar::impl : private boost::noncopyable
+    {
+    public:
+        // constructors and destructor
+
+        impl(
+            json_grammar::primitive_handler_type primitive_handler,
+            json_grammar::structure_handler_type structure_handler,
+            std::vector<json_pointer>            filters) :
+        m_primitive_handler{ std::move(primitive_handler) },
+        m_structure_handler{ std::move(structure_handler) },
+        m_filters{ std::move(filters) },
+        m_p_stepwise_context{}
+        {}
+
+
+        // functions
+
+        bool parse(reader& reader_) const
+        {
+            parsing_context context{ m_primitive_handler, m_structure_handler, m_filters, reader_ };
+            for (;;)
+            {
+                if (const auto status = context.parse_step(); status != parsing_status_type::in_progress)
+                {
+                    return status == parsing_status_type::succeeded;
+                }
+            }
+        }
+
+        void begin_stepwise_parsing(reader& reader_)
+        {
+            m_p_stepwise_context =
+                std::make_unique<parsing_context>(m_primitive_handler, m_structure_handler, m_filters, reader_);
+        }
+
+        parsing_status_type parse_step()
+        {
+            if (!m_p_stepwise_context)
+            {
+                throw std::logic_error{ "The stepwise parsing is not begun." };
+            }
+            return m_p_stepwise_context->parse_step();
+        }
+
+
+    private:
+        // variables
+
+        const json_grammar::primitive_handler_type m_primitive_handler;
+
+        const json_grammar::structure_handler_type m_structure_handler;
+
+        const std::vector<json_pointer> m_filters;
+
+        std::unique_ptr<parsing_context> m_p_stepwise_context;
+    };
+
+
+    hand_written_grammar::hand_written_grammar(
+        json_grammar::primitive_handler_type primitive_handler,
+        json_grammar::structure_handler_type structure_handler,
+        std::vector<json_pointer>            filters /*= std::vector<json_pointer>{}*/) :
+    m_p_impl{ std::make_unique<impl>(std::move(primitive_handler), std::move(structure_handler), std::move(filters)) }
+    {}
+
+    hand_written_grammar::~hand_written_grammar() = default;
+
+    bool hand_written_grammar::parse(reader& reader_) const
+    {
+        return m_p_impl->parse(reader_);
+    }
+
+    void hand_written_grammar::begin_stepwise_parsing(reader& reader_)
+    {
+        m_p_impl->begin_stepwise_parsing(reader_);
+    }
+
+    hand_written_grammar::parsing_status_type hand_written_grammar::parse_step()
+    {
+        return m_p_impl->parse_step();
+    }
+
+
+}
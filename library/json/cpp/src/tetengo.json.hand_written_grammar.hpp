@@ -0,0 +1,120 @@
+/*! \file
+    \brief A hand-written JSON grammar.
+
+    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
+*/
+
+#if !defined(TETENGO_JSON_HANDWRITTENGRAMMAR_HPP)
+#define TETENGO_JSON_HANDWRITTENGRAMMAR_HPP
+
+#include <memory>
+#include <vector>
+
+#include <boost/core/noncopyable.hpp>
+
+#include <tetengo/json/json_grammar.hpp>
+#include <tetengo/json/json_pointer.hpp>
+
+
+namespace tetengo::json
+{
+    class reader;
+
+
+    /*!
+        \brief A hand-written JSON grammar.
+
+        Parses a text with an explicit state machine and a character class table, instead of the Boost.Spirit rules.
+        For a well-formed text, it calls the handlers with the same arguments and at the same reader positions as the
+        Boost.Spirit one.
+
+        Since its state lives in the object instead of the call stack, the parsing can also be done step by step in the
+        caller's thread.
+    */
+    class hand_written_grammar : private boost::noncopyable
+    {
+    public:
+        // types
+
+        //! The parsing status type.
+        enum class parsing_status_type
+        {
+            in_progress, //!< In progress.
+            succeeded, //!< Succeeded.
+            failed, //!< Failed.
+        };
+
+
+        // constructors and destructor
+
+        /*!
+            \brief Creates a hand-written JSON grammar.
+
+            When filters are given, the handlers are called only for the values the filters refer to, in the document
+            order. A value is reported once even when filters refer to both it and its descendant, and the member
+            elements enclosing it are not reported. The other values are skipped by matching the brackets and the
+            quotation marks, and are not fully validated.
+
+            \param primitive_handler A primitive element handler.
+            \param structure_handler A structure element handler.
+            \param filters           Filters. When empty, all the elements are reported.
+        */
+        hand_written_grammar(
+            json_grammar::primitive_handler_type primitive_handler,
+            json_grammar::structure_handler_type structure_handler,
+            std::vector<json_pointer>            filters = std::vector<json_pointer>{});
+
+        /*!
+            \brief Destroys the hand-written JSON grammar.
+        */
+        ~hand_written_grammar();
+
+
+        // functions
+
+        /*!
+            \brief Parses a text.
+
+            \param reader_ A reader.
+
+            \retval true  When parsing is successful.
+            \retval false Otherwise.
+        */
+        [[nodiscard]] bool parse(reader& reader_) const;
+
+        /*!
+            \brief Begins a stepwise parsing.
+
+            \param reader_ A reader. It must outlive the stepwise parsing.
+        */
+        void begin_stepwise_parsing(reader& reader_);
+
+        /*!
+            \brief Parses one step.
+
+            A step consumes one token and calls the handlers zero or more times.
+            Once the parsing is finished, it just returns the final status.
+
+            \return The parsing status.
+
+            \throw std::logic_error When the stepwise parsing is not begun.
+        */
+        [[nodiscard]] parsing_status_type parse_step();
+
+
+    private:
+        // types
+
+        class impl;
+
+
+        // variables
+
+        const std::unique_ptr<impl> m_p_impl;
+    };
+
+
+}
+
+
+#endif
@@ -1,286 +1,464 @@
-/*! \file
-    \brief A JSON parser.
-
-    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
-*/
-
-#include <cassert>
-#include <cstddef>
-#include <exception>
-#include <functional>
-#include <iterator>
-#include <memory>
-#include <mutex>
-#include <stdexcept>
-#include <string>
-#include <string_view>
-#include <thread>
-#include <unordered_map>
-#include <utility>
-
-#include <boost/core/noncopyable.hpp>
-
-#include <tetengo/json/channel.hpp>
-#include <tetengo/json/comment_removing_reader.hpp>
-#include <tetengo/json/element.hpp>
-#include <tetengo/json/json_grammar.hpp>
-#include <tetengo/json/json_parser.hpp>
-#include <tetengo/json/line_counting_reader.hpp>
-#include <tetengo/json/reader.hpp>
-
-
-namespace tetengo::json
-{
-    class json_parser::impl : private boost::noncopyable
-    {
-    public:
-        // static functions
-
-        static constexpr std::size_t default_buffer_capacity()
-        {
-            return 100;
-        }
-
-
-        // constructors and destructor
-
-        impl(std::unique_ptr<reader>&& p_reader, const std::size_t buffer_capacity) :
-        m_p_reader{ build_decorated_reader(std::move(p_reader)) },
-        m_p_worker{},
-        m_channel{ buffer_capacity },
-        m_parsing_abortion_requested{ false },
-        m_mutex{}
-        {
-            if (!m_p_reader)
-            {
-                throw std::invalid_argument{ "p_reader is nullptr." };
-            }
-            m_p_worker = std::make_unique<std::thread>(&impl::worker_procedure, this);
-        }
-
-        ~impl()
-        {
-            try
-            {
-                request_parsing_abortion();
-                while (!m_channel.closed())
-                {
-                    m_channel.take();
-                }
-                if (m_p_worker && m_p_worker->joinable())
-                {
-                    m_p_worker->join();
-                }
-            }
-            catch (...)
-            {}
-        }
-
-
-        // functions
-
-        bool has_next() const
-        {
-            return !m_channel.closed();
-        }
-
-        const element& peek() const
-        {
-            if (!has_next())
-            {
-                throw std::logic_error{ "No more element." };
-            }
-            return m_channel.peek();
-        }
-
-        void next()
-        {
-            if (!has_next())
-            {
-                throw std::logic_error{ "No more element." };
-            }
-            m_channel.take();
-        }
-
-
-    private:
-        // static functions
-
-        static std::unique_ptr<reader> build_decorated_reader(std::unique_ptr<reader>&& p_base_reader)
-        {
-            auto p_line_counting = std::make_unique<line_counting_reader>(std::move(p_base_reader));
-            auto p_comment_removing = std::make_unique<comment_removing_reader>(std::move(p_line_counting), "#");
-            return p_comment_removing;
-        }
-
-        static const line_counting_reader& as_line_counting(const reader& reader_)
-        {
-            assert(dynamic_cast<const line_counting_reader*>(&reader_.base_reader()));
-            return dynamic_cast<const line_counting_reader&>(reader_.base_reader());
-        }
-
-        static element::type_type to_element_type(const json_grammar::primitive_type_type primitive_type)
-        {
-            switch (primitive_type)
-            {
-            case json_grammar::primitive_type_type::string:
-                return { element::type_name_type::string, element::type_category_type::primitive };
-            case json_grammar::primitive_type_type::number:
-                return { element::type_name_type::number, element::type_category_type::primitive };
-            case json_grammar::primitive_type_type::boolean:
-                return { element::type_name_type::boolean, element::type_category_type::primitive };
-            default:
-                assert(primitive_type == json_grammar::primitive_type_type::null);
-                return { element::type_name_type::null, element::type_category_type::primitive };
-            }
-        }
-
-        static element::type_type to_element_type(
-            const json_grammar::structure_type_type       structure_type,
-            const json_grammar::structure_open_close_type structure_open_close)
-        {
-            switch (const element::type_category_type element_category =
-                        structure_open_close == json_grammar::structure_open_close_type::open ?
-                            element::type_category_type::structure_open :
-                            element::type_category_type::structure_close;
-                    structure_type)
-            {
-            case json_grammar::structure_type_type::object:
-                return { element::type_name_type::object, element_category };
-            case json_grammar::structure_type_type::member:
-                return { element::type_name_type::member, element_category };
-            default:
-                assert(structure_type == json_grammar::structure_type_type::array);
-                return { element::type_name_type::array, element_category };
-            }
-        }
-
-        static std::unordered_map<std::string, std::string>
-        to_element_attributes(const std::unordered_map<std::string_view, std::string_view>& structure_attributes)
-        {
-            std::unordered_map<std::string, std::string> element_attributes{};
-            element_attributes.reserve(std::size(structure_attributes));
-            for (const auto& i: structure_attributes)
-            {
-                element_attributes.insert(i);
-            }
-            return element_attributes;
-        }
-
-
-        // variables
-
-        const std::unique_ptr<reader> m_p_reader;
-
-        std::unique_ptr<std::thread> m_p_worker;
-
-        channel m_channel;
-
-        bool m_parsing_abortion_requested;
-
-        mutable std::mutex m_mutex;
-
-
-        // functions
-
-        void worker_procedure()
-        {
-            try
-            {
-                const json_grammar grammar_{
-                    std::bind(&impl::on_primitive, this, std::placeholders::_1, std::placeholders::_2),
-                    std::bind(
-                        &impl::on_structure, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3)
-                };
-
-                const auto successful = grammar_.parse(*m_p_reader);
-                if (!successful)
-                {
-                    m_channel.insert(std::make_exception_ptr(std::runtime_error{ "JSON syntax error." }));
-                }
-                m_channel.close();
-            }
-            catch (...)
-            {
-                m_channel.insert(std::current_exception());
-                m_channel.close();
-            }
-        }
-
-        bool on_primitive(const json_grammar::primitive_type_type type, const std::string_view& value)
-        {
-            if (parsing_abortion_requested())
-            {
-                return false;
-            }
-
-            element element_{ to_element_type(type),
-                              std::string{ value },
-                              std::unordered_map<std::string, std::string>{},
-                              as_line_counting(*m_p_reader).get_location() };
-            m_channel.insert(std::move(element_));
-            return true;
-        }
-
-        bool on_structure(
-            const json_grammar::structure_type_type                       type,
-            const json_grammar::structure_open_close_type                 open_close,
-            const std::unordered_map<std::string_view, std::string_view>& attributes)
-        {
-            if (parsing_abortion_requested())
-            {
-                return false;
-            }
-
-            element element_{ to_element_type(type, open_close),
-                              std::string{},
-                              to_element_attributes(attributes),
-                              as_line_counting(*m_p_reader).get_location() };
-            m_channel.insert(std::move(element_));
-            return true;
-        }
-
-        bool parsing_abortion_requested() const
-        {
-            const std::unique_lock<std::mutex> lock{ m_mutex };
-            return m_parsing_abortion_requested;
-        }
-
-        void request_parsing_abortion()
-        {
-            const std::unique_lock<std::mutex> lock{ m_mutex };
-            m_parsing_abortion_requested = true;
-        }
-    };
-
-
-    std::size_t json_parser::default_buffer_capacity()
-    {
-        return impl::default_buffer_capacity();
-    }
-
-    json_parser::json_parser(
-        std::unique_ptr<reader>&& p_reader,
-        const std::size_t         buffer_capacity /*= default_buffer_capacity()*/) :
-    m_p_impl{ std::make_unique<impl>(std::move(p_reader), buffer_capacity) }
-    {}
-
-    json_parser::~json_parser() = default;
-
-    bool json_parser::has_next() const
-    {
-        return m_p_impl->has_next();
-    }
-
-    const element& json_parser::peek() const
-    {
-        return m_p_impl->peek();
-    }
-
-    void json_parser::next()
-    {
-        m_p_impl->next();
-    }
-
-
-}
+/*! \file
+    \brief A JSON parser.
+
+    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
+*/
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <boost/core/noncopyable.hpp>
+
+#include <tetengo/json/channel.hpp>
+#include <tetengo/json/comment_removing_reader.hpp>
+#include <tetengo/json/element.hpp>
+#include <tetengo/json/element_view.hpp>
+#include <tetengo/json/file_location.hpp>
+#include <tetengo/json/json_grammar.hpp>
+#include <tetengo/json/json_parser.hpp>
+#include <tetengo/json/json_pointer.hpp>
+#include <tetengo/json/line_counting_reader.hpp>
+#include <tetengo/json/reader.hpp>
+
+#include "tetengo.json.element_type_converter.hpp"
+#include "tetengo.json.hand_written_grammar.hpp"
+
+
+namespace tetengo::json
+{
+    class json_parser::impl : private boost::noncopyable
+    {
+    public:
+        // static functions
+
+        static constexpr std::size_t default_buffer_capacity()
+        {
+            return 100;
+        }
+
+
+        // constructors and destructor
+
+        impl(
+            std::unique_ptr<reader>&&        p_reader,
+            const std::size_t                buffer_capacity,
+            const json_grammar::backend_type grammar_backend,
+            const parsing_mode_type          parsing_mode,
+            std::vector<json_pointer>&&      filters) :
+        m_p_reader{ build_decorated_reader(std::move(p_reader)) },
+        m_grammar_backend{ grammar_backend },
+        m_filters{ std::move(filters) },
+        m_p_worker{},
+        m_channel{ buffer_capacity, channel_batch_size(buffer_capacity) },
+        m_parsing_abortion_requested{ false },
+        m_mutex{},
+        m_p_synchronous_grammar{},
+        m_synchronous_slots{},
+        m_synchronous_slot_count{ 0 },
+        m_synchronous_position{ 0 },
+        m_o_synchronous_element{},
+        m_synchronous_parsing_finished{ false }
+        {
+            if (!m_p_reader)
+            {
+                throw std::invalid_argument{ "p_reader is nullptr." };
+            }
+            if (!std::empty(m_filters) && m_grammar_backend != json_grammar::backend_type::hand_written)
+            {
+                throw std::invalid_argument{ "The filters require the hand-written grammar backend." };
+            }
+            if (parsing_mode == parsing_mode_type::synchronous)
+            {
+                if (m_grammar_backend != json_grammar::backend_type::hand_written)
+                {
+                    throw std::invalid_argument{
+                        "The synchronous mode requires the hand-written grammar backend."
+                    };
+                }
+                m_p_synchronous_grammar = std::make_unique<hand_written_grammar>(
+                    std::bind(&impl::on_primitive, this, std::placeholders::_1, std::placeholders::_2),
+                    std::bind(
+                        &impl::on_structure,
+                        this,
+                        std::placeholders::_1,
+                        std::placeholders::_2,
+                        std::placeholders::_3),
+                    m_filters);
+                m_p_synchronous_grammar->begin_stepwise_parsing(*m_p_reader);
+            }
+            else
+            {
+                m_p_worker = std::make_unique<std::thread>(&impl::worker_procedure, this);
+            }
+        }
+
+        ~impl()
+        {
+            if (m_p_synchronous_grammar)
+            {
+                return;
+            }
+            try
+            {
+                request_parsing_abortion();
+                while (!m_channel.closed())
+                {
+                    m_channel.take();
+                }
+                if (m_p_worker && m_p_worker->joinable())
+                {
+                    m_p_worker->join();
+                }
+            }
+            catch (...)
+            {}
+        }
+
+
+        // functions
+
+        bool has_next() const
+        {
+            if (m_p_synchronous_grammar)
+            {
+                ensure_synchronous_slots_filled();
+                return m_synchronous_position < m_synchronous_slot_count;
+            }
+            return !m_channel.closed();
+        }
+
+        const element& peek() const
+        {
+            if (!has_next())
+            {
+                throw std::logic_error{ "No more element." };
+            }
+            if (m_p_synchronous_grammar)
+            {
+                if (!m_o_synchronous_element)
+                {
+                    m_o_synchronous_element.emplace(synchronous_element_view().to_element());
+                }
+                return *m_o_synchronous_element;
+            }
+            return m_channel.peek();
+        }
+
+        element_view peek_view() const
+        {
+            if (!has_next())
+            {
+                throw std::logic_error{ "No more element." };
+            }
+            if (m_p_synchronous_grammar)
+            {
+                return synchronous_element_view();
+            }
+            return m_channel.peek_view();
+        }
+
+        void next()
+        {
+            if (!has_next())
+            {
+                throw std::logic_error{ "No more element." };
+            }
+            if (m_p_synchronous_grammar)
+            {
+                m_o_synchronous_element.reset();
+                ++m_synchronous_position;
+                return;
+            }
+            m_channel.take();
+        }
+
+
+    private:
+        // types
+
+        struct synchronous_slot
+        {
+            element::type_type type;
+
+            std::string value;
+
+            std::string name;
+
+            std::optional<file_location> o_file_location;
+
+            std::exception_ptr p_exception;
+        };
+
+
+        // static functions
+
+        static std::size_t channel_batch_size(const std::size_t buffer_capacity)
+        {
+            // The worker thread fills a quarter of the channel while the caller's thread takes the elements from the
+            // other batches.
+            return std::max(buffer_capacity / 4, static_cast<std::size_t>(1));
+        }
+
+        static std::unique_ptr<reader> build_decorated_reader(std::unique_ptr<reader>&& p_base_reader)
+        {
+            auto p_line_counting = std::make_unique<line_counting_reader>(std::move(p_base_reader));
+            auto p_comment_removing = std::make_unique<comment_removing_reader>(std::move(p_line_counting), "#");
+            return p_comment_removing;
+        }
+
+        static const line_counting_reader& as_line_counting(const reader& reader_)
+        {
+            assert(dynamic_cast<const line_counting_reader*>(&reader_.base_reader()));
+            return dynamic_cast<const line_counting_reader&>(reader_.base_reader());
+        }
+
+        // variables
+
+        const std::unique_ptr<reader> m_p_reader;
+
+        const json_grammar::backend_type m_grammar_backend;
+
+        const std::vector<json_pointer> m_filters;
+
+        std::unique_ptr<std::thread> m_p_worker;
+
+        channel m_channel;
+
+        bool m_parsing_abortion_requested;
+
+        mutable std::mutex m_mutex;
+
+        std::unique_ptr<hand_written_grammar> m_p_synchronous_grammar;
+
+        mutable std::vector<synchronous_slot> m_synchronous_slots;
+
+        mutable std::size_t m_synchronous_slot_count;
+
+        mutable std::size_t m_synchronous_position;
+
+        mutable std::optional<element> m_o_synchronous_element;
+
+        mutable bool m_synchronous_parsing_finished;
+
+
+        // functions
+
+        void worker_procedure()
+        {
+            try
+            {
+                const auto successful = parse_in_worker();
+                if (!successful)
+                {
+                    m_channel.insert(std::make_exception_ptr(std::runtime_error{ "JSON syntax error." }));
+                }
+                m_channel.close();
+            }
+            catch (...)
+            {
+                m_channel.insert(std::current_exception());
+                m_channel.close();
+            }
+        }
+
+        bool parse_in_worker()
+        {
+            if (!std::empty(m_filters))
+            {
+                const hand_written_grammar grammar_{
+                    std::bind(&impl::on_primitive, this, std::placeholders::_1, std::placeholders::_2),
+                    std::bind(
+                        &impl::on_structure, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
+                    m_filters
+                };
+                return grammar_.parse(*m_p_reader);
+            }
+
+            const json_grammar grammar_{
+                std::bind(&impl::on_primitive, this, std::placeholders::_1, std::placeholders::_2),
+                std::bind(
+                    &impl::on_structure, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
+                m_grammar_backend
+            };
+            return grammar_.parse(*m_p_reader);
+        }
+
+        void ensure_synchronous_slots_filled() const
+        {
+            if (m_synchronous_position < m_synchronous_slot_count)
+            {
+                return;
+            }
+            m_synchronous_slot_count = 0;
+            m_synchronous_position = 0;
+            while (m_synchronous_slot_count == 0 && !m_synchronous_parsing_finished)
+            {
+                try
+                {
+                    const auto status = m_p_synchronous_grammar->parse_step();
+                    if (status == hand_written_grammar::parsing_status_type::failed)
+                    {
+                        next_synchronous_slot().p_exception =
+                            std::make_exception_ptr(std::runtime_error{ "JSON syntax error." });
+                    }
+                    m_synchronous_parsing_finished = status != hand_written_grammar::parsing_status_type::in_progress;
+                }
+                catch (...)
+                {
+                    next_synchronous_slot().p_exception = std::current_exception();
+                    m_synchronous_parsing_finished = true;
+                }
+            }
+        }
+
+        synchronous_slot& next_synchronous_slot() const
+        {
+            if (m_synchronous_slot_count == std::size(m_synchronous_slots))
+            {
+                m_synchronous_slots.emplace_back();
+            }
+            auto& slot = m_synchronous_slots[m_synchronous_slot_count++];
+            slot.p_exception = nullptr;
+            return slot;
+        }
+
+        const synchronous_slot& front_synchronous_slot() const
+        {
+            // As the channel does in the worker thread mode, an exception in the front slot is thrown only when the
+            // slot is peeked, and next() moves beyond it.
+            const auto& slot = m_synchronous_slots[m_synchronous_position];
+            if (slot.p_exception)
+            {
+                std::rethrow_exception(slot.p_exception);
+            }
+            return slot;
+        }
+
+        element_view synchronous_element_view() const
+        {
+            const auto& slot = front_synchronous_slot();
+            assert(slot.o_file_location);
+            return element_view{ slot.type, slot.value, slot.name, *slot.o_file_location };
+        }
+
+        void emit(const element::type_type& type, const std::string_view& value, const std::string_view& name)
+        {
+            const auto& location = as_line_counting(*m_p_reader).get_location();
+            if (m_p_synchronous_grammar)
+            {
+                auto& slot = next_synchronous_slot();
+                slot.type = type;
+                slot.value.assign(value);
+                slot.name.assign(name);
+                if (slot.o_file_location)
+                {
+                    *slot.o_file_location = location;
+                }
+                else
+                {
+                    slot.o_file_location.emplace(location);
+                }
+            }
+            else
+            {
+                m_channel.insert(element_view{ type, value, name, location });
+            }
+        }
+
+        bool on_primitive(const json_grammar::primitive_type_type type, const std::string_view& value)
+        {
+            if (parsing_abortion_requested())
+            {
+                return false;
+            }
+
+            emit(element_type_converter::to_element_type(type), value, std::string_view{});
+            return true;
+        }
+
+        bool on_structure(
+            const json_grammar::structure_type_type                       type,
+            const json_grammar::structure_open_close_type                 open_close,
+            const std::unordered_map<std::string_view, std::string_view>& attributes)
+        {
+            if (parsing_abortion_requested())
+            {
+                return false;
+            }
+
+            const auto name_found = attributes.find("name");
+            emit(
+                element_type_converter::to_element_type(type, open_close),
+                std::string_view{},
+                name_found != std::end(attributes) ? name_found->second : std::string_view{});
+            return true;
+        }
+
+        bool parsing_abortion_requested() const
+        {
+            const std::unique_lock<std::mutex> lock{ m_mutex };
+            return m_parsing_abortion_requested;
+        }
+
+        void request_parsing_abortion()
+        {
+            const std::unique_lock<std::mutex> lock{ m_mutex };
+            m_parsing_abortion_requested = true;
+        }
+    };
+
+
+    std::size_t json_parser::default_buffer_capacity()
+    {
+        return impl::default_buffer_capacity();
+    }
+
+    json_parser::json_parser(
+        std::unique_ptr<reader>&&        p_reader,
+        const std::size_t                buffer_capacity /*= default_buffer_capacity()*/,
+        const json_grammar::backend_type grammar_backend /*= json_grammar::backend_type::spirit*/,
+        const parsing_mode_type          parsing_mode /*= parsing_mode_type::worker_thread*/,
+        std::vector<json_pointer>        filters /*= std::vector<json_pointer>{}*/) :
+    m_p_impl{
+        std::make_unique<impl>(std::move(p_reader), buffer_capacity, grammar_backend, parsing_mode, std::move(filters))
+    }
+    {}
+
+    json_parser::~json_parser() = default;
+
+    bool json_parser::has_next() const
+    {
+        return m_p_impl->has_next();
+    }
+
+    const element& json_parser::peek() const
+    {
+        return m_p_impl->peek();
+    }
+
+    element_view json_parser::peek_view() const
+    {
+        return m_p_impl->peek_view();
+    }
+
+    void json_parser::next()
+    {
+        m_p_impl->next();
+    }
+
+
+}
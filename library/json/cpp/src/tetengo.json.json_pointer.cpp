@@ -0,0 +1,85 @@
+/*! \file
+    \brief A JSON pointer.
+
+    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
+*/
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <tetengo/json/json_pointer.hpp>
+
+
+namespace tetengo::json
+{
+    namespace
+    {
+        std::string unescape_reference_token(const std::string_view& escaped)
+        {
+            std::string token{};
+            token.reserve(escaped.length());
+            for (auto i = static_cast<std::size_t>(0); i < escaped.length(); ++i)
+            {
+                if (escaped[i] != '~')
+                {
+                    token.push_back(escaped[i]);
+                    continue;
+                }
+                if (i + 1 >= escaped.length() || (escaped[i + 1] != '0' && escaped[i + 1] != '1'))
+                {
+                    throw std::invalid_argument{ "Invalid escape sequence in the JSON pointer." };
+                }
+                token.push_back(escaped[i + 1] == '0' ? '~' : '/');
+                ++i;
+            }
+            return token;
+        }
+
+        std::vector<std::string> parse(const std::string_view& pointer)
+        {
+            if (std::empty(pointer))
+            {
+                return std::vector<std::string>{};
+            }
+            if (pointer[0] != '/')
+            {
+                throw std::invalid_argument{ "The JSON pointer does not start with '/'." };
+            }
+
+            std::vector<std::string> tokens{};
+            auto                     offset = static_cast<std::size_t>(1);
+            for (;;)
+            {
+                const auto slash_position = pointer.find('/', offset);
+                tokens.push_back(unescape_reference_token(pointer.substr(offset, slash_position - offset)));
+                if (slash_position == std::string_view::npos)
+                {
+                    break;
+                }
+                offset = slash_position + 1;
+            }
+            return tokens;
+        }
+
+
+    }
+
+
+    const std::string& json_pointer::wildcard()
+    {
+        static const std::string singleton{ "*" };
+        return singleton;
+    }
+
+    json_pointer::json_pointer(const std::string_view pointer) : m_reference_tokens{ parse(pointer) } {}
+
+    const std::vector<std::string>& json_pointer::reference_tokens() const
+    {
+        return m_reference_tokens;
+    }
+
+
+}
@@ -0,0 +1,168 @@
+/*! \file
+    \brief A memory-mapped file reader.
+
+    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
+*/
+
+#include <cstddef>
+#include <filesystem>
+#include <ios>
+#include <memory>
+#include <stdexcept>
+#include <string_view>
+
+#include <boost/core/noncopyable.hpp>
+#include <boost/interprocess/exceptions.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include <tetengo/json/mmap_reader.hpp>
+
+
+namespace tetengo::json
+{
+    class reader;
+
+
+    class mmap_reader::impl : private boost::noncopyable
+    {
+    public:
+        // constructors and destructor
+
+        explicit impl(const std::filesystem::path& path) :
+        m_file_mapping{},
+        m_region{},
+        m_content{},
+        m_position{ 0 }
+        {
+            try
+            {
+                if (std::filesystem::file_size(path) == 0)
+                {
+                    return;
+                }
+                m_file_mapping = boost::interprocess::file_mapping{ path.c_str(), boost::interprocess::read_only };
+                m_region = boost::interprocess::mapped_region{ m_file_mapping, boost::interprocess::read_only };
+                m_region.advise(boost::interprocess::mapped_region::advice_sequential);
+                m_content = std::string_view{ static_cast<const char*>(m_region.get_address()), m_region.get_size() };
+            }
+            catch (const std::filesystem::filesystem_error& e)
+            {
+                throw std::ios_base::failure{ e.what() };
+            }
+            catch (const boost::interprocess::interprocess_exception& e)
+            {
+                throw std::ios_base::failure{ e.what() };
+            }
+        }
+
+
+        // functions
+
+        std::string_view content() const
+        {
+            return m_content;
+        }
+
+        bool has_next_impl() const
+        {
+            return m_position < m_content.length();
+        }
+
+        char peek_impl() const
+        {
+            if (m_position == m_content.length())
+            {
+                throw std::logic_error{ "The current position is beyond the termination point." };
+            }
+            return m_content[m_position];
+        }
+
+        void next_impl()
+        {
+            if (m_position == m_content.length())
+            {
+                throw std::logic_error{ "The current position is beyond the termination point." };
+            }
+            ++m_position;
+        }
+
+        std::string_view peek_chunk_impl() const
+        {
+            return m_content.substr(m_position);
+        }
+
+        void consume_impl(const std::size_t length)
+        {
+            if (length > m_content.length() - m_position)
+            {
+                throw std::logic_error{ "The length is greater than the length of the current chunk." };
+            }
+            m_position += length;
+        }
+
+        const reader& base_reader_impl() const
+        {
+            throw std::logic_error{ "No base reader." };
+        }
+
+
+    private:
+        // variables
+
+        boost::interprocess::file_mapping m_file_mapping;
+
+        boost::interprocess::mapped_region m_region;
+
+        std::string_view m_content;
+
+        std::size_t m_position;
+    };
+
+
+    mmap_reader::mmap_reader(const std::filesystem::path& path) : m_p_impl{ std::make_unique<impl>(path) } {}
+
+    mmap_reader::~mmap_reader() = default;
+
+    std::string_view mmap_reader::content() const
+    {
+        return m_p_impl->content();
+    }
+
+    bool mmap_reader::has_next_impl() const
+    {
+        return m_p_impl->has_next_impl();
+    }
+
+    char mmap_reader::peek_impl() const
+    {
+        return m_p_impl->peek_impl();
+    }
+
+    void mmap_reader::next_impl()
+    {
+        m_p_impl->next_impl();
+    }
+
+    std::string_view mmap_reader::peek_chunk_impl() const
+    {
+        return m_p_impl->peek_chunk_impl();
+    }
+
+    void mmap_reader::consume_impl(const std::size_t length)
+    {
+        m_p_impl->consume_impl(length);
+    }
+
+    bool mmap_reader::chunks_persistent_impl() const
+    {
+        return true;
+    }
+
+    const reader& mmap_reader::base_reader_impl() const
+    {
+        return m_p_impl->base_reader_impl();
+    }
+
+
+}
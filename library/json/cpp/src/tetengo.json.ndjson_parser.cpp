@@ -0,0 +1,585 @@
+/*! \file
+    \brief An NDJSON parser.
+
+    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
+*/
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <boost/core/noncopyable.hpp>
+
+#include <tetengo/json/channel.hpp>
+#include <tetengo/json/element.hpp>
+#include <tetengo/json/element_view.hpp>
+#include <tetengo/json/file_location.hpp>
+#include <tetengo/json/json_grammar.hpp>
+#include <tetengo/json/json_parser.hpp>
+#include <tetengo/json/ndjson_parser.hpp>
+#include <tetengo/json/reader.hpp>
+
+#include "tetengo.json.element_type_converter.hpp"
+#include "tetengo.json.hand_written_grammar.hpp"
+
+
+namespace tetengo::json
+{
+    namespace
+    {
+        class line_reader : public reader
+        {
+        public:
+            // constructors and destructor
+
+            line_reader() : m_line{}, m_position{ 0 } {}
+
+            virtual ~line_reader() = default;
+
+
+            // functions
+
+            const std::string_view& line() const
+            {
+                return m_line;
+            }
+
+            void reset(const std::string_view& line)
+            {
+                m_line = line;
+                m_position = 0;
+            }
+
+
+        private:
+            // variables
+
+            std::string_view m_line;
+
+            std::size_t m_position;
+
+
+            // virtual functions
+
+            virtual bool has_next_impl() const override
+            {
+                return m_position < m_line.length();
+            }
+
+            virtual char peek_impl() const override
+            {
+                if (m_position == m_line.length())
+                {
+                    throw std::logic_error{ "No more element." };
+                }
+                return m_line[m_position];
+            }
+
+            virtual void next_impl() override
+            {
+                if (m_position == m_line.length())
+                {
+                    throw std::logic_error{ "No more element." };
+                }
+                ++m_position;
+            }
+
+            virtual std::string_view peek_chunk_impl() const override
+            {
+                return m_line.substr(m_position);
+            }
+
+            virtual void consume_impl(const std::size_t length) override
+            {
+                if (length > m_line.length() - m_position)
+                {
+                    throw std::logic_error{ "The length is greater than the length of the current chunk." };
+                }
+                m_position += length;
+            }
+
+            virtual const reader& base_reader_impl() const override
+            {
+                throw std::logic_error{ "No base reader." };
+            }
+        };
+
+        class line_parser : private boost::noncopyable
+        {
+        public:
+            // constructors and destructor
+
+            line_parser() :
+            m_reader{},
+            m_line_index{ 0 },
+            m_p_elements{ nullptr },
+            m_grammar{ std::bind(&line_parser::on_primitive, this, std::placeholders::_1, std::placeholders::_2),
+                       std::bind(
+                           &line_parser::on_structure,
+                           this,
+                           std::placeholders::_1,
+                           std::placeholders::_2,
+                           std::placeholders::_3) }
+            {}
+
+
+            // functions
+
+            void parse(const std::string_view& line, const std::size_t line_index, std::vector<element>& elements)
+            {
+                m_reader.reset(line);
+                m_line_index = line_index;
+                m_p_elements = &elements;
+                if (!m_grammar.parse(m_reader))
+                {
+                    throw std::runtime_error{ "JSON syntax error." };
+                }
+            }
+
+
+        private:
+            // variables
+
+            line_reader m_reader;
+
+            std::size_t m_line_index;
+
+            std::vector<element>* m_p_elements;
+
+            const hand_written_grammar m_grammar;
+
+
+            // functions
+
+            void emit(const element::type_type& type, const std::string_view& value, const std::string_view& name)
+            {
+                // Like json_parser, whose decorated reader has read the whole line when an element is reported.
+                const file_location location{ std::string{ m_reader.line() }, m_line_index, m_reader.line().length() };
+                m_p_elements->push_back(element_view{ type, value, name, location }.to_element());
+            }
+
+            bool on_primitive(const json_grammar::primitive_type_type type, const std::string_view& value)
+            {
+                emit(element_type_converter::to_element_type(type), value, std::string_view{});
+                return true;
+            }
+
+            bool on_structure(
+                const json_grammar::structure_type_type                       type,
+                const json_grammar::structure_open_close_type                 open_close,
+                const std::unordered_map<std::string_view, std::string_view>& attributes)
+            {
+                const auto name_found = attributes.find("name");
+                emit(
+                    element_type_converter::to_element_type(type, open_close),
+                    std::string_view{},
+                    name_found != std::end(attributes) ? name_found->second : std::string_view{});
+                return true;
+            }
+        };
+
+
+    }
+
+
+    class ndjson_parser::impl : private boost::noncopyable
+    {
+    public:
+        // static functions
+
+        static std::size_t default_thread_count()
+        {
+            return std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+        }
+
+
+        // constructors and destructor
+
+        impl(std::unique_ptr<reader>&& p_reader, const std::size_t thread_count, const std::size_t buffer_capacity) :
+        m_p_reader{ std::move(p_reader) },
+        m_channel{ buffer_capacity },
+        m_mutex{},
+        m_condition_variable{},
+        m_batches{},
+        m_results{},
+        m_batch_count{ 0 },
+        m_emitted_batch_count{ 0 },
+        m_reading_finished{ false },
+        m_parsing_abortion_requested{ false },
+        m_threads{}
+        {
+            if (!m_p_reader)
+            {
+                throw std::invalid_argument{ "p_reader is nullptr." };
+            }
+            if (thread_count == 0)
+            {
+                throw std::invalid_argument{ "thread_count is 0." };
+            }
+
+            m_results.resize(thread_count * 2);
+            m_threads.reserve(thread_count + 2);
+            try
+            {
+                m_threads.emplace_back(&impl::reader_procedure, this);
+                for (auto i = static_cast<std::size_t>(0); i < thread_count; ++i)
+                {
+                    m_threads.emplace_back(&impl::worker_procedure, this);
+                }
+                m_threads.emplace_back(&impl::emitter_procedure, this);
+            }
+            catch (...)
+            {
+                request_parsing_abortion();
+                join_threads();
+                throw;
+            }
+        }
+
+        ~impl()
+        {
+            try
+            {
+                request_parsing_abortion();
+                while (!m_channel.closed())
+                {
+                    m_channel.take();
+                }
+                join_threads();
+            }
+            catch (...)
+            {}
+        }
+
+
+        // functions
+
+        bool has_next() const
+        {
+            return !m_channel.closed();
+        }
+
+        const element& peek() const
+        {
+            if (!has_next())
+            {
+                throw std::logic_error{ "No more element." };
+            }
+            return m_channel.peek();
+        }
+
+        void next()
+        {
+            if (!has_next())
+            {
+                throw std::logic_error{ "No more element." };
+            }
+            m_channel.take();
+        }
+
+
+    private:
+        // types
+
+        struct batch_type
+        {
+            std::size_t sequence;
+
+            std::size_t first_line_index;
+
+            std::string text;
+        };
+
+        struct result_type
+        {
+            std::vector<element> elements;
+
+            std::exception_ptr p_exception;
+        };
+
+
+        // static functions
+
+        static constexpr std::size_t batch_size()
+        {
+            return 64 * 1024;
+        }
+
+        static bool is_blank(const std::string_view& line)
+        {
+            return line.find_first_not_of(" \t\r\n") == std::string_view::npos;
+        }
+
+        static result_type parse_batch(const batch_type& batch, line_parser& parser)
+        {
+            result_type result{};
+            try
+            {
+                const std::string_view text{ batch.text };
+                auto                   line_index = batch.first_line_index;
+                auto                   offset = static_cast<std::size_t>(0);
+                while (offset < text.length())
+                {
+                    const auto newline_position = text.find('\n', offset);
+                    const auto next_offset = newline_position == std::string_view::npos ? text.length() :
+                                                                                          newline_position + 1;
+                    const auto line = text.substr(offset, next_offset - offset);
+                    if (!is_blank(line))
+                    {
+                        parser.parse(line, line_index, result.elements);
+                    }
+                    offset = next_offset;
+                    ++line_index;
+                }
+            }
+            catch (...)
+            {
+                result.p_exception = std::current_exception();
+            }
+            return result;
+        }
+
+        // variables
+
+        const std::unique_ptr<reader> m_p_reader;
+
+        channel m_channel;
+
+        mutable std::mutex m_mutex;
+
+        std::condition_variable m_condition_variable;
+
+        std::deque<batch_type> m_batches;
+
+        std::vector<std::optional<result_type>> m_results;
+
+        std::size_t m_batch_count;
+
+        std::size_t m_emitted_batch_count;
+
+        bool m_reading_finished;
+
+        bool m_parsing_abortion_requested;
+
+        std::vector<std::thread> m_threads;
+
+
+        // functions
+
+        void reader_procedure()
+        {
+            auto first_line_index = static_cast<std::size_t>(0);
+            for (;;)
+            {
+                std::string        text{};
+                std::exception_ptr p_exception{};
+                try
+                {
+                    text = read_batch_text();
+                }
+                catch (...)
+                {
+                    p_exception = std::current_exception();
+                }
+                if (std::empty(text) && !p_exception)
+                {
+                    break;
+                }
+
+                std::unique_lock<std::mutex> lock{ m_mutex };
+                m_condition_variable.wait(lock, [this]() {
+                    return m_parsing_abortion_requested ||
+                           m_batch_count - m_emitted_batch_count < std::size(m_results);
+                });
+                if (m_parsing_abortion_requested)
+                {
+                    break;
+                }
+                if (p_exception)
+                {
+                    m_results[m_batch_count % std::size(m_results)].emplace(
+                        result_type{ std::vector<element>{}, std::move(p_exception) });
+                    ++m_batch_count;
+                    break;
+                }
+                const auto line_count = static_cast<std::size_t>(std::count(std::begin(text), std::end(text), '\n'));
+                m_batches.push_back({ m_batch_count, first_line_index, std::move(text) });
+                ++m_batch_count;
+                first_line_index += line_count;
+                lock.unlock();
+                m_condition_variable.notify_all();
+            }
+
+            {
+                const std::unique_lock<std::mutex> lock{ m_mutex };
+                m_reading_finished = true;
+            }
+            m_condition_variable.notify_all();
+        }
+
+        std::string read_batch_text()
+        {
+            std::string text{};
+            for (;;)
+            {
+                const auto chunk = m_p_reader->peek_chunk();
+                if (std::empty(chunk))
+                {
+                    return text;
+                }
+                const auto newline_position =
+                    std::size(text) + chunk.length() < batch_size() ? std::string_view::npos : chunk.find('\n');
+                const auto length = newline_position == std::string_view::npos ? chunk.length() : newline_position + 1;
+                text.append(chunk.substr(0, length));
+                m_p_reader->consume(length);
+                if (newline_position != std::string_view::npos)
+                {
+                    return text;
+                }
+            }
+        }
+
+        void worker_procedure()
+        {
+            line_parser parser{};
+            for (;;)
+            {
+                batch_type batch{};
+                {
+                    std::unique_lock<std::mutex> lock{ m_mutex };
+                    m_condition_variable.wait(lock, [this]() {
+                        return m_parsing_abortion_requested || !std::empty(m_batches) || m_reading_finished;
+                    });
+                    if (m_parsing_abortion_requested || std::empty(m_batches))
+                    {
+                        return;
+                    }
+                    batch = std::move(m_batches.front());
+                    m_batches.pop_front();
+                }
+
+                auto result = parse_batch(batch, parser);
+
+                {
+                    const std::unique_lock<std::mutex> lock{ m_mutex };
+                    m_results[batch.sequence % std::size(m_results)].emplace(std::move(result));
+                }
+                m_condition_variable.notify_all();
+            }
+        }
+
+        void emitter_procedure()
+        {
+            try
+            {
+                for (;;)
+                {
+                    result_type result{};
+                    {
+                        std::unique_lock<std::mutex> lock{ m_mutex };
+                        auto& o_result = m_results[m_emitted_batch_count % std::size(m_results)];
+                        m_condition_variable.wait(lock, [this, &o_result]() {
+                            return m_parsing_abortion_requested || o_result ||
+                                   (m_reading_finished && m_emitted_batch_count == m_batch_count);
+                        });
+                        if (m_parsing_abortion_requested || !o_result)
+                        {
+                            break;
+                        }
+                        result = std::move(*o_result);
+                        o_result.reset();
+                    }
+
+                    for (auto& element_: result.elements)
+                    {
+                        m_channel.insert(std::move(element_));
+                    }
+                    if (result.p_exception)
+                    {
+                        m_channel.insert(std::move(result.p_exception));
+                        break;
+                    }
+
+                    {
+                        const std::unique_lock<std::mutex> lock{ m_mutex };
+                        ++m_emitted_batch_count;
+                    }
+                    m_condition_variable.notify_all();
+                }
+            }
+            catch (...)
+            {
+                m_channel.insert(std::current_exception());
+            }
+
+            request_parsing_abortion();
+            m_channel.close();
+        }
+
+        void request_parsing_abortion()
+        {
+            {
+                const std::unique_lock<std::mutex> lock{ m_mutex };
+                m_parsing_abortion_requested = true;
+            }
+            m_condition_variable.notify_all();
+        }
+
+        void join_threads()
+        {
+            for (auto& thread_: m_threads)
+            {
+                if (thread_.joinable())
+                {
+                    thread_.join();
+                }
+            }
+        }
+    };
+
+
+    std::size_t ndjson_parser::default_thread_count()
+    {
+        return impl::default_thread_count();
+    }
+
+    ndjson_parser::ndjson_parser(
+        std::unique_ptr<reader>&& p_reader,
+        const std::size_t         thread_count /*= default_thread_count()*/,
+        const std::size_t         buffer_capacity /*= json_parser::default_buffer_capacity()*/) :
+    m_p_impl{ std::make_unique<impl>(std::move(p_reader), thread_count, buffer_capacity) }
+    {}
+
+    ndjson_parser::~ndjson_parser() = default;
+
+    bool ndjson_parser::has_next() const
+    {
+        return m_p_impl->has_next();
+    }
+
+    const element& ndjson_parser::peek() const
+    {
+        return m_p_impl->peek();
+    }
+
+    void ndjson_parser::next()
+    {
+        m_p_impl->next();
+    }
+
+
+}
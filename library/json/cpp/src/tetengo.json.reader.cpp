@@ -1,35 +1,83 @@
-/*! \file
-    \brief A reader.
-
-    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
-*/
-
-#include <tetengo/json/reader.hpp>
-
-
-namespace tetengo::json
-{
-    reader::~reader() = default;
-
-    bool reader::has_next() const
-    {
-        return has_next_impl();
-    }
-
-    char reader::peek() const
-    {
-        return peek_impl();
-    }
-
-    void reader::next()
-    {
-        next_impl();
-    }
-
-    const reader& reader::base_reader() const
-    {
-        return base_reader_impl();
-    }
-
-
-}
+/*! \file
+    \brief A reader.
+
+    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
+*/
+
+#include <cstddef>
+#include <stdexcept>
+#include <string_view>
+
+#include <tetengo/json/reader.hpp>
+
+
+namespace tetengo::json
+{
+    reader::reader() : m_single_character_chunk{ '\0' } {}
+
+    reader::~reader() = default;
+
+    bool reader::has_next() const
+    {
+        return has_next_impl();
+    }
+
+    char reader::peek() const
+    {
+        return peek_impl();
+    }
+
+    void reader::next()
+    {
+        next_impl();
+    }
+
+    std::string_view reader::peek_chunk() const
+    {
+        return peek_chunk_impl();
+    }
+
+    void reader::consume(const std::size_t length)
+    {
+        consume_impl(length);
+    }
+
+    bool reader::chunks_persistent() const
+    {
+        return chunks_persistent_impl();
+    }
+
+    const reader& reader::base_reader() const
+    {
+        return base_reader_impl();
+    }
+
+    std::string_view reader::peek_chunk_impl() const
+    {
+        if (!has_next())
+        {
+            return std::string_view{};
+        }
+        m_single_character_chunk = peek();
+        return std::string_view{ &m_single_character_chunk, 1 };
+    }
+
+    void reader::consume_impl(const std::size_t length)
+    {
+        if (length > 1 || (length == 1 && !has_next()))
+        {
+            throw std::logic_error{ "The length is greater than the length of the current chunk." };
+        }
+        if (length == 1)
+        {
+            next();
+        }
+    }
+
+    bool reader::chunks_persistent_impl() const
+    {
+        return false;
+    }
+
+
+}
@@ -0,0 +1,152 @@
+/*! \file
+    \brief A string decoder.
+
+    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
+*/
+
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <system_error>
+
+#include "tetengo.json.string_decoder.hpp"
+
+
+namespace tetengo::json
+{
+    namespace
+    {
+        std::optional<char32_t> to_utf16_code(const std::string_view& hex)
+        {
+            if (hex.length() < 4)
+            {
+                return std::nullopt;
+            }
+            std::uint32_t code = 0;
+            const auto* const p_last = std::data(hex) + 4;
+            const auto        result = std::from_chars(std::data(hex), p_last, code, 16);
+            if (result.ec != std::errc{} || result.ptr != p_last)
+            {
+                return std::nullopt;
+            }
+            return std::make_optional(static_cast<char32_t>(code));
+        }
+
+        bool is_high_surrogate(const char32_t code)
+        {
+            return 0xD800 <= code && code <= 0xDBFF;
+        }
+
+        bool is_low_surrogate(const char32_t code)
+        {
+            return 0xDC00 <= code && code <= 0xDFFF;
+        }
+
+        void append_utf8(const char32_t code, std::string& buffer)
+        {
+            if (code < 0x80)
+            {
+                buffer.push_back(static_cast<char>(code));
+            }
+            else if (code < 0x800)
+            {
+                buffer.push_back(static_cast<char>(0xC0 | (code >> 6)));
+                buffer.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+            }
+            else if (code < 0x10000)
+            {
+                buffer.push_back(static_cast<char>(0xE0 | (code >> 12)));
+                buffer.push_back(static_cast<char>(0x80 | ((code >> 6) & 0x3F)));
+                buffer.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+            }
+            else
+            {
+                buffer.push_back(static_cast<char>(0xF0 | (code >> 18)));
+                buffer.push_back(static_cast<char>(0x80 | ((code >> 12) & 0x3F)));
+                buffer.push_back(static_cast<char>(0x80 | ((code >> 6) & 0x3F)));
+                buffer.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+            }
+        }
+
+        char unescape_control_code(const char escaped)
+        {
+            switch (escaped)
+            {
+            case 'b':
+                return '\b';
+            case 'f':
+                return '\f';
+            case 'n':
+                return '\n';
+            case 'r':
+                return '\r';
+            case 't':
+                return '\t';
+            default:
+                return escaped;
+            }
+        }
+
+        std::size_t unescape_utf16(const std::string_view& escaped, const std::size_t offset, std::string& buffer)
+        {
+            const auto o_code = to_utf16_code(escaped.substr(offset + 2));
+            if (!o_code)
+            {
+                buffer.append(escaped.substr(offset, 2));
+                return 2;
+            }
+            if (is_high_surrogate(*o_code) && escaped.substr(offset + 6, 2) == "\\u")
+            {
+                if (const auto o_low_code = to_utf16_code(escaped.substr(offset + 8));
+                    o_low_code && is_low_surrogate(*o_low_code))
+                {
+                    append_utf8(0x10000 + ((*o_code - 0xD800) << 10) + (*o_low_code - 0xDC00), buffer);
+                    return 12;
+                }
+            }
+            append_utf8(is_high_surrogate(*o_code) || is_low_surrogate(*o_code) ? 0xFFFD : *o_code, buffer);
+            return 6;
+        }
+
+
+    }
+
+
+    std::string_view string_decoder::decode(const std::string_view& escaped, std::string& buffer)
+    {
+        auto backslash_position = escaped.find('\\');
+        if (backslash_position == std::string_view::npos)
+        {
+            return escaped;
+        }
+
+        buffer.assign(escaped.substr(0, backslash_position));
+        while (backslash_position != std::string_view::npos)
+        {
+            auto next_position = backslash_position + 2;
+            if (next_position > escaped.length())
+            {
+                buffer.push_back('\\');
+                break;
+            }
+            if (escaped[backslash_position + 1] == 'u')
+            {
+                next_position = backslash_position + unescape_utf16(escaped, backslash_position, buffer);
+            }
+            else
+            {
+                buffer.push_back(unescape_control_code(escaped[backslash_position + 1]));
+            }
+
+            backslash_position = escaped.find('\\', next_position);
+            buffer.append(escaped.substr(next_position, backslash_position - next_position));
+        }
+        return buffer;
+    }
+
+
+}
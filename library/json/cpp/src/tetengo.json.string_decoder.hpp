@@ -0,0 +1,47 @@
+/*! \file
+    \brief A string decoder.
+
+    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
+*/
+
+#if !defined(TETENGO_JSON_STRINGDECODER_HPP)
+#define TETENGO_JSON_STRINGDECODER_HPP
+
+#include <string>
+#include <string_view>
+
+
+namespace tetengo::json
+{
+    /*!
+        \brief A string decoder.
+    */
+    class string_decoder
+    {
+    public:
+        // static functions
+
+        /*!
+            \brief Decodes the escape sequences in a string.
+
+            A lone surrogate is decoded into U+FFFD.
+
+            \param escaped A string without the enclosing quotation marks.
+            \param buffer  A buffer.
+
+            \return The decoded string. It is escaped itself when it has no escape sequence, or a view of the buffer
+                    otherwise.
+        */
+        [[nodiscard]] static std::string_view decode(const std::string_view& escaped, std::string& buffer);
+
+
+        // constructors
+
+        string_decoder() = delete;
+    };
+
+
+}
+
+
+#endif
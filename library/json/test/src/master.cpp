@@ -1,8 +1,8 @@
-/*! \file
-    \brief The master test suite.
-
-    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
-*/
-
-#define BOOST_TEST_MODULE "tetengo-json.test"
-#include <boost/test/unit_test.hpp> // IWYU pragma: keep
+/*! \file
+    \brief The master test suite.
+
+    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
+*/
+
+#define BOOST_TEST_MODULE "tetengo-json.test"
+#include <boost/test/unit_test.hpp> // IWYU pragma: keep
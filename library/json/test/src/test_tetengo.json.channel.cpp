@@ -1,180 +1,381 @@
-/*! \file
-    \brief A channel.
-
-    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
-*/
-
-#include <exception>
-#include <stdexcept>
-#include <string>
-#include <thread>
-#include <unordered_map>
-#include <utility>
-
-#include <boost/preprocessor.hpp>
-#include <boost/test/unit_test.hpp>
-
-#include <tetengo/json/channel.hpp>
-#include <tetengo/json/element.hpp>
-#include <tetengo/json/file_location.hpp>
-
-
-namespace
-{
-    using element_type = tetengo::json::element;
-
-
-}
-
-
-BOOST_AUTO_TEST_SUITE(test_tetengo)
-BOOST_AUTO_TEST_SUITE(json)
-BOOST_AUTO_TEST_SUITE(channel)
-
-
-BOOST_AUTO_TEST_CASE(construction)
-{
-    BOOST_TEST_PASSPOINT();
-
-    {
-        const tetengo::json::channel channel_{ 42 };
-    }
-    {
-        BOOST_CHECK_THROW(const tetengo::json::channel channel_{ 0 }, std::invalid_argument);
-    }
-}
-
-BOOST_AUTO_TEST_CASE(insert)
-{
-    BOOST_TEST_PASSPOINT();
-
-    {
-        tetengo::json::channel channel_{ 42 };
-
-        element_type element{ element_type::type_type{ element_type::type_name_type::string,
-                                                       element_type::type_category_type::primitive },
-                              "tateno",
-                              std::unordered_map<std::string, std::string>{},
-                              tetengo::json::file_location{ "hoge", 2, 3 } };
-        channel_.insert(std::move(element));
-    }
-    {
-        tetengo::json::channel channel_{ 42 };
-
-        channel_.insert(std::make_exception_ptr(std::runtime_error{ "seta" }));
-    }
-}
-
-BOOST_AUTO_TEST_CASE(peek)
-{
-    BOOST_TEST_PASSPOINT();
-
-    {
-        tetengo::json::channel channel_{ 42 };
-
-        element_type element{ element_type::type_type{ element_type::type_name_type::string,
-                                                       element_type::type_category_type::primitive },
-                              "tateno",
-                              std::unordered_map<std::string, std::string>{},
-                              tetengo::json::file_location{ "hoge", 2, 3 } };
-        channel_.insert(std::move(element));
-
-        const auto& peeked = channel_.peek();
-        BOOST_CHECK(peeked.type().name == element_type::type_name_type::string);
-        BOOST_TEST(peeked.value() == "tateno");
-    }
-    {
-        tetengo::json::channel channel_{ 42 };
-
-        channel_.insert(std::make_exception_ptr(std::runtime_error{ "seta" }));
-
-        BOOST_CHECK_THROW([[maybe_unused]] const auto& peeked = channel_.peek(), std::runtime_error);
-    }
-}
-
-BOOST_AUTO_TEST_CASE(take)
-{
-    BOOST_TEST_PASSPOINT();
-
-    tetengo::json::channel channel_{ 2 };
-
-    std::thread inserter{ [&channel_]() {
-        channel_.insert(element_type{ element_type::type_type{ element_type::type_name_type::string,
-                                                               element_type::type_category_type::primitive },
-                                      "tateno",
-                                      std::unordered_map<std::string, std::string>{},
-                                      tetengo::json::file_location{ "hoge", 2, 3 } });
-        channel_.insert(element_type{ element_type::type_type{ element_type::type_name_type::string,
-                                                               element_type::type_category_type::primitive },
-                                      "akamizu",
-                                      std::unordered_map<std::string, std::string>{},
-                                      tetengo::json::file_location{ "hoge", 2, 3 } });
-        channel_.insert(element_type{ element_type::type_type{ element_type::type_name_type::string,
-                                                               element_type::type_category_type::primitive },
-                                      "ichinokawa",
-                                      std::unordered_map<std::string, std::string>{},
-                                      tetengo::json::file_location{ "hoge", 2, 3 } });
-        channel_.insert(element_type{ element_type::type_type{ element_type::type_name_type::string,
-                                                               element_type::type_category_type::primitive },
-                                      "uchinomaki",
-                                      std::unordered_map<std::string, std::string>{},
-                                      tetengo::json::file_location{ "hoge", 2, 3 } });
-        channel_.insert(element_type{ element_type::type_type{ element_type::type_name_type::string,
-                                                               element_type::type_category_type::primitive },
-                                      "aso",
-                                      std::unordered_map<std::string, std::string>{},
-                                      tetengo::json::file_location{ "hoge", 2, 3 } });
-    } };
-
-    BOOST_TEST(channel_.peek().value() == "tateno");
-    channel_.take();
-    BOOST_TEST(channel_.peek().value() == "akamizu");
-    channel_.take();
-    BOOST_TEST(channel_.peek().value() == "ichinokawa");
-    channel_.take();
-    BOOST_TEST(channel_.peek().value() == "uchinomaki");
-    channel_.take();
-    BOOST_TEST(channel_.peek().value() == "aso");
-    channel_.take();
-
-    inserter.join();
-}
-
-BOOST_AUTO_TEST_CASE(closed)
-{
-    BOOST_TEST_PASSPOINT();
-
-    tetengo::json::channel channel_{ 42 };
-
-    channel_.insert(element_type{
-        element_type::type_type{ element_type::type_name_type::string, element_type::type_category_type::primitive },
-        "tateno",
-        std::unordered_map<std::string, std::string>{},
-        tetengo::json::file_location{ "hoge", 2, 3 } });
-
-    BOOST_TEST(!channel_.closed());
-}
-
-BOOST_AUTO_TEST_CASE(close)
-{
-    BOOST_TEST_PASSPOINT();
-
-    tetengo::json::channel channel_{ 42 };
-
-    channel_.close();
-
-    BOOST_TEST(channel_.closed());
-
-    channel_.insert(element_type{
-        element_type::type_type{ element_type::type_name_type::string, element_type::type_category_type::primitive },
-        "tateno",
-        std::unordered_map<std::string, std::string>{},
-        tetengo::json::file_location{ "hoge", 2, 3 } });
-
-    BOOST_CHECK_THROW([[maybe_unused]] const auto& peeked = channel_.peek(), std::logic_error);
-}
-
-
-BOOST_AUTO_TEST_SUITE_END()
-BOOST_AUTO_TEST_SUITE_END()
-BOOST_AUTO_TEST_SUITE_END()
+/*! \file
+    \brief A channel.
+
+    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
+*/
+
+#include <exception>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+
+#include <boost/preprocessor.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <tetengo/json/channel.hpp>
+#include <tetengo/json/element.hpp>
+#include <tetengo/json/element_view.hpp>
+#include <tetengo/json/file_location.hpp>
+
+
+namespace
+{
+    using element_type = tetengo::json::element;
+
+
+}
+
+
+BOOST_AUTO_TEST_SUITE(test_tetengo)
+BOOST_AUTO_TEST_SUITE(json)
+BOOST_AUTO_TEST_SUITE(channel)
+
+
+BOOST_AUTO_TEST_CASE(construction)
+{
+    BOOST_TEST_PASSPOINT();
+
+    {
+        const tetengo::json::channel channel_{ 42 };
+    }
+    {
+        const tetengo::json::channel channel_{ 42, 8 };
+    }
+    {
+        BOOST_CHECK_THROW(const tetengo::json::channel channel_{ 0 }, std::invalid_argument);
+    }
+    {
+        BOOST_CHECK_THROW(const tetengo::json::channel channel_(42, 0), std::invalid_argument);
+    }
+    {
+        BOOST_CHECK_THROW(const tetengo::json::channel channel_(42, 43), std::invalid_argument);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(insert)
+{
+    BOOST_TEST_PASSPOINT();
+
+    {
+        tetengo::json::channel channel_{ 42 };
+
+        element_type element{ element_type::type_type{ element_type::type_name_type::string,
+                                                       element_type::type_category_type::primitive },
+                              "tateno",
+                              std::unordered_map<std::string, std::string>{},
+                              tetengo::json::file_location{ "hoge", 2, 3 } };
+        channel_.insert(std::move(element));
+    }
+    {
+        tetengo::json::channel channel_{ 42 };
+
+        const tetengo::json::file_location file_location{ "hoge", 2, 3 };
+        channel_.insert(tetengo::json::element_view{
+            element_type::type_type{ element_type::type_name_type::member,
+                                     element_type::type_category_type::structure_open },
+            "",
+            "tateno",
+            file_location });
+    }
+    {
+        tetengo::json::channel channel_{ 42 };
+
+        channel_.insert(std::make_exception_ptr(std::runtime_error{ "seta" }));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(peek)
+{
+    BOOST_TEST_PASSPOINT();
+
+    {
+        tetengo::json::channel channel_{ 42 };
+
+        element_type element{ element_type::type_type{ element_type::type_name_type::string,
+                                                       element_type::type_category_type::primitive },
+                              "tateno",
+                              std::unordered_map<std::string, std::string>{},
+                              tetengo::json::file_location{ "hoge", 2, 3 } };
+        channel_.insert(std::move(element));
+
+        const auto& peeked = channel_.peek();
+        BOOST_CHECK(peeked.type().name == element_type::type_name_type::string);
+        BOOST_TEST(peeked.value() == "tateno");
+    }
+    {
+        tetengo::json::channel channel_{ 42 };
+
+        channel_.insert(std::make_exception_ptr(std::runtime_error{ "seta" }));
+
+        BOOST_CHECK_THROW([[maybe_unused]] const auto& peeked = channel_.peek(), std::runtime_error);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(peek_view)
+{
+    BOOST_TEST_PASSPOINT();
+
+    {
+        tetengo::json::channel channel_{ 42 };
+
+        element_type element{ element_type::type_type{ element_type::type_name_type::string,
+                                                       element_type::type_category_type::primitive },
+                              "tateno",
+                              std::unordered_map<std::string, std::string>{},
+                              tetengo::json::file_location{ "hoge", 2, 3 } };
+        channel_.insert(std::move(element));
+
+        const auto viewed = channel_.peek_view();
+        BOOST_CHECK(viewed.type().name == element_type::type_name_type::string);
+        BOOST_TEST(viewed.value() == "tateno");
+        BOOST_TEST(viewed.get_file_location().line_index() == 2U);
+    }
+    {
+        tetengo::json::channel channel_{ 1 };
+
+        {
+            std::string                        name{ "tateno" };
+            const tetengo::json::file_location file_location{ "hoge", 2, 3 };
+            channel_.insert(tetengo::json::element_view{
+                element_type::type_type{ element_type::type_name_type::member,
+                                         element_type::type_category_type::structure_open },
+                "",
+                name,
+                file_location });
+            name = "XXXXXX";
+        }
+
+        {
+            const auto viewed = channel_.peek_view();
+            BOOST_CHECK(viewed.type().name == element_type::type_name_type::member);
+            BOOST_TEST(viewed.name() == "tateno");
+            BOOST_TEST(viewed.get_file_location().line() == "hoge");
+        }
+        {
+            const auto& peeked = channel_.peek();
+            BOOST_CHECK(peeked.type().name == element_type::type_name_type::member);
+            BOOST_TEST(peeked.attributes().at("name") == "tateno");
+        }
+        channel_.take();
+
+        const tetengo::json::file_location file_location{ "fuga", 5, 3 };
+        channel_.insert(tetengo::json::element_view{
+            element_type::type_type{ element_type::type_name_type::number,
+                                     element_type::type_category_type::primitive },
+            "42",
+            "",
+            file_location });
+
+        const auto viewed = channel_.peek_view();
+        BOOST_CHECK(viewed.type().name == element_type::type_name_type::number);
+        BOOST_TEST(viewed.value() == "42");
+        BOOST_TEST(viewed.name() == "");
+        BOOST_TEST(viewed.get_file_location().line_index() == 5U);
+        BOOST_TEST(channel_.peek().value() == "42");
+    }
+    {
+        tetengo::json::channel channel_{ 42 };
+
+        channel_.insert(std::make_exception_ptr(std::runtime_error{ "seta" }));
+
+        BOOST_CHECK_THROW([[maybe_unused]] const auto viewed = channel_.peek_view(), std::runtime_error);
+    }
+    {
+        tetengo::json::channel channel_{ 42 };
+
+        channel_.close();
+
+        BOOST_CHECK_THROW([[maybe_unused]] const auto viewed = channel_.peek_view(), std::logic_error);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(take)
+{
+    BOOST_TEST_PASSPOINT();
+
+    tetengo::json::channel channel_{ 2 };
+
+    std::thread inserter{ [&channel_]() {
+        channel_.insert(element_type{ element_type::type_type{ element_type::type_name_type::string,
+                                                               element_type::type_category_type::primitive },
+                                      "tateno",
+                                      std::unordered_map<std::string, std::string>{},
+                                      tetengo::json::file_location{ "hoge", 2, 3 } });
+        channel_.insert(element_type{ element_type::type_type{ element_type::type_name_type::string,
+                                                               element_type::type_category_type::primitive },
+                                      "akamizu",
+                                      std::unordered_map<std::string, std::string>{},
+                                      tetengo::json::file_location{ "hoge", 2, 3 } });
+        channel_.insert(element_type{ element_type::type_type{ element_type::type_name_type::string,
+                                                               element_type::type_category_type::primitive },
+                                      "ichinokawa",
+                                      std::unordered_map<std::string, std::string>{},
+                                      tetengo::json::file_location{ "hoge", 2, 3 } });
+        channel_.insert(element_type{ element_type::type_type{ element_type::type_name_type::string,
+                                                               element_type::type_category_type::primitive },
+                                      "uchinomaki",
+                                      std::unordered_map<std::string, std::string>{},
+                                      tetengo::json::file_location{ "hoge", 2, 3 } });
+        channel_.insert(element_type{ element_type::type_type{ element_type::type_name_type::string,
+                                                               element_type::type_category_type::primitive },
+                                      "aso",
+                                      std::unordered_map<std::string, std::string>{},
+                                      tetengo::json::file_location{ "hoge", 2, 3 } });
+    } };
+
+    BOOST_TEST(channel_.peek().value() == "tateno");
+    channel_.take();
+    BOOST_TEST(channel_.peek().value() == "akamizu");
+    channel_.take();
+    BOOST_TEST(channel_.peek().value() == "ichinokawa");
+    channel_.take();
+    BOOST_TEST(channel_.peek().value() == "uchinomaki");
+    channel_.take();
+    BOOST_TEST(channel_.peek().value() == "aso");
+    channel_.take();
+
+    inserter.join();
+}
+
+BOOST_AUTO_TEST_CASE(take_across_threads)
+{
+    BOOST_TEST_PASSPOINT();
+
+    tetengo::json::channel channel_{ 3 };
+
+    std::thread inserter{ [&channel_]() {
+        for (auto i = 0; i < 1000; ++i)
+        {
+            channel_.insert(element_type{ element_type::type_type{ element_type::type_name_type::number,
+                                                                   element_type::type_category_type::primitive },
+                                          std::to_string(i),
+                                          std::unordered_map<std::string, std::string>{},
+                                          tetengo::json::file_location{ "hoge", 2, 3 } });
+        }
+        channel_.insert(std::make_exception_ptr(std::runtime_error{ "seta" }));
+        channel_.close();
+    } };
+
+    for (auto i = 0; i < 1000; ++i)
+    {
+        BOOST_TEST_REQUIRE(!channel_.closed());
+        BOOST_TEST_REQUIRE(channel_.peek().value() == std::to_string(i));
+        channel_.take();
+    }
+    BOOST_TEST_REQUIRE(!channel_.closed());
+    BOOST_CHECK_THROW([[maybe_unused]] const auto& peeked = channel_.peek(), std::runtime_error);
+    channel_.take();
+    BOOST_TEST(channel_.closed());
+    BOOST_CHECK_THROW(channel_.take(), std::logic_error);
+
+    inserter.join();
+}
+
+BOOST_AUTO_TEST_CASE(take_across_threads_in_batches)
+{
+    BOOST_TEST_PASSPOINT();
+
+    tetengo::json::channel channel_{ 5, 2 };
+
+    std::thread inserter{ [&channel_]() {
+        for (auto i = 0; i < 1000; ++i)
+        {
+            channel_.insert(element_type{ element_type::type_type{ element_type::type_name_type::number,
+                                                                   element_type::type_category_type::primitive },
+                                          std::to_string(i),
+                                          std::unordered_map<std::string, std::string>{},
+                                          tetengo::json::file_location{ "hoge", 2, 3 } });
+        }
+        channel_.close();
+    } };
+
+    for (auto i = 0; i < 1000; ++i)
+    {
+        BOOST_TEST_REQUIRE(!channel_.closed());
+        BOOST_TEST_REQUIRE(channel_.peek().value() == std::to_string(i));
+        channel_.take();
+    }
+    BOOST_TEST(channel_.closed());
+
+    inserter.join();
+}
+
+BOOST_AUTO_TEST_CASE(closed)
+{
+    BOOST_TEST_PASSPOINT();
+
+    tetengo::json::channel channel_{ 42 };
+
+    channel_.insert(element_type{
+        element_type::type_type{ element_type::type_name_type::string, element_type::type_category_type::primitive },
+        "tateno",
+        std::unordered_map<std::string, std::string>{},
+        tetengo::json::file_location{ "hoge", 2, 3 } });
+
+    BOOST_TEST(!channel_.closed());
+}
+
+BOOST_AUTO_TEST_CASE(flush)
+{
+    BOOST_TEST_PASSPOINT();
+
+    tetengo::json::channel channel_{ 42, 3 };
+
+    channel_.insert(element_type{
+        element_type::type_type{ element_type::type_name_type::string, element_type::type_category_type::primitive },
+        "tateno",
+        std::unordered_map<std::string, std::string>{},
+        tetengo::json::file_location{ "hoge", 2, 3 } });
+    channel_.insert(element_type{
+        element_type::type_type{ element_type::type_name_type::string, element_type::type_category_type::primitive },
+        "akamizu",
+        std::unordered_map<std::string, std::string>{},
+        tetengo::json::file_location{ "hoge", 2, 3 } });
+    channel_.flush();
+
+    BOOST_TEST_REQUIRE(!channel_.closed());
+    BOOST_TEST(channel_.peek().value() == "tateno");
+    channel_.take();
+    BOOST_TEST_REQUIRE(!channel_.closed());
+    BOOST_TEST(channel_.peek().value() == "akamizu");
+    channel_.take();
+
+    channel_.flush();
+    channel_.insert(element_type{
+        element_type::type_type{ element_type::type_name_type::string, element_type::type_category_type::primitive },
+        "ichinokawa",
+        std::unordered_map<std::string, std::string>{},
+        tetengo::json::file_location{ "hoge", 2, 3 } });
+    channel_.close();
+
+    BOOST_TEST_REQUIRE(!channel_.closed());
+    BOOST_TEST(channel_.peek().value() == "ichinokawa");
+    channel_.take();
+    BOOST_TEST(channel_.closed());
+}
+
+BOOST_AUTO_TEST_CASE(close)
+{
+    BOOST_TEST_PASSPOINT();
+
+    tetengo::json::channel channel_{ 42 };
+
+    channel_.close();
+
+    BOOST_TEST(channel_.closed());
+
+    channel_.insert(element_type{
+        element_type::type_type{ element_type::type_name_type::string, element_type::type_category_type::primitive },
+        "tateno",
+        std::unordered_map<std::string, std::string>{},
+        tetengo::json::file_location{ "hoge", 2, 3 } });
+
+    BOOST_CHECK_THROW([[maybe_unused]] const auto& peeked = channel_.peek(), std::logic_error);
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,219 @@
+/*! \file
+    \brief A document.
+
+    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
+*/
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <sstream> // IWYU pragma: keep
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <boost/preprocessor.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <tetengo/json/document.hpp>
+#include <tetengo/json/element.hpp>
+#include <tetengo/json/json_grammar.hpp>
+#include <tetengo/json/json_parser.hpp>
+#include <tetengo/json/reader.hpp>
+#include <tetengo/json/stream_reader.hpp>
+
+
+namespace
+{
+    // clang-format off
+    const std::string json0{
+        "{\n"
+        "  \"name\": \"Hohi\\u7DDA\",\n"
+        "  \"stations\": [\n"
+        "    { \"name\": \"Kumamoto\", \"telegram_code\": \"\\u30AF\\u30DE\" },\n"
+        "    { \"name\": \"Aso\", \"telegram_code\": \"\\u30A2\\u30BD\" },\n"
+        "    { \"name\": \"Oita\", \"telegram_code\": \"\\u30AA\\u30A4\" }\n"
+        "  ],\n"
+        "  \"length\": 148.0,\n"
+        "  \"electrified\": false,\n"
+        "  \"note\": null,\n"
+        "  \"empty_object\": {},\n"
+        "  \"empty_array\": [],\n"
+        "  \"duplicated\": 1,\n"
+        "  \"duplicated\": 2\n"
+        "}\n"
+    };
+    // clang-format on
+
+    std::unique_ptr<tetengo::json::json_parser> make_parser(const std::string& json)
+    {
+        auto p_reader = std::make_unique<tetengo::json::stream_reader>(std::make_unique<std::istringstream>(json));
+        return std::make_unique<tetengo::json::json_parser>(
+            std::move(p_reader),
+            tetengo::json::json_parser::default_buffer_capacity(),
+            tetengo::json::json_grammar::backend_type::hand_written,
+            tetengo::json::json_parser::parsing_mode_type::synchronous);
+    }
+
+
+}
+
+
+BOOST_AUTO_TEST_SUITE(test_tetengo)
+BOOST_AUTO_TEST_SUITE(json)
+BOOST_AUTO_TEST_SUITE(document)
+
+
+BOOST_AUTO_TEST_CASE(construction)
+{
+    BOOST_TEST_PASSPOINT();
+
+    {
+        const auto                    p_parser = make_parser(json0);
+        const tetengo::json::document document_{ *p_parser };
+
+        BOOST_TEST(!p_parser->has_next());
+    }
+    {
+        auto p_reader = std::make_unique<tetengo::json::stream_reader>(std::make_unique<std::istringstream>(json0));
+        tetengo::json::json_parser    parser{ std::move(p_reader) };
+        const tetengo::json::document document_{ parser };
+    }
+    {
+        const auto p_parser = make_parser("");
+        BOOST_CHECK_THROW(const tetengo::json::document document_{ *p_parser }, std::runtime_error);
+    }
+    {
+        const auto p_parser = make_parser("[ 42, ");
+        BOOST_CHECK_THROW(const tetengo::json::document document_{ *p_parser }, std::runtime_error);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(root)
+{
+    BOOST_TEST_PASSPOINT();
+
+    {
+        const auto                    p_parser = make_parser(json0);
+        const tetengo::json::document document_{ *p_parser };
+
+        const auto root = document_.root();
+        BOOST_CHECK(root.type() == tetengo::json::element::type_name_type::object);
+        BOOST_TEST(std::empty(root.value()));
+        BOOST_TEST(std::empty(root.name()));
+        BOOST_TEST(root.size() == 9U);
+    }
+    {
+        const auto                    p_parser = make_parser(" \"\\u3042\" ");
+        const tetengo::json::document document_{ *p_parser };
+
+        const auto root = document_.root();
+        BOOST_CHECK(root.type() == tetengo::json::element::type_name_type::string);
+        BOOST_TEST(root.value() == "\xE3\x81\x82");
+        BOOST_TEST(root.size() == 0U);
+        BOOST_CHECK(std::begin(root) == std::end(root));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(node_operator_subscript)
+{
+    BOOST_TEST_PASSPOINT();
+
+    const auto                    p_parser = make_parser(json0);
+    const tetengo::json::document document_{ *p_parser };
+
+    const auto root = document_.root();
+    BOOST_TEST(root[0].name() == "name");
+    BOOST_TEST(root[0].value() == "Hohi\xE7\xB7\x9A");
+
+    const auto stations = root[1];
+    BOOST_CHECK(stations.type() == tetengo::json::element::type_name_type::array);
+    BOOST_TEST_REQUIRE(stations.size() == 3U);
+    BOOST_TEST(stations[2][0].value() == "Oita");
+    BOOST_TEST(stations[2][1].name() == "telegram_code");
+    BOOST_TEST(stations[2][1].value() == "\xE3\x82\xAA\xE3\x82\xA4");
+    BOOST_TEST(std::empty(stations[2].name()));
+
+    BOOST_CHECK(root[2].type() == tetengo::json::element::type_name_type::number);
+    BOOST_TEST(root[2].value() == "148.0");
+    BOOST_CHECK(root[3].type() == tetengo::json::element::type_name_type::boolean);
+    BOOST_TEST(root[3].value() == "false");
+    BOOST_CHECK(root[4].type() == tetengo::json::element::type_name_type::null);
+    BOOST_TEST(root[5].size() == 0U);
+    BOOST_TEST(root[6].size() == 0U);
+
+    BOOST_CHECK_THROW([[maybe_unused]] const auto node = root[9], std::out_of_range);
+    BOOST_CHECK_THROW([[maybe_unused]] const auto node = root[3][0], std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(node_find)
+{
+    BOOST_TEST_PASSPOINT();
+
+    const auto                    p_parser = make_parser(json0);
+    const tetengo::json::document document_{ *p_parser };
+
+    const auto root = document_.root();
+    {
+        const auto o_found = root.find("electrified");
+        BOOST_TEST_REQUIRE(o_found.has_value());
+        BOOST_TEST(o_found->value() == "false");
+    }
+    {
+        const auto o_found = root.find("stations");
+        BOOST_TEST_REQUIRE(o_found.has_value());
+        const auto o_station_name = (*o_found)[1].find("name");
+        BOOST_TEST_REQUIRE(o_station_name.has_value());
+        BOOST_TEST(o_station_name->value() == "Aso");
+    }
+    {
+        const auto o_found = root.find("duplicated");
+        BOOST_TEST_REQUIRE(o_found.has_value());
+        BOOST_TEST(o_found->value() == "1");
+    }
+    {
+        BOOST_TEST(!root.find("nonexistent"));
+        BOOST_TEST(!root.find(""));
+        BOOST_TEST(!root[5].find("name"));
+        BOOST_TEST(!root[1].find("name"));
+        BOOST_TEST(!root[0].find("name"));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(node_iteration)
+{
+    BOOST_TEST_PASSPOINT();
+
+    const auto                    p_parser = make_parser(json0);
+    const tetengo::json::document document_{ *p_parser };
+
+    const auto root = document_.root();
+    {
+        std::vector<std::string_view> names{};
+        for (const auto& child: root)
+        {
+            names.push_back(child.name());
+        }
+        const std::vector<std::string_view> expected{ "name",        "stations",     "length",
+                                                      "electrified", "note",         "empty_object",
+                                                      "empty_array", "duplicated",   "duplicated" };
+        BOOST_CHECK(names == expected);
+    }
+    {
+        const auto stations = root[1];
+        BOOST_TEST(std::distance(std::begin(stations), std::end(stations)) == 3);
+        BOOST_TEST((*(std::begin(stations) + 1))[0].value() == "Aso");
+        BOOST_TEST(std::begin(stations)[2][0].value() == "Oita");
+        BOOST_TEST(
+            std::count_if(std::begin(stations), std::end(stations), [](const auto& station) {
+                return station.size() == 2U;
+            }) == 3);
+    }
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,327 @@
+/*! \file
+    \brief An element view.
+
+    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
+*/
+
+#include <cstdint>
+#include <iterator>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include <boost/preprocessor.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <tetengo/json/element.hpp>
+#include <tetengo/json/element_view.hpp>
+#include <tetengo/json/file_location.hpp>
+
+
+namespace
+{
+    using element_type = tetengo::json::element;
+
+    const tetengo::json::file_location& location()
+    {
+        static const tetengo::json::file_location singleton{ "hoge", 2, 3 };
+        return singleton;
+    }
+
+    tetengo::json::element_view make_string_view(const std::string_view& value)
+    {
+        return tetengo::json::element_view{ element_type::type_type{ element_type::type_name_type::string,
+                                                                     element_type::type_category_type::primitive },
+                                            value,
+                                            std::string_view{},
+                                            location() };
+    }
+
+    tetengo::json::element_view make_number_view(const std::string_view& value)
+    {
+        return tetengo::json::element_view{ element_type::type_type{ element_type::type_name_type::number,
+                                                                     element_type::type_category_type::primitive },
+                                            value,
+                                            std::string_view{},
+                                            location() };
+    }
+
+
+}
+
+
+BOOST_AUTO_TEST_SUITE(test_tetengo)
+BOOST_AUTO_TEST_SUITE(json)
+BOOST_AUTO_TEST_SUITE(element_view)
+
+
+BOOST_AUTO_TEST_CASE(construction)
+{
+    BOOST_TEST_PASSPOINT();
+
+    {
+        const tetengo::json::element_view view{ element_type::type_type{ element_type::type_name_type::string,
+                                                                         element_type::type_category_type::primitive },
+                                                "test",
+                                                std::string_view{},
+                                                location() };
+    }
+    {
+        BOOST_CHECK_THROW(
+            const tetengo::json::element_view view(
+                element_type::type_type{ element_type::type_name_type::string,
+                                         element_type::type_category_type::structure_open },
+                "test",
+                std::string_view{},
+                location()),
+            std::invalid_argument);
+    }
+    {
+        BOOST_CHECK_THROW(
+            const tetengo::json::element_view view(
+                element_type::type_type{ element_type::type_name_type::string,
+                                         element_type::type_category_type::primitive },
+                "test",
+                "name",
+                location()),
+            std::invalid_argument);
+    }
+    {
+        BOOST_CHECK_THROW(
+            const tetengo::json::element_view view(
+                element_type::type_type{ element_type::type_name_type::object,
+                                         element_type::type_category_type::primitive },
+                std::string_view{},
+                std::string_view{},
+                location()),
+            std::invalid_argument);
+    }
+    {
+        BOOST_CHECK_THROW(
+            const tetengo::json::element_view view(
+                element_type::type_type{ element_type::type_name_type::object,
+                                         element_type::type_category_type::structure_open },
+                "test",
+                std::string_view{},
+                location()),
+            std::invalid_argument);
+    }
+    {
+        const tetengo::json::element_view view{ element_type::type_type{
+                                                    element_type::type_name_type::member,
+                                                    element_type::type_category_type::structure_open },
+                                                std::string_view{},
+                                                "name",
+                                                location() };
+    }
+    {
+        BOOST_CHECK_THROW(
+            const tetengo::json::element_view view(
+                element_type::type_type{ element_type::type_name_type::member,
+                                         element_type::type_category_type::structure_close },
+                std::string_view{},
+                "name",
+                location()),
+            std::invalid_argument);
+    }
+
+    {
+        const element_type element{ element_type::type_type{ element_type::type_name_type::member,
+                                                             element_type::type_category_type::structure_open },
+                                    std::string{},
+                                    std::unordered_map<std::string, std::string>{ { "name", "value" } },
+                                    location() };
+
+        const tetengo::json::element_view view{ element };
+
+        BOOST_TEST(view.name() == "value");
+    }
+}
+
+BOOST_AUTO_TEST_CASE(type)
+{
+    BOOST_TEST_PASSPOINT();
+
+    const tetengo::json::element_view view{ element_type::type_type{ element_type::type_name_type::string,
+                                                                     element_type::type_category_type::primitive },
+                                            "test",
+                                            std::string_view{},
+                                            location() };
+
+    BOOST_CHECK(view.type().name == element_type::type_name_type::string);
+    BOOST_CHECK(view.type().category == element_type::type_category_type::primitive);
+}
+
+BOOST_AUTO_TEST_CASE(value)
+{
+    BOOST_TEST_PASSPOINT();
+
+    const std::string                 value{ "test" };
+    const tetengo::json::element_view view{ element_type::type_type{ element_type::type_name_type::string,
+                                                                     element_type::type_category_type::primitive },
+                                            value,
+                                            std::string_view{},
+                                            location() };
+
+    BOOST_TEST(view.value() == "test");
+    BOOST_TEST(std::data(view.value()) == std::data(value));
+}
+
+BOOST_AUTO_TEST_CASE(name)
+{
+    BOOST_TEST_PASSPOINT();
+
+    {
+        const tetengo::json::element_view view{ element_type::type_type{
+                                                    element_type::type_name_type::member,
+                                                    element_type::type_category_type::structure_open },
+                                                std::string_view{},
+                                                "name",
+                                                location() };
+
+        BOOST_TEST(view.name() == "name");
+    }
+    {
+        const tetengo::json::element_view view{ element_type::type_type{
+                                                    element_type::type_name_type::member,
+                                                    element_type::type_category_type::structure_close },
+                                                std::string_view{},
+                                                std::string_view{},
+                                                location() };
+
+        BOOST_TEST(std::empty(view.name()));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(decoded_value)
+{
+    BOOST_TEST_PASSPOINT();
+
+    {
+        const std::string value{ "test" };
+        const auto        view = make_string_view(value);
+
+        std::string buffer{ "untouched" };
+        const auto  decoded = view.decoded_value(buffer);
+        BOOST_TEST(decoded == "test");
+        BOOST_TEST(std::data(decoded) == std::data(value));
+        BOOST_TEST(buffer == "untouched");
+    }
+    {
+        const auto view = make_string_view("a\\\"\\\\\\/\\b\\f\\n\\r\\tz");
+
+        std::string buffer{};
+        BOOST_TEST(view.decoded_value(buffer) == "a\"\\/\b\f\n\r\tz");
+    }
+    {
+        const auto view = make_string_view("\\u0041\\u00E9\\u3042\\uD83d\\uDe00");
+
+        std::string buffer{};
+        BOOST_TEST(view.decoded_value(buffer) == "A\xC3\xA9\xE3\x81\x82\xF0\x9F\x98\x80");
+    }
+    {
+        const auto view = make_string_view("\\uD83D-\\uDE00");
+
+        std::string buffer{};
+        BOOST_TEST(view.decoded_value(buffer) == "\xEF\xBF\xBD-\xEF\xBF\xBD");
+    }
+    {
+        const auto view = make_string_view("\\u0000");
+
+        std::string buffer{};
+        BOOST_TEST(view.decoded_value(buffer) == std::string_view("\0", 1));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(decoded_name)
+{
+    BOOST_TEST_PASSPOINT();
+
+    const tetengo::json::element_view view{ element_type::type_type{ element_type::type_name_type::member,
+                                                                     element_type::type_category_type::structure_open },
+                                            std::string_view{},
+                                            "\\u3042\\n",
+                                            location() };
+
+    std::string buffer{};
+    BOOST_TEST(view.decoded_name(buffer) == "\xE3\x81\x82\n");
+}
+
+BOOST_AUTO_TEST_CASE(integer_value)
+{
+    BOOST_TEST_PASSPOINT();
+
+    BOOST_TEST((make_number_view("42").integer_value() == std::make_optional<std::int64_t>(42)));
+    BOOST_TEST((make_number_view("-0").integer_value() == std::make_optional<std::int64_t>(0)));
+    BOOST_TEST((
+        make_number_view("-9223372036854775808").integer_value() ==
+        std::make_optional<std::int64_t>(INT64_MIN)));
+    BOOST_TEST(!make_number_view("9223372036854775808").integer_value());
+    BOOST_TEST(!make_number_view("4.2").integer_value());
+    BOOST_TEST(!make_number_view("4e2").integer_value());
+    BOOST_TEST(!make_string_view("42").integer_value());
+}
+
+BOOST_AUTO_TEST_CASE(double_value)
+{
+    BOOST_TEST_PASSPOINT();
+
+    BOOST_TEST((make_number_view("42").double_value() == std::make_optional(42.0)));
+    BOOST_TEST((make_number_view("-3.25").double_value() == std::make_optional(-3.25)));
+    BOOST_TEST((make_number_view("3.0e+5").double_value() == std::make_optional(3.0e+5)));
+    BOOST_TEST((make_number_view("1E-2").double_value() == std::make_optional(1e-2)));
+    BOOST_TEST(!make_number_view("1e999").double_value());
+    BOOST_TEST(!make_string_view("42").double_value());
+}
+
+BOOST_AUTO_TEST_CASE(get_file_location)
+{
+    BOOST_TEST_PASSPOINT();
+
+    const tetengo::json::element_view view{ element_type::type_type{ element_type::type_name_type::string,
+                                                                     element_type::type_category_type::primitive },
+                                            "test",
+                                            std::string_view{},
+                                            location() };
+
+    BOOST_TEST(&view.get_file_location() == &location());
+}
+
+BOOST_AUTO_TEST_CASE(to_element)
+{
+    BOOST_TEST_PASSPOINT();
+
+    {
+        const tetengo::json::element_view view{ element_type::type_type{
+                                                    element_type::type_name_type::string,
+                                                    element_type::type_category_type::primitive },
+                                                "test",
+                                                std::string_view{},
+                                                location() };
+
+        const auto element = view.to_element();
+        BOOST_CHECK(element.type().name == element_type::type_name_type::string);
+        BOOST_CHECK(element.type().category == element_type::type_category_type::primitive);
+        BOOST_TEST(element.value() == "test");
+        BOOST_TEST(std::empty(element.attributes()));
+        BOOST_TEST((element.get_file_location() == location()));
+    }
+    {
+        const tetengo::json::element_view view{ element_type::type_type{
+                                                    element_type::type_name_type::member,
+                                                    element_type::type_category_type::structure_open },
+                                                std::string_view{},
+                                                std::string_view{},
+                                                location() };
+
+        const auto element = view.to_element();
+        BOOST_CHECK((element.attributes() == std::unordered_map<std::string, std::string>{ { "name", "" } }));
+    }
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
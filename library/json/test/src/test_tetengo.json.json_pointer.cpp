@@ -0,0 +1,86 @@
+/*! \file
+    \brief A JSON pointer.
+
+    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
+*/
+
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <boost/preprocessor.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <tetengo/json/json_pointer.hpp>
+
+
+BOOST_AUTO_TEST_SUITE(test_tetengo)
+BOOST_AUTO_TEST_SUITE(json)
+BOOST_AUTO_TEST_SUITE(json_pointer)
+
+
+BOOST_AUTO_TEST_CASE(wildcard)
+{
+    BOOST_TEST_PASSPOINT();
+
+    BOOST_TEST(tetengo::json::json_pointer::wildcard() == "*");
+}
+
+BOOST_AUTO_TEST_CASE(construction)
+{
+    BOOST_TEST_PASSPOINT();
+
+    {
+        [[maybe_unused]] const tetengo::json::json_pointer pointer{ "" };
+    }
+    {
+        [[maybe_unused]] const tetengo::json::json_pointer pointer{ "/hoge/0/~0~1" };
+    }
+    {
+        BOOST_CHECK_THROW(
+            [[maybe_unused]] const tetengo::json::json_pointer pointer{ "hoge" }, std::invalid_argument);
+    }
+    {
+        BOOST_CHECK_THROW(
+            [[maybe_unused]] const tetengo::json::json_pointer pointer{ "/ho~ge" }, std::invalid_argument);
+    }
+    {
+        BOOST_CHECK_THROW(
+            [[maybe_unused]] const tetengo::json::json_pointer pointer{ "/hoge~" }, std::invalid_argument);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(reference_tokens)
+{
+    BOOST_TEST_PASSPOINT();
+
+    {
+        const tetengo::json::json_pointer pointer{ "" };
+
+        BOOST_TEST(std::empty(pointer.reference_tokens()));
+    }
+    {
+        const tetengo::json::json_pointer pointer{ "/" };
+
+        const std::vector<std::string> expected{ "" };
+        BOOST_CHECK(pointer.reference_tokens() == expected);
+    }
+    {
+        const tetengo::json::json_pointer pointer{ "/hoge/0/*" };
+
+        const std::vector<std::string> expected{ "hoge", "0", "*" };
+        BOOST_CHECK(pointer.reference_tokens() == expected);
+    }
+    {
+        const tetengo::json::json_pointer pointer{ "/a~1b/m~0n//~01" };
+
+        const std::vector<std::string> expected{ "a/b", "m~n", "", "~1" };
+        BOOST_CHECK(pointer.reference_tokens() == expected);
+    }
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,386 @@
+/*! \file
+    \brief A memory-mapped file reader.
+
+    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
+*/
+
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include <boost/core/noncopyable.hpp>
+#include <boost/preprocessor.hpp>
+#include <boost/scope_exit.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <tetengo/json/mmap_reader.hpp>
+#include <tetengo/json/reader.h>
+#include <tetengo/text/encoder.hpp>
+#include <tetengo/text/encoding/utf8.hpp>
+
+
+namespace
+{
+    const std::string file_content{ "Shikoku Mannaka" };
+
+    class temporary_file : private boost::noncopyable
+    {
+    public:
+        explicit temporary_file(const std::string& content) : m_path{ make_temporary_path() }
+        {
+            write_content_to_file(m_path, content);
+        }
+
+        ~temporary_file()
+        {
+            std::filesystem::remove(m_path);
+        }
+
+        const std::filesystem::path path() const
+        {
+            return m_path;
+        }
+
+    private:
+        static std::filesystem::path make_temporary_path()
+        {
+            auto path = std::filesystem::temp_directory_path();
+            path /= "test_tetengo.json.mmap_reader";
+            return path;
+        }
+
+        static void write_content_to_file(const std::filesystem::path& path, const std::string& content)
+        {
+            if (std::filesystem::exists(path))
+            {
+                throw std::runtime_error{ "The temporary file already exists. Remove it if possible." };
+            }
+            std::ofstream stream{ path, std::ios_base::binary };
+            if (!stream)
+            {
+                throw std::runtime_error{ "Can't create a temporary file." };
+            }
+
+            stream.write(std::data(content), content.length());
+        }
+
+        const std::filesystem::path m_path;
+    };
+
+    std::string to_internal_encoding_path_string(const std::filesystem::path& path)
+    {
+        static const tetengo::text::encoder<tetengo::text::encoding::utf8> encoder{};
+        return std::string{ encoder.decode(path.u8string()) };
+    }
+
+
+}
+
+
+BOOST_AUTO_TEST_SUITE(test_tetengo)
+BOOST_AUTO_TEST_SUITE(json)
+BOOST_AUTO_TEST_SUITE(mmap_reader)
+
+
+BOOST_AUTO_TEST_CASE(construction)
+{
+    BOOST_TEST_PASSPOINT();
+
+    {
+        const temporary_file file{ file_content };
+
+        const tetengo::json::mmap_reader reader{ file.path() };
+    }
+    {
+        const temporary_file file{ "" };
+
+        const tetengo::json::mmap_reader reader{ file.path() };
+    }
+    {
+        BOOST_CHECK_THROW(const tetengo::json::mmap_reader reader{ "NONEXISTENT_FILE" }, std::ios_base::failure);
+    }
+
+    {
+        const temporary_file file{ file_content };
+
+        const auto* const p_reader =
+            tetengo_json_reader_createMmapReader(to_internal_encoding_path_string(file.path()).c_str());
+        BOOST_SCOPE_EXIT(p_reader)
+        {
+            tetengo_json_reader_destroy(p_reader);
+        }
+        BOOST_SCOPE_EXIT_END;
+        BOOST_TEST(p_reader);
+    }
+    {
+        const auto* const p_reader = tetengo_json_reader_createMmapReader("NONEXISTENT_FILE");
+        BOOST_TEST(!p_reader);
+    }
+    {
+        const auto* const p_reader = tetengo_json_reader_createMmapReader(nullptr);
+        BOOST_TEST(!p_reader);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(content)
+{
+    BOOST_TEST_PASSPOINT();
+
+    {
+        const temporary_file file{ file_content };
+
+        const tetengo::json::mmap_reader reader{ file.path() };
+
+        BOOST_TEST(reader.content() == file_content);
+    }
+    {
+        const temporary_file file{ "" };
+
+        const tetengo::json::mmap_reader reader{ file.path() };
+
+        BOOST_TEST(std::empty(reader.content()));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(has_next)
+{
+    BOOST_TEST_PASSPOINT();
+
+    {
+        const temporary_file file{ file_content };
+
+        const tetengo::json::mmap_reader reader{ file.path() };
+
+        BOOST_TEST(reader.has_next());
+    }
+    {
+        const temporary_file file{ "" };
+
+        const tetengo::json::mmap_reader reader{ file.path() };
+
+        BOOST_TEST(!reader.has_next());
+    }
+
+    {
+        const temporary_file file{ file_content };
+
+        const auto* const p_reader =
+            tetengo_json_reader_createMmapReader(to_internal_encoding_path_string(file.path()).c_str());
+        BOOST_SCOPE_EXIT(p_reader)
+        {
+            tetengo_json_reader_destroy(p_reader);
+        }
+        BOOST_SCOPE_EXIT_END;
+        BOOST_TEST_REQUIRE(p_reader);
+
+        BOOST_TEST(tetengo_json_reader_hasNext(p_reader));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(peek)
+{
+    BOOST_TEST_PASSPOINT();
+
+    {
+        const temporary_file file{ file_content };
+
+        const tetengo::json::mmap_reader reader{ file.path() };
+
+        BOOST_TEST(reader.peek() == 'S');
+    }
+    {
+        const temporary_file file{ "" };
+
+        const tetengo::json::mmap_reader reader{ file.path() };
+
+        BOOST_CHECK_THROW([[maybe_unused]] const auto& peeked = reader.peek(), std::logic_error);
+    }
+
+    {
+        const temporary_file file{ file_content };
+
+        const auto* const p_reader =
+            tetengo_json_reader_createMmapReader(to_internal_encoding_path_string(file.path()).c_str());
+        BOOST_SCOPE_EXIT(p_reader)
+        {
+            tetengo_json_reader_destroy(p_reader);
+        }
+        BOOST_SCOPE_EXIT_END;
+        BOOST_TEST_REQUIRE(p_reader);
+
+        BOOST_TEST(tetengo_json_reader_peek(p_reader) == 'S');
+    }
+}
+
+BOOST_AUTO_TEST_CASE(next)
+{
+    BOOST_TEST_PASSPOINT();
+
+    {
+        const temporary_file file{ file_content };
+
+        tetengo::json::mmap_reader reader{ file.path() };
+
+        std::string read{};
+        while (reader.has_next())
+        {
+            read.push_back(reader.peek());
+            reader.next();
+        }
+        BOOST_TEST(read == file_content);
+
+        BOOST_CHECK_THROW([[maybe_unused]] const auto& peeked = reader.peek(), std::logic_error);
+        BOOST_CHECK_THROW(reader.next(), std::logic_error);
+    }
+
+    {
+        const temporary_file file{ file_content };
+
+        auto* const p_reader =
+            tetengo_json_reader_createMmapReader(to_internal_encoding_path_string(file.path()).c_str());
+        BOOST_SCOPE_EXIT(p_reader)
+        {
+            tetengo_json_reader_destroy(p_reader);
+        }
+        BOOST_SCOPE_EXIT_END;
+        BOOST_TEST_REQUIRE(p_reader);
+
+        std::string read{};
+        while (tetengo_json_reader_hasNext(p_reader))
+        {
+            read.push_back(tetengo_json_reader_peek(p_reader));
+            tetengo_json_reader_next(p_reader);
+        }
+        BOOST_TEST(read == file_content);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(peek_chunk)
+{
+    BOOST_TEST_PASSPOINT();
+
+    {
+        const temporary_file file{ file_content };
+
+        tetengo::json::mmap_reader reader{ file.path() };
+
+        BOOST_TEST(reader.peek_chunk() == file_content);
+        BOOST_TEST(std::data(reader.peek_chunk()) == std::data(reader.content()));
+
+        reader.next();
+        BOOST_TEST(reader.peek_chunk() == "hikoku Mannaka");
+    }
+    {
+        const temporary_file file{ "" };
+
+        const tetengo::json::mmap_reader reader{ file.path() };
+
+        BOOST_TEST(std::empty(reader.peek_chunk()));
+    }
+
+    {
+        const temporary_file file{ file_content };
+
+        auto* const p_reader =
+            tetengo_json_reader_createMmapReader(to_internal_encoding_path_string(file.path()).c_str());
+        BOOST_SCOPE_EXIT(p_reader)
+        {
+            tetengo_json_reader_destroy(p_reader);
+        }
+        BOOST_SCOPE_EXIT_END;
+        BOOST_TEST_REQUIRE(p_reader);
+
+        const char* p_chunk = nullptr;
+        const auto  length = tetengo_json_reader_peekChunk(p_reader, &p_chunk);
+        BOOST_TEST((std::string_view{ p_chunk, length } == file_content));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(consume)
+{
+    BOOST_TEST_PASSPOINT();
+
+    {
+        const temporary_file file{ file_content };
+
+        tetengo::json::mmap_reader reader{ file.path() };
+
+        reader.consume(8);
+        BOOST_TEST(reader.peek() == 'M');
+        BOOST_TEST(reader.peek_chunk() == "Mannaka");
+
+        BOOST_CHECK_THROW(reader.consume(8), std::logic_error);
+
+        reader.consume(7);
+        BOOST_TEST(!reader.has_next());
+    }
+
+    {
+        const temporary_file file{ file_content };
+
+        auto* const p_reader =
+            tetengo_json_reader_createMmapReader(to_internal_encoding_path_string(file.path()).c_str());
+        BOOST_SCOPE_EXIT(p_reader)
+        {
+            tetengo_json_reader_destroy(p_reader);
+        }
+        BOOST_SCOPE_EXIT_END;
+        BOOST_TEST_REQUIRE(p_reader);
+
+        tetengo_json_reader_consume(p_reader, 8);
+        BOOST_TEST(tetengo_json_reader_peek(p_reader) == 'M');
+    }
+}
+
+BOOST_AUTO_TEST_CASE(chunks_persistent)
+{
+    BOOST_TEST_PASSPOINT();
+
+    {
+        const temporary_file file{ file_content };
+
+        tetengo::json::mmap_reader reader{ file.path() };
+
+        BOOST_TEST(reader.chunks_persistent());
+
+        const auto chunk = reader.peek_chunk();
+        reader.consume(8);
+        BOOST_TEST(chunk == file_content);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(base_reader)
+{
+    BOOST_TEST_PASSPOINT();
+
+    {
+        const temporary_file file{ file_content };
+
+        const tetengo::json::mmap_reader reader{ file.path() };
+
+        BOOST_CHECK_THROW([[maybe_unused]] const auto& base_reader = reader.base_reader(), std::logic_error);
+    }
+
+    {
+        const temporary_file file{ file_content };
+
+        const auto* const p_reader =
+            tetengo_json_reader_createMmapReader(to_internal_encoding_path_string(file.path()).c_str());
+        BOOST_SCOPE_EXIT(p_reader)
+        {
+            tetengo_json_reader_destroy(p_reader);
+        }
+        BOOST_SCOPE_EXIT_END;
+        BOOST_TEST_REQUIRE(p_reader);
+
+        BOOST_TEST(!tetengo_json_reader_baseReader(p_reader));
+    }
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,239 @@
+/*! \file
+    \brief An NDJSON parser.
+
+    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
+*/
+
+#include <cstddef>
+#include <memory>
+#include <sstream> // IWYU pragma: keep
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include <boost/preprocessor.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <tetengo/json/element.hpp>
+#include <tetengo/json/file_location.hpp>
+#include <tetengo/json/json_grammar.hpp>
+#include <tetengo/json/json_parser.hpp>
+#include <tetengo/json/ndjson_parser.hpp>
+#include <tetengo/json/reader.hpp>
+#include <tetengo/json/stream_reader.hpp>
+
+
+namespace
+{
+    // clang-format off
+    const std::string ndjson0{
+        "{ \"name\": \"Kumamoto\", \"code\": [ 1, 2 ] }\n"
+        "\n"
+        "\"Aso\"\r\n"
+        "  \n"
+        "{ \"name\": \"Oita\", \"code\": null }"
+    };
+    // clang-format on
+
+    // clang-format off
+    const std::string ndjson1{
+        "{ \"name\": \"Kumamoto\" }\n"
+        "{ \"name\": \"Aso\", }\n"
+        "{ \"name\": \"Oita\" }\n"
+    };
+    // clang-format on
+
+    std::unique_ptr<tetengo::json::reader> make_reader(const std::string& text)
+    {
+        return std::make_unique<tetengo::json::stream_reader>(std::make_unique<std::istringstream>(text), 10);
+    }
+
+    std::unique_ptr<tetengo::json::json_parser> make_json_parser(const std::string& json)
+    {
+        return std::make_unique<tetengo::json::json_parser>(
+            make_reader(json),
+            tetengo::json::json_parser::default_buffer_capacity(),
+            tetengo::json::json_grammar::backend_type::hand_written,
+            tetengo::json::json_parser::parsing_mode_type::synchronous);
+    }
+
+    std::string make_large_ndjson(const std::size_t line_count)
+    {
+        std::string text{};
+        for (auto i = static_cast<std::size_t>(0); i < line_count; ++i)
+        {
+            text += "{ \"id\": " + std::to_string(i) + ", \"padding\": \"" + std::string(i % 50, 'x') + "\" }\n";
+        }
+        return text;
+    }
+
+
+}
+
+
+BOOST_AUTO_TEST_SUITE(test_tetengo)
+BOOST_AUTO_TEST_SUITE(json)
+BOOST_AUTO_TEST_SUITE(ndjson_parser)
+
+
+BOOST_AUTO_TEST_CASE(default_thread_count)
+{
+    BOOST_TEST_PASSPOINT();
+
+    BOOST_TEST(tetengo::json::ndjson_parser::default_thread_count() > 0U);
+}
+
+BOOST_AUTO_TEST_CASE(construction)
+{
+    BOOST_TEST_PASSPOINT();
+
+    {
+        const tetengo::json::ndjson_parser parser{ make_reader(ndjson0) };
+    }
+    {
+        const tetengo::json::ndjson_parser parser{ make_reader(ndjson0), 3, 1 };
+    }
+    {
+        BOOST_CHECK_THROW(
+            const tetengo::json::ndjson_parser parser{ std::unique_ptr<tetengo::json::reader>{} },
+            std::invalid_argument);
+    }
+    {
+        BOOST_CHECK_THROW(const tetengo::json::ndjson_parser parser(make_reader(ndjson0), 0), std::invalid_argument);
+    }
+    {
+        BOOST_CHECK_THROW(
+            const tetengo::json::ndjson_parser parser(make_reader(ndjson0), 1, 0), std::invalid_argument);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(has_next)
+{
+    BOOST_TEST_PASSPOINT();
+
+    {
+        const tetengo::json::ndjson_parser parser{ make_reader(ndjson0) };
+
+        BOOST_TEST(parser.has_next());
+    }
+    {
+        const tetengo::json::ndjson_parser parser{ make_reader("") };
+
+        BOOST_TEST(!parser.has_next());
+    }
+    {
+        const tetengo::json::ndjson_parser parser{ make_reader(" \n\n\t\n") };
+
+        BOOST_TEST(!parser.has_next());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(peek)
+{
+    BOOST_TEST_PASSPOINT();
+
+    {
+        const tetengo::json::ndjson_parser parser{ make_reader(ndjson0) };
+
+        BOOST_TEST_REQUIRE(parser.has_next());
+        const auto& element_ = parser.peek();
+        BOOST_CHECK(element_.type().name == tetengo::json::element::type_name_type::object);
+        BOOST_CHECK(element_.type().category == tetengo::json::element::type_category_type::structure_open);
+        BOOST_TEST(element_.get_file_location().line_index() == 0U);
+    }
+    {
+        const tetengo::json::ndjson_parser parser{ make_reader("") };
+
+        BOOST_CHECK_THROW([[maybe_unused]] const auto& element_ = parser.peek(), std::logic_error);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(next)
+{
+    BOOST_TEST_PASSPOINT();
+
+    for (const auto thread_count: { 1U, 2U, 4U })
+    {
+        tetengo::json::ndjson_parser parser{ make_reader(ndjson0), thread_count, 1 };
+
+        const std::pair<std::string, std::size_t> records[] = {
+            { "{ \"name\": \"Kumamoto\", \"code\": [ 1, 2 ] }\n", 0 },
+            { "\"Aso\"\r\n", 2 },
+            { "{ \"name\": \"Oita\", \"code\": null }", 4 },
+        };
+        for (const auto& [record, line_index]: records)
+        {
+            const auto p_expected_parser = make_json_parser(record);
+            while (p_expected_parser->has_next())
+            {
+                BOOST_TEST_REQUIRE(parser.has_next());
+                const auto& expected = p_expected_parser->peek();
+                const auto& actual = parser.peek();
+                BOOST_CHECK(actual.type().name == expected.type().name);
+                BOOST_CHECK(actual.type().category == expected.type().category);
+                BOOST_TEST(actual.value() == expected.value());
+                BOOST_CHECK(actual.attributes() == expected.attributes());
+                BOOST_TEST(actual.get_file_location().line() == expected.get_file_location().line());
+                BOOST_TEST(
+                    actual.get_file_location().line_index() ==
+                    expected.get_file_location().line_index() + line_index);
+                BOOST_TEST(actual.get_file_location().column_index() == expected.get_file_location().column_index());
+
+                p_expected_parser->next();
+                parser.next();
+            }
+        }
+        BOOST_TEST(!parser.has_next());
+        BOOST_CHECK_THROW(parser.next(), std::logic_error);
+    }
+    {
+        const auto                   line_count = static_cast<std::size_t>(20000);
+        tetengo::json::ndjson_parser parser{ make_reader(make_large_ndjson(line_count)), 4, 3 };
+
+        auto id = static_cast<std::size_t>(0);
+        while (parser.has_next())
+        {
+            const auto& element_ = parser.peek();
+            if (element_.type().name == tetengo::json::element::type_name_type::number)
+            {
+                BOOST_TEST_REQUIRE(element_.value() == std::to_string(id));
+                BOOST_TEST_REQUIRE(element_.get_file_location().line_index() == id);
+                ++id;
+            }
+            parser.next();
+        }
+        BOOST_TEST(id == line_count);
+    }
+    {
+        tetengo::json::ndjson_parser parser{ make_reader(ndjson1), 2 };
+
+        auto element_count = static_cast<std::size_t>(0);
+        try
+        {
+            while (parser.has_next())
+            {
+                [[maybe_unused]] const auto& element_ = parser.peek();
+                ++element_count;
+                parser.next();
+            }
+            BOOST_ERROR("No exception.");
+        }
+        catch (const std::runtime_error&)
+        {}
+        BOOST_TEST(element_count == 9U);
+    }
+    {
+        tetengo::json::ndjson_parser parser{ make_reader(make_large_ndjson(20000)), 4, 1 };
+
+        for (auto i = 0; i < 10; ++i)
+        {
+            BOOST_TEST_REQUIRE(parser.has_next());
+            parser.next();
+        }
+    }
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
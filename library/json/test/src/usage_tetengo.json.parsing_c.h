@@ -1,24 +1,24 @@
-/*! \file
-    \brief The usage of JSON parsing.
-
-    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
-*/
-
-
-#if !defined(USAGETETENGO_JSON_PARSING_C_H)
-#define USAGETETENGO_JSON_PARSING_C_H
-
-
-#if defined(__cplusplus)
-extern "C" {
-#endif
-
-void usage_tetengo_json_parsing();
-
-
-#if defined(__cplusplus)
-}
-#endif
-
-
-#endif
+/*! \file
+    \brief The usage of JSON parsing.
+
+    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
+*/
+
+
+#if !defined(USAGETETENGO_JSON_PARSING_C_H)
+#define USAGETETENGO_JSON_PARSING_C_H
+
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+void usage_tetengo_json_parsing();
+
+
+#if defined(__cplusplus)
+}
+#endif
+
+
+#endif
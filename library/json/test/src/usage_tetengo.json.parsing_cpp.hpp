@@ -1,20 +1,20 @@
-/*! \file
-    \brief The usage of JSON parsing.
-
-    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
-*/
-
-
-#if !defined(USAGETETENGO_JSON_PARSING_CPP_HPP)
-#define USAGETETENGO_JSON_PARSING_CPP_HPP
-
-
-namespace usage_tetengo::json
-{
-    void parsing();
-
-
-}
-
-
-#endif
+/*! \file
+    \brief The usage of JSON parsing.
+
+    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
+*/
+
+
+#if !defined(USAGETETENGO_JSON_PARSING_CPP_HPP)
+#define USAGETETENGO_JSON_PARSING_CPP_HPP
+
+
+namespace usage_tetengo::json
+{
+    void parsing();
+
+
+}
+
+
+#endif
@@ -0,0 +1,114 @@
+/*! \file
+    \brief A batch analyzer.
+
+    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
+*/
+
+#if !defined(TETENGO_LATTICE_BATCHANALYZER_H)
+#define TETENGO_LATTICE_BATCHANALYZER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include <tetengo/lattice/entry.h>
+#include <tetengo/lattice/input.h>
+#include <tetengo/lattice/vocabulary.h>
+
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#if !defined(DOCUMENTATION)
+typedef struct tetengo_lattice_batchAnalyzer_tag tetengo_lattice_batchAnalyzer_t;
+#endif
+
+
+/*!
+    \brief Creates a batch analyzer.
+
+    \param p_vocabulary A pointer to a vocabulary. It must be safe for concurrent reads.
+    \param thread_count A thread count. When 0, the hardware concurrency is used.
+
+    \return A pointer to a batch analyzer. Or NULL when p_vocabulary is NULL.
+*/
+tetengo_lattice_batchAnalyzer_t*
+tetengo_lattice_batchAnalyzer_create(const tetengo_lattice_vocabulary_t* p_vocabulary, size_t thread_count);
+
+/*!
+    \brief Destroys a batch analyzer.
+
+    \param p_analyzer A pointer to a batch analyzer.
+*/
+void tetengo_lattice_batchAnalyzer_destroy(const tetengo_lattice_batchAnalyzer_t* p_analyzer);
+
+/*!
+    \brief Returns the thread count.
+
+    \param p_analyzer A pointer to a batch analyzer.
+
+    \return The thread count. Or 0 when p_analyzer is NULL.
+*/
+size_t tetengo_lattice_batchAnalyzer_threadCount(const tetengo_lattice_batchAnalyzer_t* p_analyzer);
+
+/*!
+    \brief Analyzes inputs.
+
+    The ownership of the inputs pointed by p_inputs is transferred into the batch analyzer.
+    There is no need to destroy the inputs after calling this function.
+
+    The results of the previous analysis are discarded.
+
+    \param p_analyzer     A pointer to a batch analyzer.
+    \param p_inputs       A pointer to the inputs of all the analyses, concatenated.
+    \param p_input_counts A pointer to the input counts of the analyses.
+    \param analysis_count An analysis count.
+    \param n              The maximum path count for each analysis.
+
+    \retval true  When the inputs are analyzed.
+    \retval false Otherwise.
+*/
+bool tetengo_lattice_batchAnalyzer_analyze(
+    tetengo_lattice_batchAnalyzer_t* p_analyzer,
+    tetengo_lattice_input_t* const*  p_inputs,
+    const size_t*                    p_input_counts,
+    size_t                           analysis_count,
+    size_t                           n);
+
+/*!
+    \brief Returns the path count of an analysis.
+
+    \param p_analyzer     A pointer to a batch analyzer.
+    \param analysis_index An analysis index.
+
+    \return The path count. Or 0 when p_analyzer is NULL or analysis_index is too large.
+*/
+size_t tetengo_lattice_batchAnalyzer_pathCount(
+    const tetengo_lattice_batchAnalyzer_t* p_analyzer,
+    size_t                                 analysis_index);
+
+/*!
+    \brief Returns a path of an analysis.
+
+    \param p_analyzer     A pointer to a batch analyzer.
+    \param analysis_index An analysis index.
+    \param path_index     A path index.
+    \param p_entries      The storage for output entries except BOS and EOS. Can be NULL.
+    \param p_cost         The storage for an output cost. Can be NULL.
+
+    \return An entry count. Or 0 when p_analyzer is NULL or analysis_index or path_index is too large.
+*/
+size_t tetengo_lattice_batchAnalyzer_path(
+    const tetengo_lattice_batchAnalyzer_t* p_analyzer,
+    size_t                                 analysis_index,
+    size_t                                 path_index,
+    tetengo_lattice_entryView_t*           p_entries,
+    int*                                   p_cost);
+
+
+#if defined(__cplusplus)
+}
+#endif
+
+
+#endif
@@ -1,147 +1,198 @@
-/*! \file
-    \brief A vocabulary.
-
-    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
-*/
-
-#if !defined(TETENGO_LATTICE_VOCABULARY_H)
-#define TETENGO_LATTICE_VOCABULARY_H
-
-#include <stdbool.h>
-#include <stddef.h>
-
-#include <tetengo/lattice/connection.h>
-#include <tetengo/lattice/entry.h>
-#include <tetengo/lattice/input.h>
-#include <tetengo/lattice/node.h>
-
-
-#if defined(__cplusplus)
-extern "C" {
-#endif
-
-#if !defined(DOCUMENTATION)
-typedef struct tetengo_lattice_vocabulary_tag tetengo_lattice_vocabulary_t;
-#endif
-
-
-/*!
-    \brief Creates an unordered map vocabulary.
-
-    \param p_entries        A pointer to entries.
-    \param entry_count      An entry count.
-    \param p_connections    A pointer to connections.
-    \param connection_count A connection count.
-    \param p_entry_hash     A pointer to a hash function for an entry.
-    \param p_entry_equal_to A pointer to an eqaul_to function for an entry.
-
-    \return A pointer to an unordered map vocabulary.
-            Or NULL when p_entries and/or p_connections are NULL, and entry_count and/or connection_count are greater
-            than 0.
-*/
-tetengo_lattice_vocabulary_t* tetengo_lattice_vocabulary_createUnorderedMapVocabulary(
-    const tetengo_lattice_keyEntriesPair_t*            p_entries,
-    size_t                                             entry_count,
-    const tetengo_lattice_entriesConnectionCostPair_t* p_connections,
-    size_t                                             connection_count,
-    size_t (*p_entry_hash)(const tetengo_lattice_entryView_t*),
-    int (*p_entry_equal_to)(const tetengo_lattice_entryView_t*, const tetengo_lattice_entryView_t*));
-
-/*!
-    \brief A custom vocabulary definition.
-*/
-typedef struct tetengo_lattice_customVocabularyDefinition_tag
-{
-    /*! The pointer to the context. */
-    void* p_context;
-
-    /*!
-        \brief The procedure for findEntries.
-
-        Parameters
-        - p_context: A pointer to the context.
-        - p_key:     A pointer to a key.
-        - p_entries: The storage for output entries. Can be NULL.
-
-        \return An entry count.
-    */
-    size_t (*find_entries_proc)(
-        void*                          p_context,
-        const tetengo_lattice_input_t* p_key,
-        tetengo_lattice_entryView_t*   p_entries);
-
-    /*!
-        \brief The procedure for findConnection.
-
-        Parameters
-        - p_context:    A pointer to the context.
-        - p_from:       A pointer to an origin node.
-        - p_to:         A pointer to a destination entry.
-        - p_connection: The storage for an output connection.
-
-        \retval true  When an output connection is stored.
-        \retval false Otherwise.
-    */
-    bool (*find_connection_proc)(
-        void*                              p_context,
-        const tetengo_lattice_node_t*      p_from,
-        const tetengo_lattice_entryView_t* p_to,
-        tetengo_lattice_connection_t*      p_connection);
-
-} tetengo_lattice_customVocabularyDefinition_t;
-
-/*!
-    \brief Creates a custom vocabulary.
-
-    \param p_definition A pointer to a definition.
-
-    \return A pointer to a custom vocabulary. Or NULL when p_definition NULL
-*/
-tetengo_lattice_vocabulary_t*
-tetengo_lattice_vocabulary_createCustomVocabulary(const tetengo_lattice_customVocabularyDefinition_t* p_definition);
-
-/*!
-    \brief Destroys a vocabulary.
-
-    \param p_vocabulary A pointer to a vocabulary.
-*/
-void tetengo_lattice_vocabulary_destroy(const tetengo_lattice_vocabulary_t* p_vocabulary);
-
-/*!
-    \brief Finds entries.
-
-    \param p_vocabulary A pointer to a vocabulary.
-    \param p_key        A pointer to a key.
-    \param p_entries    The storage for output entries. Can be NULL.
-
-    \return An entry count.
-*/
-size_t tetengo_lattice_vocabulary_findEntries(
-    const tetengo_lattice_vocabulary_t* p_vocabulary,
-    const tetengo_lattice_input_t*      p_key,
-    tetengo_lattice_entryView_t*        p_entries);
-
-/*!
-    \brief Finds a connection between entries.
-
-    \param p_vocabulary A pointer to a vocabulary.
-    \param p_from       A pointer to an origin node.
-    \param p_to         A pointer to a destination entry.
-    \param p_connection The storage for an output connection.
-
-    \retval true  When an output connection is stored.
-    \retval false Otherwise.
-*/
-bool tetengo_lattice_vocabulary_findConnection(
-    const tetengo_lattice_vocabulary_t* p_vocabulary,
-    const tetengo_lattice_node_t*       p_from,
-    const tetengo_lattice_entryView_t*  p_to,
-    tetengo_lattice_connection_t*       p_connection);
-
-
-#if defined(__cplusplus)
-}
-#endif
-
-
-#endif
+/*! \file
+    \brief A vocabulary.
+
+    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
+*/
+
+#if !defined(TETENGO_LATTICE_VOCABULARY_H)
+#define TETENGO_LATTICE_VOCABULARY_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include <tetengo/lattice/connection.h>
+#include <tetengo/lattice/entry.h>
+#include <tetengo/lattice/input.h>
+#include <tetengo/lattice/node.h>
+
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#if !defined(DOCUMENTATION)
+typedef struct tetengo_lattice_vocabulary_tag tetengo_lattice_vocabulary_t;
+#endif
+
+
+/*!
+    \brief Creates an unordered map vocabulary.
+
+    \param p_entries        A pointer to entries.
+    \param entry_count      An entry count.
+    \param p_connections    A pointer to connections.
+    \param connection_count A connection count.
+    \param p_entry_hash     A pointer to a hash function for an entry.
+    \param p_entry_equal_to A pointer to an eqaul_to function for an entry.
+
+    \return A pointer to an unordered map vocabulary.
+            Or NULL when p_entries and/or p_connections are NULL, and entry_count and/or connection_count are greater
+            than 0.
+*/
+tetengo_lattice_vocabulary_t* tetengo_lattice_vocabulary_createUnorderedMapVocabulary(
+    const tetengo_lattice_keyEntriesPair_t*            p_entries,
+    size_t                                             entry_count,
+    const tetengo_lattice_entriesConnectionCostPair_t* p_connections,
+    size_t                                             connection_count,
+    size_t (*p_entry_hash)(const tetengo_lattice_entryView_t*),
+    int (*p_entry_equal_to)(const tetengo_lattice_entryView_t*, const tetengo_lattice_entryView_t*));
+
+/*!
+    \brief A custom vocabulary definition.
+
+    The procedures may be called concurrently from multiple threads, as tetengo_lattice_batchAnalyzer does.
+    The keys and the values that find_entries_proc returns must be valid as long as the vocabulary lives.
+*/
+typedef struct tetengo_lattice_customVocabularyDefinition_tag
+{
+    /*! The pointer to the context. */
+    void* p_context;
+
+    /*!
+        \brief The procedure for findEntries.
+
+        Parameters
+        - p_context: A pointer to the context.
+        - p_key:     A pointer to a key.
+        - p_entries: The storage for output entries. Can be NULL.
+
+        \return An entry count.
+    */
+    size_t (*find_entries_proc)(
+        void*                          p_context,
+        const tetengo_lattice_input_t* p_key,
+        tetengo_lattice_entryView_t*   p_entries);
+
+    /*!
+        \brief The procedure for findConnection.
+
+        Parameters
+        - p_context:    A pointer to the context.
+        - p_from:       A pointer to an origin node.
+        - p_to:         A pointer to a destination entry.
+        - p_connection: The storage for an output connection.
+
+        \retval true  When an output connection is stored.
+        \retval false Otherwise.
+    */
+    bool (*find_connection_proc)(
+        void*                              p_context,
+        const tetengo_lattice_node_t*      p_from,
+        const tetengo_lattice_entryView_t* p_to,
+        tetengo_lattice_connection_t*      p_connection);
+
+} tetengo_lattice_customVocabularyDefinition_t;
+
+/*!
+    \brief Creates a custom vocabulary.
+
+    \param p_definition A pointer to a definition.
+
+    \return A pointer to a custom vocabulary. Or NULL when p_definition NULL
+*/
+tetengo_lattice_vocabulary_t*
+tetengo_lattice_vocabulary_createCustomVocabulary(const tetengo_lattice_customVocabularyDefinition_t* p_definition);
+
+/*!
+    \brief Creates a custom vocabulary with a procedure for findConnections.
+
+    find_connections_proc is called with all the nodes of a preceding step instead of calling find_connection_proc in
+    the definition for each of them. It is called with p_context in the definition.
+
+    Parameters of find_connections_proc
+    - p_context:  A pointer to the context.
+    - p_froms:    A pointer to origin nodes.
+    - from_count: An origin node count.
+    - p_to:       A pointer to a destination entry.
+    - p_costs:    The storage for output costs. Its length is from_count.
+
+    find_connections_proc returns true when output costs are stored, or false otherwise.
+
+    \param p_definition          A pointer to a definition.
+    \param find_connections_proc A procedure for findConnections.
+
+    \return A pointer to a custom vocabulary. Or NULL when p_definition or find_connections_proc is NULL.
+*/
+tetengo_lattice_vocabulary_t* tetengo_lattice_vocabulary_createCustomVocabularyWithConnections(
+    const tetengo_lattice_customVocabularyDefinition_t* p_definition,
+    bool (*find_connections_proc)(
+        void*                              p_context,
+        const tetengo_lattice_node_t*      p_froms,
+        size_t                             from_count,
+        const tetengo_lattice_entryView_t* p_to,
+        int*                               p_costs));
+
+/*!
+    \brief Destroys a vocabulary.
+
+    \param p_vocabulary A pointer to a vocabulary.
+*/
+void tetengo_lattice_vocabulary_destroy(const tetengo_lattice_vocabulary_t* p_vocabulary);
+
+/*!
+    \brief Finds entries.
+
+    \param p_vocabulary A pointer to a vocabulary.
+    \param p_key        A pointer to a key.
+    \param p_entries    The storage for output entries. Can be NULL.
+
+    \return An entry count.
+*/
+size_t tetengo_lattice_vocabulary_findEntries(
+    const tetengo_lattice_vocabulary_t* p_vocabulary,
+    const tetengo_lattice_input_t*      p_key,
+    tetengo_lattice_entryView_t*        p_entries);
+
+/*!
+    \brief Finds a connection between entries.
+
+    \param p_vocabulary A pointer to a vocabulary.
+    \param p_from       A pointer to an origin node.
+    \param p_to         A pointer to a destination entry.
+    \param p_connection The storage for an output connection.
+
+    \retval true  When an output connection is stored.
+    \retval false Otherwise.
+*/
+bool tetengo_lattice_vocabulary_findConnection(
+    const tetengo_lattice_vocabulary_t* p_vocabulary,
+    const tetengo_lattice_node_t*       p_from,
+    const tetengo_lattice_entryView_t*  p_to,
+    tetengo_lattice_connection_t*       p_connection);
+
+/*!
+    \brief Finds connection costs between origin nodes and a destination entry.
+
+    \param p_vocabulary A pointer to a vocabulary.
+    \param p_froms      A pointer to origin nodes.
+    \param from_count   An origin node count.
+    \param p_to         A pointer to a destination entry.
+    \param p_costs      The storage for output costs. Its length must be from_count.
+
+    \retval true  When output costs are stored.
+    \retval false Otherwise.
+*/
+bool tetengo_lattice_vocabulary_findConnections(
+    const tetengo_lattice_vocabulary_t* p_vocabulary,
+    const tetengo_lattice_node_t*       p_froms,
+    size_t                              from_count,
+    const tetengo_lattice_entryView_t*  p_to,
+    int*                                p_costs);
+
+
+#if defined(__cplusplus)
+}
+#endif
+
+
+#endif
@@ -0,0 +1,232 @@
+/*! \file
+    \brief A batch analyzer.
+
+    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
+*/
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <stddef.h>
+
+#include <boost/preprocessor.hpp>
+#include <boost/scope_exit.hpp>
+
+#include <tetengo/lattice/batchAnalyzer.h>
+#include <tetengo/lattice/batch_analyzer.hpp>
+#include <tetengo/lattice/entry.h>
+#include <tetengo/lattice/entry.hpp>
+#include <tetengo/lattice/input.h>
+#include <tetengo/lattice/input.hpp>
+#include <tetengo/lattice/vocabulary.h>
+
+#include "tetengo_lattice_input.hpp"
+#include "tetengo_lattice_vocabulary.hpp"
+
+
+struct tetengo_lattice_batchAnalyzer_tag
+{
+    std::unique_ptr<tetengo::lattice::batch_analyzer> p_cpp_analyzer;
+
+    std::vector<std::vector<tetengo::lattice::analyzed_path>> results;
+
+    explicit tetengo_lattice_batchAnalyzer_tag(std::unique_ptr<tetengo::lattice::batch_analyzer>&& p_cpp_analyzer) :
+    p_cpp_analyzer{ std::move(p_cpp_analyzer) },
+    results{}
+    {}
+};
+
+tetengo_lattice_batchAnalyzer_t* tetengo_lattice_batchAnalyzer_create(
+    const tetengo_lattice_vocabulary_t* const p_vocabulary,
+    const size_t                              thread_count)
+{
+    try
+    {
+        if (!p_vocabulary)
+        {
+            throw std::invalid_argument{ "p_vocabulary is NULL." };
+        }
+
+        auto p_cpp_analyzer =
+            std::make_unique<tetengo::lattice::batch_analyzer>(*p_vocabulary->p_cpp_vocabulary, thread_count);
+
+        auto p_instance = std::make_unique<tetengo_lattice_batchAnalyzer_t>(std::move(p_cpp_analyzer));
+        return p_instance.release();
+    }
+    catch (...)
+    {
+        return nullptr;
+    }
+}
+
+void tetengo_lattice_batchAnalyzer_destroy(const tetengo_lattice_batchAnalyzer_t* const p_analyzer)
+{
+    try
+    {
+        const std::unique_ptr<const tetengo_lattice_batchAnalyzer_t> p_instance{ p_analyzer };
+    }
+    catch (...)
+    {}
+}
+
+size_t tetengo_lattice_batchAnalyzer_threadCount(const tetengo_lattice_batchAnalyzer_t* const p_analyzer)
+{
+    try
+    {
+        if (!p_analyzer)
+        {
+            throw std::invalid_argument{ "p_analyzer is NULL." };
+        }
+
+        return p_analyzer->p_cpp_analyzer->thread_count();
+    }
+    catch (...)
+    {
+        return 0;
+    }
+}
+
+bool tetengo_lattice_batchAnalyzer_analyze(
+    tetengo_lattice_batchAnalyzer_t* const p_analyzer,
+    tetengo_lattice_input_t* const* const  p_inputs,
+    const size_t* const                    p_input_counts,
+    const size_t                           analysis_count,
+    const size_t                           n)
+{
+    std::size_t total_input_count = 0;
+    if (p_inputs && p_input_counts)
+    {
+        for (auto i = static_cast<std::size_t>(0); i < analysis_count; ++i)
+        {
+            total_input_count += p_input_counts[i];
+        }
+    }
+    try
+    {
+        BOOST_SCOPE_EXIT(p_inputs, total_input_count)
+        {
+            for (auto i = static_cast<std::size_t>(0); i < total_input_count; ++i)
+            {
+                tetengo_lattice_input_destroy(p_inputs[i]);
+            }
+        }
+        BOOST_SCOPE_EXIT_END;
+
+        if (!p_analyzer)
+        {
+            throw std::invalid_argument{ "p_analyzer is NULL." };
+        }
+        if (!p_inputs && analysis_count > 0)
+        {
+            throw std::invalid_argument{ "p_inputs is NULL." };
+        }
+        if (!p_input_counts && analysis_count > 0)
+        {
+            throw std::invalid_argument{ "p_input_counts is NULL." };
+        }
+
+        p_analyzer->results.clear();
+
+        std::vector<std::vector<std::unique_ptr<tetengo::lattice::input>>> cpp_inputs{};
+        cpp_inputs.reserve(analysis_count);
+        auto input_index = static_cast<std::size_t>(0);
+        for (auto i = static_cast<std::size_t>(0); i < analysis_count; ++i)
+        {
+            std::vector<std::unique_ptr<tetengo::lattice::input>> cpp_analysis_inputs{};
+            cpp_analysis_inputs.reserve(p_input_counts[i]);
+            for (auto j = static_cast<std::size_t>(0); j < p_input_counts[i]; ++j)
+            {
+                if (!p_inputs[input_index])
+                {
+                    throw std::invalid_argument{ "An input is NULL." };
+                }
+                cpp_analysis_inputs.push_back(std::move(p_inputs[input_index]->p_cpp_input()));
+                ++input_index;
+            }
+            cpp_inputs.push_back(std::move(cpp_analysis_inputs));
+        }
+
+        p_analyzer->results = p_analyzer->p_cpp_analyzer->analyze(std::move(cpp_inputs), n);
+
+        return true;
+    }
+    catch (...)
+    {
+        return false;
+    }
+}
+
+size_t tetengo_lattice_batchAnalyzer_pathCount(
+    const tetengo_lattice_batchAnalyzer_t* const p_analyzer,
+    const size_t                                 analysis_index)
+{
+    try
+    {
+        if (!p_analyzer)
+        {
+            throw std::invalid_argument{ "p_analyzer is NULL." };
+        }
+        if (analysis_index >= std::size(p_analyzer->results))
+        {
+            throw std::invalid_argument{ "analysis_index is too large." };
+        }
+
+        return std::size(p_analyzer->results[analysis_index]);
+    }
+    catch (...)
+    {
+        return 0;
+    }
+}
+
+size_t tetengo_lattice_batchAnalyzer_path(
+    const tetengo_lattice_batchAnalyzer_t* const p_analyzer,
+    const size_t                                 analysis_index,
+    const size_t                                 path_index,
+    tetengo_lattice_entryView_t* const           p_entries,
+    int* const                                   p_cost)
+{
+    try
+    {
+        if (!p_analyzer)
+        {
+            throw std::invalid_argument{ "p_analyzer is NULL." };
+        }
+        if (analysis_index >= std::size(p_analyzer->results))
+        {
+            throw std::invalid_argument{ "analysis_index is too large." };
+        }
+        const auto& paths = p_analyzer->results[analysis_index];
+        if (path_index >= std::size(paths))
+        {
+            throw std::invalid_argument{ "path_index is too large." };
+        }
+
+        const auto& cpp_path = paths[path_index];
+        const auto& cpp_entries = cpp_path.entries();
+        if (p_entries)
+        {
+            for (auto i = static_cast<std::size_t>(0); i < std::size(cpp_entries); ++i)
+            {
+                p_entries[i].key_handle =
+                    reinterpret_cast<tetengo_lattice_entryView_keyHandle_t>(cpp_entries[i].p_key());
+                p_entries[i].value_handle =
+                    reinterpret_cast<tetengo_lattice_entryView_valueHandle_t>(cpp_entries[i].value());
+                p_entries[i].cost = cpp_entries[i].cost();
+            }
+        }
+        if (p_cost)
+        {
+            *p_cost = cpp_path.cost();
+        }
+        return std::size(cpp_entries);
+    }
+    catch (...)
+    {
+        return 0;
+    }
+}
@@ -0,0 +1,341 @@
+/*! \file
+    \brief An A* N-best lattice path search.
+
+    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
+*/
+
+#if !defined(TETENGO_LATTICE_ASTARSEARCH_HPP)
+#define TETENGO_LATTICE_ASTARSEARCH_HPP
+
+#include <any>
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <queue>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <boost/core/noncopyable.hpp>
+
+#include <tetengo/lattice/constraint.hpp>
+#include <tetengo/lattice/cost_traits.hpp>
+#include <tetengo/lattice/lattice.hpp>
+#include <tetengo/lattice/node.hpp>
+#include <tetengo/lattice/path.hpp>
+
+
+namespace tetengo::lattice
+{
+    /*!
+        \brief A basic A* N-best lattice path search.
+
+        Searches the paths backward from the EOS node.
+        The path costs settled by the forward Viterbi pass are used as the heuristic, so the paths are found in
+        ascending order of their costs.
+        The paths whose costs are the infinity of cost_traits are not found.
+
+        \tparam Value A value type.
+        \tparam Cost  A cost type.
+    */
+    template <typename Value, typename Cost = int>
+    class basic_a_star_search : private boost::noncopyable
+    {
+    public:
+        // types
+
+        //! The value type.
+        using value_type = Value;
+
+        //! The cost type.
+        using cost_type = typename cost_traits<Cost>::cost_type;
+
+        //! The node type.
+        using node_type = basic_node<value_type, cost_type>;
+
+        //! The path type.
+        using path_type = basic_path<value_type, cost_type>;
+
+        //! The lattice type.
+        using lattice_type = basic_lattice<value_type, cost_type>;
+
+        //! The constraint type.
+        using constraint_type = basic_constraint<value_type, cost_type>;
+
+
+        // constructors and destructor
+
+        /*!
+            \brief Creates an A* search.
+
+            \param lattice_       A lattice.
+            \param eos_node       An EOS node.
+            \param p_constraint   A unique pointer to a constraint.
+            \param max_path_count A maximum path count.
+            \param max_expansions A maximum expansion count.
+
+            \throw std::invalid_argument When p_constraint is nullptr.
+        */
+        basic_a_star_search(
+            const lattice_type&                lattice_,
+            node_type                          eos_node,
+            std::unique_ptr<constraint_type>&& p_constraint,
+            const std::size_t                  max_path_count,
+            const std::size_t                  max_expansions) :
+        m_lattice{ lattice_ },
+        m_eos_node{ std::move(eos_node) },
+        m_p_constraint{ std::move(p_constraint) },
+        m_max_path_count{ max_path_count },
+        m_max_expansions{ max_expansions },
+        m_elements{},
+        m_open_states{},
+        m_eos_pop_count{ 0 },
+        m_pop_counts(lattice_.step_count()),
+        m_path_count{ 0 },
+        m_expansion_count{ 0 },
+        m_budget_exhausted{ false }
+        {
+            if (!m_p_constraint)
+            {
+                throw std::invalid_argument{ "p_constraint is nullptr." };
+            }
+
+            const auto constraint_state = m_p_constraint->next_state(m_p_constraint->initial_state(), m_eos_node);
+            if (constraint_state != std::numeric_limits<std::size_t>::max())
+            {
+                m_elements.push_back({ std::numeric_limits<std::size_t>::max(), 0, 0 });
+                m_open_states.push(
+                    { m_eos_node.path_cost(), m_eos_node.node_cost(), eos_element_index(), constraint_state });
+            }
+        }
+
+
+        // functions
+
+        /*!
+            \brief Returns the next path.
+
+            \return The next path. Or std::nullopt when no more path is found or the expansion budget is exhausted.
+        */
+        [[nodiscard]] std::optional<path_type> next()
+        {
+            while (!std::empty(m_open_states) && m_path_count < m_max_path_count)
+            {
+                if (m_expansion_count >= m_max_expansions)
+                {
+                    m_budget_exhausted = true;
+                    break;
+                }
+
+                const auto opened = m_open_states.top();
+                m_open_states.pop();
+
+                // A node with the same constraint state cannot be on more paths than the ones requested.
+                auto& pop_count = pop_count_of(opened);
+                if (pop_count >= m_max_path_count)
+                {
+                    continue;
+                }
+                ++pop_count;
+                ++m_expansion_count;
+
+                const auto& node_ = node_of(opened.element_index);
+                if (node_.is_bos())
+                {
+                    if (opened.constraint_state != 0)
+                    {
+                        continue;
+                    }
+                    ++m_path_count;
+                    return make_path(opened);
+                }
+
+                expand(opened, node_);
+            }
+
+            return std::nullopt;
+        }
+
+        /*!
+            \brief Returns the expansion count.
+
+            \return The expansion count.
+        */
+        [[nodiscard]] std::size_t expansion_count() const
+        {
+            return m_expansion_count;
+        }
+
+        /*!
+            \brief Returns true when the expansion budget is exhausted.
+
+            \retval true  When the expansion budget is exhausted.
+            \retval false Otherwise.
+        */
+        [[nodiscard]] bool budget_exhausted() const
+        {
+            return m_budget_exhausted;
+        }
+
+
+    private:
+        // types
+
+        struct element_type
+        {
+            std::size_t step;
+
+            std::size_t index_in_step;
+
+            std::size_t next_element_index;
+        };
+
+        struct state_type
+        {
+            cost_type whole_path_cost;
+
+            cost_type tail_path_cost;
+
+            std::size_t element_index;
+
+            std::size_t constraint_state;
+
+            friend bool operator>(const state_type& one, const state_type& another)
+            {
+                return std::tie(one.whole_path_cost, one.element_index) >
+                       std::tie(another.whole_path_cost, another.element_index);
+            }
+        };
+
+        // static functions
+
+        static constexpr std::size_t eos_element_index()
+        {
+            return 0;
+        }
+
+
+        // variables
+
+        const lattice_type& m_lattice;
+
+        const node_type m_eos_node;
+
+        const std::unique_ptr<constraint_type> m_p_constraint;
+
+        const std::size_t m_max_path_count;
+
+        const std::size_t m_max_expansions;
+
+        std::vector<element_type> m_elements;
+
+        std::priority_queue<state_type, std::vector<state_type>, std::greater<state_type>> m_open_states;
+
+        std::size_t m_eos_pop_count;
+
+        std::vector<std::vector<std::size_t>> m_pop_counts;
+
+        std::size_t m_path_count;
+
+        std::size_t m_expansion_count;
+
+        bool m_budget_exhausted;
+
+
+        // functions
+
+        const node_type& node_of(const std::size_t element_index) const
+        {
+            if (element_index == eos_element_index())
+            {
+                return m_eos_node;
+            }
+
+            const auto& element = m_elements[element_index];
+            return m_lattice.nodes_at(element.step)[element.index_in_step];
+        }
+
+        std::size_t& pop_count_of(const state_type& state)
+        {
+            if (state.element_index == eos_element_index())
+            {
+                return m_eos_pop_count;
+            }
+
+            // The constraint states range from 0 to the initial state.
+            const auto  state_count = m_p_constraint->initial_state() + 1;
+            const auto& element = m_elements[state.element_index];
+            auto&       pop_counts = m_pop_counts[element.step];
+            if (std::empty(pop_counts))
+            {
+                pop_counts.resize(std::size(m_lattice.nodes_at(element.step)) * state_count, 0);
+            }
+            assert(state.constraint_state < state_count);
+            return pop_counts[element.index_in_step * state_count + state.constraint_state];
+        }
+
+        void expand(const state_type& opened, const node_type& node_)
+        {
+            const auto& preceding_nodes = m_lattice.nodes_at(node_.preceding_step());
+            for (auto i = static_cast<std::size_t>(0); i < std::size(preceding_nodes); ++i)
+            {
+                const auto& preceding_node = preceding_nodes[i];
+                const auto  constraint_state = m_p_constraint->next_state(opened.constraint_state, preceding_node);
+                if (constraint_state == std::numeric_limits<std::size_t>::max())
+                {
+                    continue;
+                }
+
+                const auto preceding_edge_cost = node_.preceding_edge_costs()[i];
+                const auto tail_path_cost = cost_traits<cost_type>::add(
+                    cost_traits<cost_type>::add(opened.tail_path_cost, preceding_edge_cost),
+                    preceding_node.node_cost());
+                if (cost_traits<cost_type>::is_infinity(tail_path_cost))
+                {
+                    continue;
+                }
+                const auto whole_path_cost = cost_traits<cost_type>::add(
+                    cost_traits<cost_type>::add(opened.tail_path_cost, preceding_edge_cost),
+                    preceding_node.path_cost());
+                if (cost_traits<cost_type>::is_infinity(whole_path_cost))
+                {
+                    continue;
+                }
+
+                m_elements.push_back({ node_.preceding_step(), i, opened.element_index });
+                m_open_states.push({ whole_path_cost, tail_path_cost, std::size(m_elements) - 1, constraint_state });
+            }
+        }
+
+        path_type make_path(const state_type& bos_state) const
+        {
+            std::vector<node_type> nodes{ node_of(bos_state.element_index) };
+            for (auto element_index = bos_state.element_index; element_index != eos_element_index();)
+            {
+                element_index = m_elements[element_index].next_element_index;
+                nodes.push_back(node_of(element_index));
+            }
+            assert(m_p_constraint->matches(std::vector<node_type>{ std::rbegin(nodes), std::rend(nodes) }));
+            return path_type{ std::move(nodes), bos_state.whole_path_cost };
+        }
+    };
+
+
+    extern template class basic_a_star_search<std::any>;
+
+
+    /*!
+        \brief An A* N-best lattice path search.
+    */
+    using a_star_search = basic_a_star_search<std::any>;
+
+
+}
+
+
+#endif
@@ -0,0 +1,137 @@
+/*! \file
+    \brief A batch analyzer.
+
+    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
+*/
+
+#if !defined(TETENGO_LATTICE_BATCHANALYZER_HPP)
+#define TETENGO_LATTICE_BATCHANALYZER_HPP
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include <boost/core/noncopyable.hpp>
+
+#include <tetengo/lattice/entry.hpp>
+#include <tetengo/lattice/vocabulary.hpp>
+
+
+namespace tetengo::lattice
+{
+    class input;
+
+
+    /*!
+        \brief An analyzed path.
+
+        Unlike path, an analyzed path does not refer to any lattice.
+        The entries refer to the ones in the vocabulary, so they are valid as long as the vocabulary lives.
+    */
+    class analyzed_path
+    {
+    public:
+        // constructors and destructor
+
+        /*!
+            \brief Creates an analyzed path.
+
+            \param entries The entries on the path except BOS and EOS.
+            \param cost    A cost.
+        */
+        analyzed_path(std::vector<entry_view> entries, int cost);
+
+
+        // functions
+
+        /*!
+            \brief Returns the entries.
+
+            \return The entries.
+        */
+        [[nodiscard]] const std::vector<entry_view>& entries() const;
+
+        /*!
+            \brief Returns the cost.
+
+            \return The cost.
+        */
+        [[nodiscard]] int cost() const;
+
+
+    private:
+        // variables
+
+        std::vector<entry_view> m_entries;
+
+        int m_cost;
+    };
+
+
+    /*!
+        \brief A batch analyzer.
+
+        Analyzes many independent inputs in parallel.
+        The worker threads are created once in the constructor and are reused by every analyze() call. Each worker
+        thread reuses its own lattice, so the vocabulary is read concurrently from all the worker threads.
+    */
+    class batch_analyzer : private boost::noncopyable
+    {
+    public:
+        // constructors and destructor
+
+        /*!
+            \brief Creates a batch analyzer.
+
+            \param vocabulary_  A vocabulary. It must be safe for concurrent reads.
+            \param thread_count A thread count. When 0, the hardware concurrency is used.
+        */
+        batch_analyzer(const vocabulary& vocabulary_, std::size_t thread_count);
+
+        /*!
+            \brief Destroys the batch analyzer.
+        */
+        ~batch_analyzer();
+
+
+        // functions
+
+        /*!
+            \brief Returns the thread count.
+
+            \return The thread count.
+        */
+        [[nodiscard]] std::size_t thread_count() const;
+
+        /*!
+            \brief Analyzes inputs.
+
+            This function must not be called concurrently on the same batch analyzer.
+
+            \param inputs Inputs. Each element is the sequence of the inputs pushed back into a lattice.
+            \param n      The maximum path count for each input.
+
+            \return The N-best paths for each input, in the same order as the inputs.
+
+            \throw std::invalid_argument When some input has no node for it.
+        */
+        [[nodiscard]] std::vector<std::vector<analyzed_path>>
+        analyze(std::vector<std::vector<std::unique_ptr<input>>>&& inputs, std::size_t n);
+
+
+    private:
+        // types
+
+        class impl;
+
+
+        // variables
+
+        const std::unique_ptr<impl> m_p_impl;
+    };
+
+
+}
+
+
+#endif
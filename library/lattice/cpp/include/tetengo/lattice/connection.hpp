@@ -1,52 +1,69 @@
-/*! \file
-    \brief A connection.
-
-    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
-*/
-
-#if !defined(TETENGO_LATTICE_CONNECTION_HPP)
-#define TETENGO_LATTICE_CONNECTION_HPP
-
-
-namespace tetengo::lattice
-{
-    /*!
-        \brief A connection.
-    */
-    class connection
-    {
-    public:
-        // constructors
-
-        /*!
-            \brief Creates a connection.
-
-            \param cost A cost.
-        */
-        explicit constexpr connection(int cost) : m_cost{ cost } {}
-
-
-        // functions
-
-        /*!
-            \brief Returns the cost.
-
-            \return The cost.
-        */
-        [[nodiscard]] constexpr int cost() const
-        {
-            return m_cost;
-        }
-
-
-    private:
-        // variables
-
-        int m_cost;
-    };
-
-
-}
-
-
-#endif
+/*! \file
+    \brief A connection.
+
+    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
+*/
+
+#if !defined(TETENGO_LATTICE_CONNECTION_HPP)
+#define TETENGO_LATTICE_CONNECTION_HPP
+
+#include <tetengo/lattice/cost_traits.hpp>
+
+
+namespace tetengo::lattice
+{
+    /*!
+        \brief A basic connection.
+
+        \tparam Cost A cost type.
+    */
+    template <typename Cost = int>
+    class basic_connection
+    {
+    public:
+        // types
+
+        //! The cost type.
+        using cost_type = typename cost_traits<Cost>::cost_type;
+
+
+        // constructors
+
+        /*!
+            \brief Creates a connection.
+
+            \param cost A cost.
+        */
+        explicit constexpr basic_connection(const cost_type cost) : m_cost{ cost } {}
+
+
+        // functions
+
+        /*!
+            \brief Returns the cost.
+
+            \return The cost.
+        */
+        [[nodiscard]] constexpr cost_type cost() const
+        {
+            return m_cost;
+        }
+
+
+    private:
+        // variables
+
+        cost_type m_cost;
+    };
+
+
+    /*!
+        \brief A connection.
+    */
+    using connection = basic_connection<>;
+
+
+}
+
+
+#endif
@@ -1,88 +1,185 @@
-/*! \file
-    \brief A constraint.
-
-    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
-*/
-
-#if !defined(TETENGO_LATTICE_CONSTRAINT_HPP)
-#define TETENGO_LATTICE_CONSTRAINT_HPP
-
-#include <memory>
-#include <vector>
-
-#include <boost/core/noncopyable.hpp>
-
-
-namespace tetengo::lattice
-{
-    class constraint_element;
-    class node;
-
-
-    /*!
-        \brief A constraint.
-    */
-    class constraint : private boost::noncopyable
-    {
-    public:
-        // constructors and destructor
-
-        /*!
-            \brief Creates an empty constraint.
-
-            It matches any path.
-        */
-        constraint();
-
-        /*!
-            \brief Creates a constraint.
-
-            \param pattern A pattern.
-        */
-        explicit constraint(std::vector<std::unique_ptr<constraint_element>>&& pattern);
-
-        /*!
-            \brief Destroys the constraint.
-        */
-        ~constraint();
-
-
-        // functions
-
-        /*!
-            \brief Returns true when the path matches the pattern.
-
-            \param reverse_path A path in reverse order.
-
-            \retval true  When the path matches the pattern.
-            \retval false Otherwise.
-        */
-        [[nodiscard]] bool matches(const std::vector<node>& reverse_path) const;
-
-        /*!
-            \brief Returns true when the tail path matches the tail of the pattern.
-
-            \param reverse_tail_path A tail path in reverse order.
-
-            \retval true  When the tail path matches the tail of the pattern.
-            \retval false Otherwise.
-        */
-        [[nodiscard]] bool matches_tail(const std::vector<node>& reverse_tail_path) const;
-
-
-    private:
-        // types
-
-        class impl;
-
-
-        // variables
-
-        const std::unique_ptr<impl> m_p_impl;
-    };
-
-
-}
-
-
-#endif
+/*! \file
+    \brief A constraint.
+
+    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
+*/
+
+#if !defined(TETENGO_LATTICE_CONSTRAINT_HPP)
+#define TETENGO_LATTICE_CONSTRAINT_HPP
+
+#include <any>
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <boost/core/noncopyable.hpp>
+
+#include <tetengo/lattice/constraint_element.hpp>
+#include <tetengo/lattice/cost_traits.hpp>
+#include <tetengo/lattice/node.hpp>
+
+
+namespace tetengo::lattice
+{
+    /*!
+        \brief A basic constraint.
+
+        \tparam Value A value type.
+        \tparam Cost  A cost type.
+    */
+    template <typename Value, typename Cost = int>
+    class basic_constraint : private boost::noncopyable
+    {
+    public:
+        // types
+
+        //! The value type.
+        using value_type = Value;
+
+        //! The cost type.
+        using cost_type = typename cost_traits<Cost>::cost_type;
+
+        //! The node type.
+        using node_type = basic_node<value_type, cost_type>;
+
+        //! The constraint element type.
+        using constraint_element_type = basic_constraint_element<value_type, cost_type>;
+
+
+        // constructors and destructor
+
+        /*!
+            \brief Creates an empty constraint.
+
+            It matches any path.
+        */
+        basic_constraint() : m_pattern{} {}
+
+        /*!
+            \brief Creates a constraint.
+
+            \param pattern A pattern.
+        */
+        explicit basic_constraint(std::vector<std::unique_ptr<constraint_element_type>>&& pattern) :
+        m_pattern{ std::move(pattern) }
+        {}
+
+
+        // functions
+
+        /*!
+            \brief Returns true when the path matches the pattern.
+
+            \param reverse_path A path in reverse order.
+
+            \retval true  When the path matches the pattern.
+            \retval false Otherwise.
+        */
+        [[nodiscard]] bool matches(const std::vector<node_type>& reverse_path) const
+        {
+            return matches_impl(reverse_path) == 0;
+        }
+
+        /*!
+            \brief Returns true when the tail path matches the tail of the pattern.
+
+            \param reverse_tail_path A tail path in reverse order.
+
+            \retval true  When the tail path matches the tail of the pattern.
+            \retval false Otherwise.
+        */
+        [[nodiscard]] bool matches_tail(const std::vector<node_type>& reverse_tail_path) const
+        {
+            return matches_impl(reverse_tail_path) != std::numeric_limits<std::size_t>::max();
+        }
+
+        /*!
+            \brief Returns the initial matching state.
+
+            A matching state is the count of the pattern elements which have not matched yet.
+            The state std::numeric_limits<std::size_t>::max() means that the path does not match the pattern.
+
+            \return The initial matching state.
+        */
+        [[nodiscard]] std::size_t initial_state() const
+        {
+            return std::size(m_pattern);
+        }
+
+        /*!
+            \brief Returns the next matching state.
+
+            A path in reverse order can be matched incrementally by transiting the state with its nodes one by one.
+            The tail path matches the tail of the pattern when the state is not std::numeric_limits<std::size_t>::max(),
+            and the whole path matches the pattern when the state is 0.
+
+            \param state A matching state.
+            \param node_ A node preceding the nodes already transited.
+
+            \return The next matching state.
+        */
+        [[nodiscard]] std::size_t next_state(const std::size_t state, const node_type& node_) const
+        {
+            if (state == 0 || state == std::numeric_limits<std::size_t>::max())
+            {
+                return state;
+            }
+            assert(state <= std::size(m_pattern));
+
+            const auto element_match = m_pattern[state - 1]->matches(node_);
+            if (element_match < 0)
+            {
+                return std::numeric_limits<std::size_t>::max();
+            }
+            else if (element_match == 0)
+            {
+                return state - 1;
+            }
+            else
+            {
+                return state;
+            }
+        }
+
+
+    private:
+        // variables
+
+        const std::vector<std::unique_ptr<constraint_element_type>> m_pattern;
+
+
+        // functions
+
+        std::size_t matches_impl(const std::vector<node_type>& reverse_path) const
+        {
+            auto state = initial_state();
+            for (auto path_index = static_cast<std::size_t>(0);
+                 path_index < std::size(reverse_path) && state != 0 &&
+                 state != std::numeric_limits<std::size_t>::max();
+                 ++path_index)
+            {
+                state = next_state(state, reverse_path[path_index]);
+            }
+
+            return state;
+        }
+    };
+
+
+    extern template class basic_constraint<std::any>;
+
+
+    /*!
+        \brief A constraint.
+    */
+    using constraint = basic_constraint<std::any>;
+
+
+}
+
+
+#endif
@@ -1,56 +1,89 @@
-/*! \file
-    \brief A constraint element.
-
-    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
-*/
-
-#if !defined(TETENGO_LATTICE_CONSTRAINTELEMENT_HPP)
-#define TETENGO_LATTICE_CONSTRAINTELEMENT_HPP
-
-#include <boost/core/noncopyable.hpp>
-
-
-namespace tetengo::lattice
-{
-    class node;
-
-
-    /*!
-        \brief A constraint element.
-    */
-    class constraint_element : private boost::noncopyable
-    {
-    public:
-        // constructors
-
-        /*!
-            \brief Destroys the constraint element.
-        */
-        virtual ~constraint_element();
-
-
-        // functions
-
-        /*!
-            \brief Returns whether this constraint element matches the specified node.
-
-            \param node_ A node.
-
-            \retval positive This constraint element matches the specified node, and also may match its preceding nodes.
-            \retval 0        This constraint element matches the specified node, and do not match its precedings nodes.
-            \retval negative This constraint element does not match the specified node.
-        */
-        int matches(const node& node_) const;
-
-
-    private:
-        // virtual functions
-
-        virtual int matches_impl(const node& node_) const = 0;
-    };
-
-
-}
-
-
-#endif
+/*! \file
+    \brief A constraint element.
+
+    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
+*/
+
+#if !defined(TETENGO_LATTICE_CONSTRAINTELEMENT_HPP)
+#define TETENGO_LATTICE_CONSTRAINTELEMENT_HPP
+
+#include <any>
+
+#include <boost/core/noncopyable.hpp>
+
+#include <tetengo/lattice/cost_traits.hpp>
+
+
+namespace tetengo::lattice
+{
+    template <typename Value, typename Cost>
+    class basic_node;
+
+
+    /*!
+        \brief A basic constraint element.
+
+        \tparam Value A value type.
+        \tparam Cost  A cost type.
+    */
+    template <typename Value, typename Cost = int>
+    class basic_constraint_element : private boost::noncopyable
+    {
+    public:
+        // types
+
+        //! The value type.
+        using value_type = Value;
+
+        //! The cost type.
+        using cost_type = typename cost_traits<Cost>::cost_type;
+
+        //! The node type.
+        using node_type = basic_node<value_type, cost_type>;
+
+
+        // constructors
+
+        /*!
+            \brief Destroys the constraint element.
+        */
+        virtual ~basic_constraint_element() = default;
+
+
+        // functions
+
+        /*!
+            \brief Returns whether this constraint element matches the specified node.
+
+            \param node_ A node.
+
+            \retval positive This constraint element matches the specified node, and also may match its preceding nodes.
+            \retval 0        This constraint element matches the specified node, and do not match its precedings nodes.
+            \retval negative This constraint element does not match the specified node.
+        */
+        int matches(const node_type& node_) const
+        {
+            return matches_impl(node_);
+        }
+
+
+    private:
+        // virtual functions
+
+        virtual int matches_impl(const node_type& node_) const = 0;
+    };
+
+
+    extern template class basic_constraint_element<std::any>;
+
+
+    /*!
+        \brief A constraint element.
+    */
+    using constraint_element = basic_constraint_element<std::any>;
+
+
+}
+
+
+#endif
@@ -0,0 +1,110 @@
+/*! \file
+    \brief Cost traits.
+
+    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
+*/
+
+#if !defined(TETENGO_LATTICE_COSTTRAITS_HPP)
+#define TETENGO_LATTICE_COSTTRAITS_HPP
+
+#include <limits>
+#include <type_traits>
+
+
+namespace tetengo::lattice
+{
+    /*!
+        \brief Cost traits.
+
+        Defines the infinity and the saturating addition of a cost type, which the Viterbi search and the N-best
+        search use to accumulate the path costs.
+
+        For an integer type, the infinity is the maximum value. The addition returns the infinity when either operand
+        is the infinity, and clamps the result to the range of the type instead of overflowing.
+        For a floating point type, the infinity is the IEEE 754 positive infinity, and the addition is the plain one.
+
+        \tparam Cost A cost type. It must be an arithmetic type other than bool.
+    */
+    template <typename Cost>
+    class cost_traits
+    {
+    public:
+        // types
+
+        //! The cost type.
+        using cost_type = Cost;
+
+        static_assert(std::is_arithmetic_v<cost_type> && !std::is_same_v<cost_type, bool>);
+
+
+        // static functions
+
+        /*!
+            \brief Returns the infinity.
+
+            \return The infinity.
+        */
+        [[nodiscard]] static constexpr cost_type infinity()
+        {
+            if constexpr (std::is_floating_point_v<cost_type>)
+            {
+                return std::numeric_limits<cost_type>::infinity();
+            }
+            else
+            {
+                return std::numeric_limits<cost_type>::max();
+            }
+        }
+
+        /*!
+            \brief Returns true when a cost is the infinity.
+
+            \param cost A cost.
+
+            \retval true  When cost is the infinity.
+            \retval false Otherwise.
+        */
+        [[nodiscard]] static constexpr bool is_infinity(const cost_type cost)
+        {
+            return cost == infinity();
+        }
+
+        /*!
+            \brief Adds costs.
+
+            \param one     One cost.
+            \param another Another cost.
+
+            \return The sum.
+        */
+        [[nodiscard]] static constexpr cost_type add(const cost_type one, const cost_type another)
+        {
+            if constexpr (std::is_floating_point_v<cost_type>)
+            {
+                return one + another;
+            }
+            else
+            {
+                if (is_infinity(one) || is_infinity(another))
+                {
+                    return infinity();
+                }
+                if constexpr (std::is_signed_v<cost_type>)
+                {
+                    if (another < 0)
+                    {
+                        return one < std::numeric_limits<cost_type>::min() - another ?
+                                   std::numeric_limits<cost_type>::min() :
+                                   static_cast<cost_type>(one + another);
+                    }
+                }
+                return one > infinity() - another ? infinity() : static_cast<cost_type>(one + another);
+            }
+        }
+    };
+
+
+}
+
+
+#endif
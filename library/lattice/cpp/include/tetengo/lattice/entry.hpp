@@ -1,192 +1,279 @@
-/*! \file
-    \brief An entry.
-
-    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
-*/
-
-#if !defined(TETENGO_LATTICE_ENTRY_HPP)
-#define TETENGO_LATTICE_ENTRY_HPP
-
-#include <any>
-#include <memory>
-#include <utility>
-
-#include <tetengo/lattice/input.hpp>
-
-
-namespace tetengo::lattice
-{
-    class entry_view;
-
-
-    /*!
-        \brief An entry.
-    */
-    class entry
-    {
-    public:
-        // static functions
-
-        /*!
-            \brief Returns the BOS/EOS (Beginning/End of Sequence) entry.
-
-            \return The BOS/EOS entry.
-        */
-        [[nodiscard]] static const entry& bos_eos();
-
-
-        // constructors
-
-        /*!
-            \brief Creates an entry.
-
-            \param p_key A unique pointer to a key.
-            \param value A value.
-            \param cost  A cost.
-        */
-        entry(std::unique_ptr<input>&& p_key, std::any value, int cost);
-
-        /*!
-            \brief Creates an entry.
-
-            \param view An entry view.
-        */
-        entry(const entry_view& view);
-
-        /*!
-            \brief Copies an entry.
-
-            \param another Another entry.
-        */
-        entry(const entry& another);
-
-        /*!
-            \brief Moves an entry.
-
-            \param another Another entry.
-        */
-        entry(entry&& another);
-
-
-        // functions
-
-        /*!
-            \brief Returns the pointer to the key.
-
-            \return The pointer to the key.
-        */
-        [[nodiscard]] const input* p_key() const;
-
-        /*!
-            \brief Returns the value.
-
-            \return The value.
-        */
-        [[nodiscard]] const std::any& value() const;
-
-        /*!
-            \brief Returns the cost.
-
-            \return The cost.
-        */
-        [[nodiscard]] int cost() const;
-
-
-    private:
-        // variables
-
-        std::unique_ptr<input> m_p_key;
-
-        std::any m_value;
-
-        int m_cost;
-    };
-
-
-    /*!
-        \brief An entry view.
-    */
-    class entry_view
-    {
-    public:
-        // static functions
-
-        /*!
-            \brief Returns the BOS/EOS (Beginning/End of Sequence) entry.
-
-            \return The BOS/EOS entry.
-        */
-        [[nodiscard]] static const entry_view& bos_eos();
-
-
-        // constructors
-
-        /*!
-            \brief Creates an entry view.
-
-            \param p_key A pointer to a key.
-            \param value A value.
-            \param cost  A cost.
-        */
-        constexpr entry_view(const input* p_key, const std::any* value, int cost) :
-        m_p_key{ p_key },
-        m_value{ std::move(value) },
-        m_cost{ cost }
-        {}
-
-        /*!
-            \brief Creates an entry view.
-
-            \param entry An entry.
-        */
-        entry_view(const entry& entry);
-
-
-        // functions
-
-        /*!
-            \brief Returns the pointer to the key.
-
-            \return The pointer to the key.
-        */
-        [[nodiscard]] constexpr const input* p_key() const
-        {
-            return m_p_key;
-        }
-
-        /*!
-            \brief Returns the value.
-
-            \return The value.
-        */
-        [[nodiscard]] constexpr const std::any* value() const
-        {
-            return m_value;
-        }
-
-        /*!
-            \brief Returns the cost.
-
-            \return The cost.
-        */
-        [[nodiscard]] constexpr int cost() const
-        {
-            return m_cost;
-        }
-
-
-    private:
-        // variables
-
-        const input* m_p_key;
-
-        const std::any* m_value;
-
-        int m_cost;
-    };
-
-
-}
-
-
-#endif
+/*! \file
+    \brief An entry.
+
+    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
+*/
+
+#if !defined(TETENGO_LATTICE_ENTRY_HPP)
+#define TETENGO_LATTICE_ENTRY_HPP
+
+#include <any>
+#include <memory>
+#include <utility>
+
+#include <tetengo/lattice/cost_traits.hpp>
+#include <tetengo/lattice/input.hpp>
+
+
+namespace tetengo::lattice
+{
+    template <typename Value, typename Cost = int>
+    class basic_entry_view;
+
+
+    /*!
+        \brief A basic entry.
+
+        The value is stored inline as Value, so that a container of basic entries keeps the values contiguous and the
+        accesses to them need no type check.
+
+        \tparam Value A value type. It must be default constructible for the BOS/EOS entry.
+        \tparam Cost  A cost type.
+    */
+    template <typename Value, typename Cost = int>
+    class basic_entry
+    {
+    public:
+        // types
+
+        //! The value type.
+        using value_type = Value;
+
+        //! The cost type.
+        using cost_type = typename cost_traits<Cost>::cost_type;
+
+
+        // static functions
+
+        /*!
+            \brief Returns the BOS/EOS (Beginning/End of Sequence) entry.
+
+            \return The BOS/EOS entry.
+        */
+        [[nodiscard]] static const basic_entry& bos_eos()
+        {
+            static const basic_entry singleton{ nullptr, value_type{}, cost_type{} };
+            return singleton;
+        }
+
+
+        // constructors
+
+        /*!
+            \brief Creates an entry.
+
+            \param p_key A unique pointer to a key.
+            \param value A value.
+            \param cost  A cost.
+        */
+        basic_entry(std::unique_ptr<input>&& p_key, value_type value, const cost_type cost) :
+        m_p_key{ std::move(p_key) },
+        m_value{ std::move(value) },
+        m_cost{ cost }
+        {}
+
+        /*!
+            \brief Creates an entry.
+
+            \param view An entry view.
+        */
+        basic_entry(const basic_entry_view<value_type, cost_type>& view) :
+        m_p_key{ view.p_key() ? view.p_key()->clone() : nullptr },
+        m_value{ *view.value() },
+        m_cost{ view.cost() }
+        {}
+
+        /*!
+            \brief Copies an entry.
+
+            \param another Another entry.
+        */
+        basic_entry(const basic_entry& another) :
+        m_p_key{ another.m_p_key ? another.m_p_key->clone() : nullptr },
+        m_value{ another.m_value },
+        m_cost{ another.m_cost }
+        {}
+
+        /*!
+            \brief Moves an entry.
+
+            \param another Another entry.
+        */
+        basic_entry(basic_entry&& another) :
+        m_p_key{ std::move(another.m_p_key) },
+        m_value{ std::move(another.m_value) },
+        m_cost{ another.m_cost }
+        {}
+
+
+        // functions
+
+        /*!
+            \brief Returns the pointer to the key.
+
+            \return The pointer to the key.
+        */
+        [[nodiscard]] const input* p_key() const
+        {
+            return std::to_address(m_p_key);
+        }
+
+        /*!
+            \brief Returns the value.
+
+            \return The value.
+        */
+        [[nodiscard]] const value_type& value() const
+        {
+            return m_value;
+        }
+
+        /*!
+            \brief Returns the cost.
+
+            \return The cost.
+        */
+        [[nodiscard]] cost_type cost() const
+        {
+            return m_cost;
+        }
+
+
+    private:
+        // variables
+
+        std::unique_ptr<input> m_p_key;
+
+        value_type m_value;
+
+        cost_type m_cost;
+    };
+
+
+    /*!
+        \brief A basic entry view.
+
+        \tparam Value A value type. It must be default constructible for the BOS/EOS entry.
+        \tparam Cost  A cost type.
+    */
+    template <typename Value, typename Cost>
+    class basic_entry_view
+    {
+    public:
+        // types
+
+        //! The value type.
+        using value_type = Value;
+
+        //! The cost type.
+        using cost_type = typename cost_traits<Cost>::cost_type;
+
+
+        // static functions
+
+        /*!
+            \brief Returns the BOS/EOS (Beginning/End of Sequence) entry.
+
+            \return The BOS/EOS entry.
+        */
+        [[nodiscard]] static const basic_entry_view& bos_eos()
+        {
+            static const value_type       value_singleton{};
+            static const basic_entry_view singleton{ nullptr, &value_singleton, cost_type{} };
+            return singleton;
+        }
+
+
+        // constructors
+
+        /*!
+            \brief Creates an entry view.
+
+            \param p_key A pointer to a key.
+            \param value A value.
+            \param cost  A cost.
+        */
+        constexpr basic_entry_view(const input* p_key, const value_type* value, const cost_type cost) :
+        m_p_key{ p_key },
+        m_value{ std::move(value) },
+        m_cost{ cost }
+        {}
+
+        /*!
+            \brief Creates an entry view.
+
+            \param entry An entry.
+        */
+        basic_entry_view(const basic_entry<value_type, cost_type>& entry) :
+        m_p_key{ entry.p_key() },
+        m_value{ &entry.value() },
+        m_cost{ entry.cost() }
+        {}
+
+
+        // functions
+
+        /*!
+            \brief Returns the pointer to the key.
+
+            \return The pointer to the key.
+        */
+        [[nodiscard]] constexpr const input* p_key() const
+        {
+            return m_p_key;
+        }
+
+        /*!
+            \brief Returns the value.
+
+            \return The value.
+        */
+        [[nodiscard]] constexpr const value_type* value() const
+        {
+            return m_value;
+        }
+
+        /*!
+            \brief Returns the cost.
+
+            \return The cost.
+        */
+        [[nodiscard]] constexpr cost_type cost() const
+        {
+            return m_cost;
+        }
+
+
+    private:
+        // variables
+
+        const input* m_p_key;
+
+        const value_type* m_value;
+
+        cost_type m_cost;
+    };
+
+
+    extern template class basic_entry<std::any>;
+
+    extern template class basic_entry_view<std::any>;
+
+
+    /*!
+        \brief An entry.
+
+        The value is held in std::any, which the lattice, the vocabularies and the C API use.
+    */
+    using entry = basic_entry<std::any>;
+
+    /*!
+        \brief An entry view.
+    */
+    using entry_view = basic_entry_view<std::any>;
+
+
+}
+
+
+#endif
@@ -1,99 +1,872 @@
-/*! \file
-    \brief A lattice.
-
-    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
-*/
-
-#if !defined(TETENGO_LATTICE_LATTICE_HPP)
-#define TETENGO_LATTICE_LATTICE_HPP
-
-#include <cstddef>
-#include <memory>
-#include <utility>
-#include <vector>
-
-#include <boost/core/noncopyable.hpp>
-
-
-namespace tetengo::lattice
-{
-    class input;
-    class vocabulary;
-    class node;
-
-
-    /*!
-        \brief A lattice.
-    */
-    class lattice : private boost::noncopyable
-    {
-    public:
-        // constructors and destructor
-
-        /*!
-            \brief Creates a lattice.
-
-            \param vocabulary_ A vocabulary.
-        */
-        explicit lattice(const vocabulary& vocabulary_);
-
-        /*!
-            \brief Destroys the lattice.
-        */
-        ~lattice();
-
-
-        // functions
-
-        /*!
-            \brief Returns the step count.
-
-            \return The step count.
-        */
-        [[nodiscard]] std::size_t step_count() const;
-
-        /*!
-            \brief Returns the nodes at the specified step.
-
-            \param step A step.
-
-            \return The nodes.
-
-            \throw std::out_of_rage When step is too large.
-        */
-        [[nodiscard]] const std::vector<node>& nodes_at(std::size_t step) const;
-
-        /*!
-            \brief Pushes back an input.
-
-            \param p_input A unique pointer to an input.
-        */
-        void push_back(std::unique_ptr<input>&& p_input);
-
-        /*!
-            \brief Settles this lattice.
-
-            You can modify the lattice after settlement.
-            Modification of the lattice after settlement invalidate the EOS node.
-
-            \return The EOS node and its preceding edge costs.
-        */
-        [[nodiscard]] std::pair<node, std::unique_ptr<std::vector<int>>> settle();
-
-
-    private:
-        // types
-
-        class impl;
-
-
-        // variables
-
-        const std::unique_ptr<impl> m_p_impl;
-    };
-
-
-}
-
-
-#endif
+/*! \file
+    \brief A lattice.
+
+    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
+*/
+
+#if !defined(TETENGO_LATTICE_LATTICE_HPP)
+#define TETENGO_LATTICE_LATTICE_HPP
+
+#include <algorithm>
+#include <any>
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <ostream>
+#include <set>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <boost/core/noncopyable.hpp>
+
+#include <tetengo/lattice/cost_traits.hpp>
+#include <tetengo/lattice/entry.hpp>
+#include <tetengo/lattice/input.hpp>
+#include <tetengo/lattice/node.hpp>
+#include <tetengo/lattice/profile.hpp>
+#include <tetengo/lattice/string_input.hpp>
+#include <tetengo/lattice/string_view_input.hpp>
+#include <tetengo/lattice/vocabulary.hpp>
+
+
+namespace tetengo::lattice
+{
+    /*!
+        \brief A basic lattice.
+
+        \tparam Value A value type.
+        \tparam Cost  A cost type.
+    */
+    template <typename Value, typename Cost = int>
+    class basic_lattice : private boost::noncopyable
+    {
+    public:
+        // types
+
+        //! The value type.
+        using value_type = Value;
+
+        //! The cost type.
+        using cost_type = typename cost_traits<Cost>::cost_type;
+
+        //! The entry view type.
+        using entry_view_type = basic_entry_view<value_type, cost_type>;
+
+        //! The node type.
+        using node_type = basic_node<value_type, cost_type>;
+
+        //! The vocabulary type.
+        using vocabulary_type = basic_vocabulary<value_type, cost_type>;
+
+
+        // constructors and destructor
+
+        /*!
+            \brief Creates a lattice.
+
+            \param vocabulary_ A vocabulary.
+        */
+        explicit basic_lattice(const vocabulary_type& vocabulary_) :
+        m_vocabulary{ vocabulary_ },
+        m_p_arena{},
+        m_p_memory_resource{ std::pmr::get_default_resource() },
+        m_p_input{},
+        m_graph{ m_p_memory_resource },
+        m_found_entries{ m_p_memory_resource },
+        m_found_entry_ends{ m_p_memory_resource },
+        m_first_step{ 0 },
+        m_step_count{ 1 },
+        m_input_offset{ 0 },
+        m_profile_enabled{ profile_enabled() },
+        m_counters{}
+        {
+            m_graph.push_back(bos_step(m_p_memory_resource));
+        }
+
+        /*!
+            \brief Creates a lattice with an arena.
+
+            The steps of the lattice are allocated in a monotonic arena built on the memory resource.
+            The memory resource must outlive the lattice.
+
+            \param vocabulary_       A vocabulary.
+            \param p_memory_resource A pointer to an upstream memory resource for the arena.
+
+            \throw std::invalid_argument When p_memory_resource is nullptr.
+        */
+        basic_lattice(const vocabulary_type& vocabulary_, std::pmr::memory_resource* const p_memory_resource) :
+        m_vocabulary{ vocabulary_ },
+        m_p_arena{ make_arena(p_memory_resource) },
+        m_p_memory_resource{ std::to_address(m_p_arena) },
+        m_p_input{},
+        m_graph{ m_p_memory_resource },
+        m_found_entries{ m_p_memory_resource },
+        m_found_entry_ends{ m_p_memory_resource },
+        m_first_step{ 0 },
+        m_step_count{ 1 },
+        m_input_offset{ 0 },
+        m_profile_enabled{ profile_enabled() },
+        m_counters{}
+        {
+            m_graph.push_back(bos_step(m_p_memory_resource));
+        }
+
+
+        // functions
+
+        /*!
+            \brief Returns the step count.
+
+            \return The step count.
+        */
+        [[nodiscard]] std::size_t step_count() const
+        {
+            return m_step_count;
+        }
+
+        /*!
+            \brief Returns the nodes at the specified step.
+
+            \param step A step.
+
+            The nodes are stored in the memory resource of the lattice.
+
+            \return The nodes.
+
+            \throw std::out_of_rage When step is too large or already committed.
+        */
+        [[nodiscard]] std::span<const node_type> nodes_at(const std::size_t step) const
+        {
+            if (step >= m_step_count)
+            {
+                throw std::out_of_range{ "step is too large." };
+            }
+            if (step < m_first_step)
+            {
+                throw std::out_of_range{ "step is already committed." };
+            }
+
+            return step_at(step).nodes();
+        }
+
+        /*!
+            \brief Pushes back an input.
+
+            \param p_input A unique pointer to an input.
+        */
+        void push_back(std::unique_ptr<input>&& p_input)
+        {
+            const profile_timer timer{ m_counters.push_back_duration };
+
+            if (m_p_input)
+            {
+                m_p_input->append(std::move(p_input));
+            }
+            else
+            {
+                m_p_input = std::move(p_input);
+            }
+
+            // The entries are looked up before the nodes are added so that the new step is reserved only once.
+            // The found entries of all the preceding steps are stored in a row, and the buffers are recycled.
+            m_found_entries.clear();
+            m_found_entry_ends.clear();
+            for (auto i = m_first_step; i < m_step_count; ++i)
+            {
+                const auto step_tail = step_at(i).input_tail() - m_input_offset;
+                const auto found_begin = std::size(m_found_entries);
+                m_vocabulary.find_subrange_entries(
+                    *m_p_input, step_tail, m_p_input->length() - step_tail, m_found_entries);
+                if (m_profile_enabled)
+                {
+                    ++m_counters.entry_lookup_count;
+                }
+                if (std::size(m_found_entries) == found_begin)
+                {
+                    continue;
+                }
+                m_found_entry_ends.emplace_back(i, std::size(m_found_entries));
+            }
+
+            auto& new_step = next_step(m_input_offset + m_p_input->length());
+            new_step.reserve(std::size(m_found_entries));
+            auto found_begin = static_cast<std::size_t>(0);
+            for (const auto& [i, found_end]: m_found_entry_ends)
+            {
+                const auto& step = step_at(i);
+                for (auto j = found_begin; j < found_end; ++j)
+                {
+                    const auto& entry = m_found_entries[j];
+                    auto&       preceding_edge_costs_ = new_step.next_preceding_edge_costs();
+                    preceding_edge_costs_.resize(step.size());
+                    fill_preceding_edge_costs(step, entry, preceding_edge_costs_);
+                    const auto best_preceding_node_index_ = best_preceding_node_index(step, preceding_edge_costs_);
+                    const auto best_preceding_path_cost = cost_traits<cost_type>::add(
+                        step.path_costs()[best_preceding_node_index_],
+                        preceding_edge_costs_[best_preceding_node_index_]);
+
+                    new_step.push_back(
+                        entry,
+                        i,
+                        best_preceding_node_index_,
+                        cost_traits<cost_type>::add(best_preceding_path_cost, entry.cost()));
+                    if (m_profile_enabled)
+                    {
+                        ++m_counters.node_count;
+                    }
+                }
+                found_begin = found_end;
+            }
+            if (new_step.empty())
+            {
+                throw std::invalid_argument{ "No node is found for the input." };
+            }
+
+            ++m_step_count;
+        }
+
+        /*!
+            \brief Settles this lattice.
+
+            You can modify the lattice after settlement.
+            Modification of the lattice after settlement invalidate the EOS node.
+
+            \return The EOS node and its preceding edge costs.
+        */
+        [[nodiscard]] std::pair<node_type, std::unique_ptr<std::vector<cost_type>>> settle()
+        {
+            const profile_timer timer{ m_counters.settle_duration };
+
+            const auto& last_step = step_at(m_step_count - 1);
+            auto        p_preceding_edge_costs = std::make_unique<std::vector<cost_type>>(last_step.size());
+            fill_preceding_edge_costs(last_step, entry_view_type::bos_eos(), *p_preceding_edge_costs);
+            const auto best_preceding_node_index_ = best_preceding_node_index(last_step, *p_preceding_edge_costs);
+            const auto best_preceding_path_cost = cost_traits<cost_type>::add(
+                last_step.path_costs()[best_preceding_node_index_],
+                (*p_preceding_edge_costs)[best_preceding_node_index_]);
+
+            node_type eos_node{ node_type::eos(
+                m_step_count - 1,
+                std::to_address(p_preceding_edge_costs),
+                best_preceding_node_index_,
+                best_preceding_path_cost) };
+            return std::make_pair(std::move(eos_node), std::move(p_preceding_edge_costs));
+        }
+
+        /*!
+            \brief Commits the settled prefix of the best path.
+
+            For a streaming input, the nodes at the beginning of the best path are settled before the whole input is
+            pushed back, once the best paths of all the nodes which a later entry can follow join into one node.
+            This function passes the nodes up to that node to emit, and discards the steps before it.
+            The memory used by the lattice is bounded by the ambiguous part of the input, not by the whole input.
+
+            The steps keep their numbers. nodes_at() throws std::out_of_range for a discarded step.
+            Since the paths cannot be traced back beyond the committed nodes, n_best_iterator must not be used after
+            calling this function. Use commit_all() to get the rest of the best path instead.
+
+            \param lookback_length The maximum input length of the keys in the vocabulary.
+            \param emit            A function called with each committed node in order.
+                                   The node is valid only during the call.
+
+            \return The committed node count.
+        */
+        std::size_t commit(const std::size_t lookback_length, const std::function<void(const node_type&)>& emit)
+        {
+            if (!m_p_input)
+            {
+                return 0;
+            }
+
+            // The best paths of the nodes in the steps which a later entry can still follow are traced back until
+            // they join into one node. The path to that node is never changed by the later inputs.
+            std::set<std::pair<std::size_t, std::size_t>> heads{};
+            const auto input_length = m_input_offset + m_p_input->length();
+            for (auto i = m_first_step; i < m_step_count; ++i)
+            {
+                const auto& step = step_at(i);
+                if (step.input_tail() + lookback_length <= input_length && i + 1 < m_step_count)
+                {
+                    continue;
+                }
+                for (auto j = static_cast<std::size_t>(0); j < step.size(); ++j)
+                {
+                    heads.emplace(i, j);
+                }
+            }
+            while (std::size(heads) > 1)
+            {
+                const auto latest = *std::prev(std::end(heads));
+                if (latest.first == m_first_step)
+                {
+                    return 0;
+                }
+                heads.erase(std::prev(std::end(heads)));
+                const auto& latest_node = step_at(latest.first).nodes()[latest.second];
+                if (latest_node.preceding_step() < m_first_step)
+                {
+                    return 0;
+                }
+                heads.emplace(latest_node.preceding_step(), latest_node.best_preceding_node());
+            }
+            const auto confluence = *std::begin(heads);
+            if (confluence.first == m_first_step)
+            {
+                return 0;
+            }
+
+            const auto committed_count = emit_best_path(confluence.first, confluence.second, emit);
+            drop_steps_before(confluence.first);
+            return committed_count;
+        }
+
+        /*!
+            \brief Commits the rest of the best path.
+
+            Settles the lattice, passes the nodes of the best path which have not been committed yet to emit, and
+            clears the lattice.
+
+            \param emit A function called with each committed node in order. The node is valid only during the call.
+
+            \return The committed node count.
+        */
+        std::size_t commit_all(const std::function<void(const node_type&)>& emit)
+        {
+            if (!m_p_input)
+            {
+                return 0;
+            }
+
+            const auto eos_node_and_preceding_edge_costs = settle();
+            const auto& eos_node = eos_node_and_preceding_edge_costs.first;
+            const auto  committed_count =
+                emit_best_path(eos_node.preceding_step(), eos_node.best_preceding_node(), emit);
+            clear();
+            return committed_count;
+        }
+
+        /*!
+            \brief Clears this lattice.
+
+            Discards all the pushed inputs and their steps, but retains the capacity of the internal buffers.
+            The lattice can be reused for another input without reallocating them.
+
+            Clearing the lattice invalidates all the nodes obtained from it.
+        */
+        void clear()
+        {
+            m_p_input.reset();
+            if (m_first_step > 0)
+            {
+                reset_bos_step(m_graph[0]);
+            }
+            m_first_step = 0;
+            m_step_count = 1;
+            m_input_offset = 0;
+        }
+
+        /*!
+            \brief Resets this lattice.
+
+            Discards all the pushed inputs and their steps, and releases the memory allocated in the arena.
+            The lattice gets back to the state just after its construction.
+
+            Resetting the lattice invalidates all the nodes obtained from it.
+        */
+        void reset()
+        {
+            m_p_input.reset();
+            {
+                std::pmr::vector<graph_step> graph{ m_p_memory_resource };
+                m_graph.swap(graph);
+                std::pmr::vector<entry_view_type> found_entries{ m_p_memory_resource };
+                m_found_entries.swap(found_entries);
+                std::pmr::vector<std::pair<std::size_t, std::size_t>> found_entry_ends{ m_p_memory_resource };
+                m_found_entry_ends.swap(found_entry_ends);
+            }
+            if (m_p_arena)
+            {
+                m_p_arena->release();
+            }
+
+            m_graph.push_back(bos_step(m_p_memory_resource));
+            m_first_step = 0;
+            m_step_count = 1;
+            m_input_offset = 0;
+        }
+
+        /*!
+            \brief Returns the profile counters.
+
+            \return The profile counters. All zero unless profile_enabled() returns true.
+        */
+        [[nodiscard]] const lattice_counters& counters() const
+        {
+            return m_counters;
+        }
+
+        /*!
+            \brief Writes the graph in JSON.
+
+            Writes the nodes of the steps which are not committed, with their costs and their best preceding nodes.
+            The keys are written when they are string_input or string_view_input.
+
+            \param stream An output stream.
+        */
+        void write_json(std::ostream& stream) const
+        {
+            stream << "{\"first_step\":" << m_first_step << ",\"steps\":[";
+            for (auto i = m_first_step; i < m_step_count; ++i)
+            {
+                const auto& step = step_at(i);
+                stream << (i > m_first_step ? "," : "") << "{\"step\":" << i
+                       << ",\"input_tail\":" << step.input_tail() << ",\"nodes\":[";
+                const auto& nodes = step.nodes();
+                for (auto j = static_cast<std::size_t>(0); j < std::size(nodes); ++j)
+                {
+                    const auto& node_ = nodes[j];
+                    stream << (j > 0 ? "," : "") << "{\"index\":" << j << ",\"key\":";
+                    if (const auto key = key_text(node_.p_key()); key)
+                    {
+                        write_json_string(stream, *key);
+                    }
+                    else
+                    {
+                        stream << "null";
+                    }
+                    stream << ",\"node_cost\":" << node_.node_cost() << ",\"path_cost\":" << node_.path_cost();
+                    if (node_.is_bos())
+                    {
+                        stream << ",\"preceding_step\":null,\"best_preceding_node\":null}";
+                    }
+                    else
+                    {
+                        stream << ",\"preceding_step\":" << node_.preceding_step()
+                               << ",\"best_preceding_node\":" << node_.best_preceding_node() << "}";
+                    }
+                }
+                stream << "]}";
+            }
+            stream << "]}";
+        }
+
+        /*!
+            \brief Writes the graph in the Graphviz DOT language.
+
+            Writes the nodes of the steps which are not committed and the edges between them with finite costs.
+            The edges from the best preceding nodes are drawn in bold.
+
+            \param stream An output stream.
+        */
+        void write_graphviz(std::ostream& stream) const
+        {
+            stream << "digraph lattice {\n";
+            stream << "    rankdir=LR;\n";
+            for (auto i = m_first_step; i < m_step_count; ++i)
+            {
+                const auto& nodes = step_at(i).nodes();
+                for (auto j = static_cast<std::size_t>(0); j < std::size(nodes); ++j)
+                {
+                    const auto& node_ = nodes[j];
+                    stream << "    \"" << i << "-" << j << "\" [label=\"";
+                    if (const auto key = key_text(node_.p_key()); key)
+                    {
+                        write_graphviz_string(stream, *key);
+                    }
+                    else if (node_.is_bos())
+                    {
+                        stream << "BOS";
+                    }
+                    stream << "\\n" << node_.node_cost() << " / " << node_.path_cost() << "\"];\n";
+
+                    if (node_.is_bos() || node_.preceding_step() < m_first_step)
+                    {
+                        continue;
+                    }
+                    const auto& preceding_edge_costs = node_.preceding_edge_costs();
+                    for (auto k = static_cast<std::size_t>(0); k < std::size(preceding_edge_costs); ++k)
+                    {
+                        if (cost_traits<cost_type>::is_infinity(preceding_edge_costs[k]))
+                        {
+                            continue;
+                        }
+                        stream << "    \"" << node_.preceding_step() << "-" << k << "\" -> \"" << i << "-" << j
+                               << "\" [label=\"" << preceding_edge_costs[k] << "\""
+                               << (k == node_.best_preceding_node() ? ", style=bold" : "") << "];\n";
+                    }
+                }
+            }
+            stream << "}\n";
+        }
+
+
+    private:
+        // types
+
+        class graph_step
+        {
+        public:
+            // constructors and destructor
+
+            graph_step(const std::size_t input_tail, std::pmr::memory_resource* const p_memory_resource) :
+            m_input_tail{ input_tail },
+            m_entries{ p_memory_resource },
+            m_preceding_steps{ p_memory_resource },
+            m_preceding_edge_costs{ p_memory_resource },
+            m_best_preceding_nodes{ p_memory_resource },
+            m_path_costs{ p_memory_resource },
+            m_nodes{ p_memory_resource }
+            {}
+
+
+            // functions
+
+            std::size_t input_tail() const
+            {
+                return m_input_tail;
+            }
+
+            std::size_t size() const
+            {
+                return std::size(m_path_costs);
+            }
+
+            bool empty() const
+            {
+                return std::empty(m_path_costs);
+            }
+
+            const std::pmr::vector<entry_view_type>& entries() const
+            {
+                return m_entries;
+            }
+
+            const std::pmr::vector<cost_type>& path_costs() const
+            {
+                return m_path_costs;
+            }
+
+            std::pmr::vector<cost_type>& next_preceding_edge_costs()
+            {
+                // The edge cost buffers are allocated in the memory resource of the step. They are not destroyed on
+                // clear() but recycled here.
+                if (std::size(m_preceding_edge_costs) <= size())
+                {
+                    m_preceding_edge_costs.emplace_back();
+                }
+                auto& costs = m_preceding_edge_costs[size()];
+                costs.clear();
+                return costs;
+            }
+
+            const std::pmr::vector<node_type>& nodes() const
+            {
+                // The nodes are materialized from the columns on demand.
+                // Since nodes are only appended to a step, the already materialized ones are kept as they are.
+                if (std::size(m_nodes) < size())
+                {
+                    m_nodes.reserve(size());
+                    for (auto i = std::size(m_nodes); i < size(); ++i)
+                    {
+                        m_nodes.emplace_back(
+                            m_entries[i].p_key(),
+                            m_entries[i].value(),
+                            i,
+                            m_preceding_steps[i],
+                            std::span<const cost_type>{ m_preceding_edge_costs[i] },
+                            m_best_preceding_nodes[i],
+                            m_entries[i].cost(),
+                            m_path_costs[i]);
+                    }
+                }
+                return m_nodes;
+            }
+
+            void push_back(
+                const entry_view_type& entry,
+                const std::size_t      preceding_step,
+                const std::size_t      best_preceding_node,
+                const cost_type        path_cost)
+            {
+                assert(size() < std::size(m_preceding_edge_costs));
+                m_entries.push_back(entry);
+                m_preceding_steps.push_back(preceding_step);
+                m_best_preceding_nodes.push_back(best_preceding_node);
+                m_path_costs.push_back(path_cost);
+            }
+
+            void reserve(const std::size_t capacity)
+            {
+                m_entries.reserve(capacity);
+                m_preceding_steps.reserve(capacity);
+                m_preceding_edge_costs.reserve(capacity);
+                m_best_preceding_nodes.reserve(capacity);
+                m_path_costs.reserve(capacity);
+            }
+
+            void clear(const std::size_t input_tail)
+            {
+                m_input_tail = input_tail;
+                m_entries.clear();
+                m_preceding_steps.clear();
+                m_best_preceding_nodes.clear();
+                m_path_costs.clear();
+                m_nodes.clear();
+            }
+
+
+        private:
+            // variables
+
+            std::size_t m_input_tail;
+
+            std::pmr::vector<entry_view_type> m_entries;
+
+            std::pmr::vector<std::size_t> m_preceding_steps;
+
+            std::pmr::vector<std::pmr::vector<cost_type>> m_preceding_edge_costs;
+
+            std::pmr::vector<std::size_t> m_best_preceding_nodes;
+
+            std::pmr::vector<cost_type> m_path_costs;
+
+            mutable std::pmr::vector<node_type> m_nodes;
+        };
+
+
+        // static functions
+
+        static std::unique_ptr<std::pmr::monotonic_buffer_resource>
+        make_arena(std::pmr::memory_resource* const p_upstream)
+        {
+            if (!p_upstream)
+            {
+                throw std::invalid_argument{ "p_memory_resource is nullptr." };
+            }
+
+            return std::make_unique<std::pmr::monotonic_buffer_resource>(p_upstream);
+        }
+
+        static graph_step bos_step(std::pmr::memory_resource* const p_memory_resource)
+        {
+            graph_step step{ 0, p_memory_resource };
+            reset_bos_step(step);
+            return step;
+        }
+
+        static void reset_bos_step(graph_step& step)
+        {
+            step.clear(0);
+            step.next_preceding_edge_costs();
+            step.push_back(
+                entry_view_type::bos_eos(),
+                std::numeric_limits<std::size_t>::max(),
+                std::numeric_limits<std::size_t>::max(),
+                cost_type{});
+        }
+
+        static std::size_t
+        best_preceding_node_index(const graph_step& step, const std::span<const cost_type> edge_costs)
+        {
+            const auto& path_costs = step.path_costs();
+            assert(!std::empty(path_costs));
+            assert(std::size(edge_costs) == std::size(path_costs));
+            auto min_index = static_cast<std::size_t>(0);
+            auto min_cost = cost_traits<cost_type>::add(path_costs[0], edge_costs[0]);
+            for (auto i = static_cast<std::size_t>(1); i < std::size(path_costs); ++i)
+            {
+                const auto cost = cost_traits<cost_type>::add(path_costs[i], edge_costs[i]);
+                if (cost < min_cost)
+                {
+                    min_index = i;
+                    min_cost = cost;
+                }
+            }
+            return min_index;
+        }
+
+        static std::optional<std::string_view> key_text(const input* const p_key)
+        {
+            if (!p_key)
+            {
+                return std::nullopt;
+            }
+            if (p_key->is<string_view_input>())
+            {
+                return p_key->as<string_view_input>().value();
+            }
+            if (p_key->is<string_input>())
+            {
+                return std::string_view{ p_key->as<string_input>().value() };
+            }
+            return std::nullopt;
+        }
+
+        static void write_json_string(std::ostream& stream, const std::string_view& string)
+        {
+            static constexpr char hex_digits[] = "0123456789abcdef";
+            stream << '"';
+            for (const auto c: string)
+            {
+                if (c == '"' || c == '\\')
+                {
+                    stream << '\\' << c;
+                }
+                else if (static_cast<unsigned char>(c) < 0x20)
+                {
+                    stream << "\\u00" << hex_digits[(c >> 4) & 0x0F] << hex_digits[c & 0x0F];
+                }
+                else
+                {
+                    stream << c;
+                }
+            }
+            stream << '"';
+        }
+
+        static void write_graphviz_string(std::ostream& stream, const std::string_view& string)
+        {
+            for (const auto c: string)
+            {
+                if (c == '"' || c == '\\')
+                {
+                    stream << '\\';
+                }
+                stream << c;
+            }
+        }
+
+
+        // variables
+
+        const vocabulary_type& m_vocabulary;
+
+        const std::unique_ptr<std::pmr::monotonic_buffer_resource> m_p_arena;
+
+        std::pmr::memory_resource* const m_p_memory_resource;
+
+        std::unique_ptr<input> m_p_input;
+
+        std::pmr::vector<graph_step> m_graph;
+
+        std::pmr::vector<entry_view_type> m_found_entries;
+
+        std::pmr::vector<std::pair<std::size_t, std::size_t>> m_found_entry_ends;
+
+        std::size_t m_first_step;
+
+        std::size_t m_step_count;
+
+        std::size_t m_input_offset;
+
+        const bool m_profile_enabled;
+
+        lattice_counters m_counters;
+
+
+        // functions
+
+        graph_step& step_at(const std::size_t step)
+        {
+            assert(m_first_step <= step && step < m_step_count);
+            return m_graph[step - m_first_step];
+        }
+
+        const graph_step& step_at(const std::size_t step) const
+        {
+            assert(m_first_step <= step && step < m_step_count);
+            return m_graph[step - m_first_step];
+        }
+
+        graph_step& next_step(const std::size_t input_tail)
+        {
+            // The steps beyond the step count are the ones left by clear() or commit(). They are recycled with their
+            // capacity.
+            if (m_step_count - m_first_step < std::size(m_graph))
+            {
+                auto& step = m_graph[m_step_count - m_first_step];
+                step.clear(input_tail);
+                return step;
+            }
+            else
+            {
+                return m_graph.emplace_back(input_tail, m_p_memory_resource);
+            }
+        }
+
+        std::size_t emit_best_path(
+            const std::size_t                             last_step,
+            const std::size_t                             last_index_in_step,
+            const std::function<void(const node_type&)>& emit) const
+        {
+            std::vector<const node_type*> p_nodes{};
+            for (auto step = last_step, index_in_step = last_index_in_step; step > m_first_step;)
+            {
+                const auto& node_ = step_at(step).nodes()[index_in_step];
+                p_nodes.push_back(&node_);
+                step = node_.preceding_step();
+                index_in_step = node_.best_preceding_node();
+            }
+
+            std::for_each(std::rbegin(p_nodes), std::rend(p_nodes), [&emit](const auto* const p_node) {
+                emit(*p_node);
+            });
+            return std::size(p_nodes);
+        }
+
+        void drop_steps_before(const std::size_t step)
+        {
+            // The dropped steps are moved behind the live ones so that next_step() recycles them.
+            assert(m_first_step < step && step < m_step_count);
+            std::rotate(
+                std::begin(m_graph),
+                std::next(std::begin(m_graph), step - m_first_step),
+                std::next(std::begin(m_graph), m_step_count - m_first_step));
+            const auto new_input_offset = m_graph[0].input_tail();
+            m_p_input = m_p_input->create_subrange(
+                new_input_offset - m_input_offset, m_input_offset + m_p_input->length() - new_input_offset);
+            m_input_offset = new_input_offset;
+            m_first_step = step;
+        }
+
+        void fill_preceding_edge_costs(
+            const graph_step&          step,
+            const entry_view_type&     next_entry,
+            const std::span<cost_type> costs)
+        {
+            assert(!step.empty());
+            assert(std::size(costs) == step.size());
+            // The nodes are materialized only for a vocabulary which needs more than the entries of the nodes.
+            if (!m_vocabulary.find_entry_connections(step.entries(), next_entry, costs))
+            {
+                m_vocabulary.find_connections(step.nodes(), next_entry, costs);
+            }
+            if (m_profile_enabled)
+            {
+                m_counters.connection_lookup_count += step.size();
+            }
+        }
+    };
+
+
+    extern template class basic_lattice<std::any>;
+
+
+    /*!
+        \brief A lattice.
+    */
+    using lattice = basic_lattice<std::any>;
+
+
+}
+
+
+#endif
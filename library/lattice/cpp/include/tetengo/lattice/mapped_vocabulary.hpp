@@ -0,0 +1,137 @@
+/*! \file
+    \brief A mapped vocabulary.
+
+    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
+*/
+
+#if !defined(TETENGO_LATTICE_MAPPEDVOCABULARY_HPP)
+#define TETENGO_LATTICE_MAPPEDVOCABULARY_HPP
+
+#include <any>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <memory_resource>
+#include <ostream>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/interprocess/file_mapping.hpp> // IWYU pragma: keep
+
+#include <tetengo/lattice/connection.hpp>
+#include <tetengo/lattice/entry.hpp>
+#include <tetengo/lattice/vocabulary.hpp>
+
+
+namespace tetengo::lattice
+{
+    class input;
+
+
+    /*!
+        \brief A mapped vocabulary.
+
+        A mapped vocabulary refers to a compiled vocabulary file mapped into the memory.
+        The file is written by write().
+        Loading it does not parse nor copy the keys, the entries and the connections, and the processes mapping the
+        same file share the pages.
+        The state for a key is created on its first lookup, and the offsets and the lengths in the records are checked
+        then. A lookup throws std::runtime_error when they are out of the content.
+        The connections of the entries found in the vocabulary are looked up from the addresses of their values,
+        without searching the keys nor taking a lock.
+
+        The keys to find entries must be string_input or string_view_input.
+        The values of the entries are std::string_views to the serialized bytes in the file.
+        The keys of the entries are string_inputs.
+    */
+    class mapped_vocabulary : public vocabulary
+    {
+    public:
+        // static functions
+
+        /*!
+            \brief Writes a compiled vocabulary.
+
+            The connections whose origin or destination is not in the entries nor BOS/EOS are not written.
+            The numbers are written in the native byte order.
+
+            \param output_stream    An output stream.
+            \param entries          Entries.
+            \param connections      Connections.
+            \param entry_hash       A hash function for an entry.
+            \param entry_equal_to   An equal_to function for an entry.
+            \param value_serializer A serializer for the values of the entries.
+
+            \throw std::length_error When the entries are too many.
+        */
+        static void write(
+            std::ostream&                                                    output_stream,
+            const std::vector<std::pair<std::string, std::vector<entry>>>&   entries,
+            const std::vector<std::pair<std::pair<entry, entry>, int>>&      connections,
+            const std::function<std::size_t(const entry_view&)>&             entry_hash,
+            const std::function<bool(const entry_view&, const entry_view&)>& entry_equal_to,
+            const std::function<std::string(const std::any&)>&               value_serializer);
+
+
+        // constructors and destructor
+
+        /*!
+            \brief Creates a mapped vocabulary.
+
+            \param file_mapping_  A file mapping.
+            \param content_offset A content offset in the file.
+            \param file_size      The file size.
+
+            \throw std::invalid_argument When content_offset is greater than file_size, or the content is not a compiled
+                                         vocabulary.
+        */
+        mapped_vocabulary(
+            const boost::interprocess::file_mapping& file_mapping_,
+            std::size_t                              content_offset,
+            std::size_t                              file_size);
+
+        /*!
+            \brief Destroys the mapped vocabulary.
+        */
+        virtual ~mapped_vocabulary();
+
+
+    private:
+        // types
+
+        class impl;
+
+
+        // variables
+
+        std::unique_ptr<impl> m_p_impl;
+
+
+        // virtual functions
+
+        virtual std::vector<entry_view> find_entries_impl(const input& key) const override;
+
+        virtual void find_subrange_entries_impl(
+            const input&                  input_,
+            std::size_t                   offset,
+            std::size_t                   length,
+            std::pmr::vector<entry_view>& entries) const override;
+
+        virtual connection find_connection_impl(const node& from, const entry_view& to) const override;
+
+        virtual void
+        find_connections_impl(std::span<const node> from, const entry_view& to, std::span<int> costs) const override;
+
+        virtual bool find_entry_connections_impl(
+            std::span<const entry_view> from,
+            const entry_view&           to,
+            std::span<int>              costs) const override;
+    };
+
+
+}
+
+
+#endif
@@ -1,198 +1,616 @@
-/*! \file
-    \brief An N-best lattice path iterator.
-
-    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
-*/
-
-#if !defined(TETENGO_LATTICE_NBESTITERATOR_HPP)
-#define TETENGO_LATTICE_NBESTITERATOR_HPP
-
-#include <cstddef>
-#include <functional>
-#include <iterator>
-#include <memory>
-#include <queue>
-#include <vector>
-
-#include <boost/operators.hpp>
-#include <boost/stl_interfaces/iterator_interface.hpp>
-
-#include <tetengo/lattice/node.hpp>
-#include <tetengo/lattice/path.hpp>
-
-
-namespace tetengo::lattice
-{
-    class constraint;
-    class lattice;
-
-
-    /*!
-        \brief A cap.
-    */
-    class cap : public boost::less_than_comparable<cap>
-    {
-    public:
-        // constructors and destructor
-
-        /*!
-            \brief Creates a cap.
-
-            \param tail_path       A tail path.
-            \param tail_path_cost  A tail path cost.
-            \param whole_path_cost A whole path cost.
-        */
-        cap(std::vector<node> tail_path, int tail_path_cost, int whole_path_cost);
-
-
-        // functions
-
-        /*!
-            \brief Returns true if one is less than another.
-
-            \param one One cap.
-            \param another Another cap.
-
-            \retval true  When one is less than another.
-            \retval false Otherwise.
-        */
-        friend bool operator<(const cap& one, const cap& another);
-
-        /*!
-            \brief Returns the tail path.
-
-            \return The tail path.
-        */
-        [[nodiscard]] const std::vector<node>& tail_path() const;
-
-        /*!
-            \brief Returns the tail path cost.
-
-            \return The tail path cost.
-        */
-        [[nodiscard]] int tail_path_cost() const;
-
-        /*!
-            \brief Returns the whole path cost.
-
-            \return The whole path cost.
-        */
-        [[nodiscard]] int whole_path_cost() const;
-
-
-    private:
-        // variables
-
-        std::vector<node> m_tail_path;
-
-        int m_tail_path_cost;
-
-        int m_whole_path_cost;
-    };
-
-
-    /*!
-        \brief An N-best lattice path iterator.
-    */
-    class n_best_iterator :
-    public boost::stl_interfaces::iterator_interface<n_best_iterator, std::forward_iterator_tag, path>
-    {
-    public:
-        // constructors and destructor
-
-        /*!
-            \brief Creates an iterator.
-
-            It points to the last of the paths.
-        */
-        n_best_iterator();
-
-        /*!
-            \brief Creates an iterator.
-
-            \param lattice_     A lattice.
-            \param eos_node     An EOS node.
-            \param p_constraint A unique pointer to a constraint.
-
-            \throw std::invalid_argument When p_constraint is nullptr.
-        */
-        n_best_iterator(const lattice& lattice_, node eos_node, std::unique_ptr<constraint>&& p_constraint);
-
-
-        // functions
-
-        /*!
-            \brief Dereferences the iterator.
-
-            \return The dereferenced value.
-        */
-        [[nodiscard]] const path& operator*() const;
-
-        /*!
-            \brief Dereferences the iterator.
-
-            \return The dereferenced value.
-        */
-        [[nodiscard]] path& operator*();
-
-        /*!
-            \brief Returns the pointer to the value.
-
-            \return The pointer to the value.
-        */
-        [[nodiscard]] const path* operator->() const;
-
-        /*!
-            \brief Returns the pointer to the value.
-
-            \return The pointer to the value.
-        */
-        [[nodiscard]] path* operator->();
-
-        /*!
-            \brief Returns true when one iterator is equal to another.
-
-            \param one   One iterator.
-            \param another Another iterator.
-
-            \retval true  When one is equal to another.
-            \retval false Otherwise.
-        */
-        friend bool operator==(const n_best_iterator& one, const n_best_iterator& another);
-
-        /*!
-            \brief Increments the iterator.
-
-            \return This iterator.
-        */
-        n_best_iterator& operator++();
-
-        /*!
-            \brief Postincrements the iterator.
-
-            \return The iterator before the incrementation.
-        */
-        n_best_iterator operator++(int);
-
-
-    private:
-        // variables
-
-        const lattice* m_p_lattice;
-
-        std::priority_queue<cap, std::vector<cap>, std::greater<cap>> m_caps;
-
-        std::size_t m_eos_hash;
-
-        std::shared_ptr<constraint> m_p_constraint;
-
-        path m_path;
-
-        std::size_t m_index;
-    };
-
-
-}
-
-
-#endif
+/*! \file
+    \brief An N-best lattice path iterator.
+
+    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
+*/
+
+#if !defined(TETENGO_LATTICE_NBESTITERATOR_HPP)
+#define TETENGO_LATTICE_NBESTITERATOR_HPP
+
+#include <algorithm>
+#include <any>
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <queue>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <boost/container_hash/hash.hpp>
+#include <boost/operators.hpp>
+#include <boost/stl_interfaces/iterator_interface.hpp>
+
+#include <tetengo/lattice/constraint.hpp>
+#include <tetengo/lattice/cost_traits.hpp>
+#include <tetengo/lattice/input.hpp>
+#include <tetengo/lattice/lattice.hpp>
+#include <tetengo/lattice/node.hpp>
+#include <tetengo/lattice/path.hpp>
+#include <tetengo/lattice/profile.hpp>
+
+
+namespace tetengo::lattice
+{
+    /*!
+        \brief A basic cap.
+
+        \tparam Value A value type.
+        \tparam Cost  A cost type.
+    */
+    template <typename Value, typename Cost = int>
+    class basic_cap : public boost::less_than_comparable<basic_cap<Value, Cost>>
+    {
+    public:
+        // types
+
+        //! The value type.
+        using value_type = Value;
+
+        //! The cost type.
+        using cost_type = typename cost_traits<Cost>::cost_type;
+
+        //! The node type.
+        using node_type = basic_node<value_type, cost_type>;
+
+
+        // constructors and destructor
+
+        /*!
+            \brief Creates a cap.
+
+            \param tail_path        A tail path.
+            \param tail_path_cost   A tail path cost.
+            \param whole_path_cost  A whole path cost.
+            \param constraint_state A constraint matching state after the tail path.
+
+            \throw std::invalid_argument When tail_path is empty.
+        */
+        basic_cap(
+            std::vector<node_type> tail_path,
+            const cost_type        tail_path_cost,
+            const cost_type        whole_path_cost,
+            const std::size_t      constraint_state = 0) :
+        m_p_tail_path{},
+        m_tail_path_length{ std::size(tail_path) },
+        m_tail_path_cost{ tail_path_cost },
+        m_whole_path_cost{ whole_path_cost },
+        m_constraint_state{ constraint_state },
+        m_tail_path_cache{}
+        {
+            if (std::empty(tail_path))
+            {
+                throw std::invalid_argument{ "tail_path is empty." };
+            }
+
+            for (auto& node_: tail_path)
+            {
+                m_p_tail_path = std::make_shared<tail_path_element>(std::move(node_), std::move(m_p_tail_path));
+            }
+        }
+
+        /*!
+            \brief Creates a cap by extending the tail path of a base cap.
+
+            The tail path of the base cap is shared, not copied.
+
+            \param base             A base cap.
+            \param last_node        A node appended to the tail path of the base cap.
+            \param tail_path_cost   A tail path cost.
+            \param whole_path_cost  A whole path cost.
+            \param constraint_state A constraint matching state after the extended tail path.
+        */
+        basic_cap(
+            const basic_cap&  base,
+            node_type         last_node,
+            const cost_type   tail_path_cost,
+            const cost_type   whole_path_cost,
+            const std::size_t constraint_state = 0) :
+        m_p_tail_path{ std::make_shared<tail_path_element>(std::move(last_node), base.m_p_tail_path) },
+        m_tail_path_length{ base.m_tail_path_length + 1 },
+        m_tail_path_cost{ tail_path_cost },
+        m_whole_path_cost{ whole_path_cost },
+        m_constraint_state{ constraint_state },
+        m_tail_path_cache{}
+        {}
+
+
+        // functions
+
+        /*!
+            \brief Returns true if one is less than another.
+
+            \param one One cap.
+            \param another Another cap.
+
+            \retval true  When one is less than another.
+            \retval false Otherwise.
+        */
+        friend bool operator<(const basic_cap& one, const basic_cap& another)
+        {
+            return one.m_whole_path_cost < another.m_whole_path_cost;
+        }
+
+        /*!
+            \brief Returns the tail path.
+
+            The tail path is materialized on the first call, and kept in the cap.
+
+            \return The tail path.
+        */
+        [[nodiscard]] const std::vector<node_type>& tail_path() const
+        {
+            if (std::empty(m_tail_path_cache))
+            {
+                m_tail_path_cache.reserve(m_tail_path_length);
+                for (const auto* p_element = std::to_address(m_p_tail_path); p_element;
+                     p_element = std::to_address(p_element->m_p_next))
+                {
+                    m_tail_path_cache.push_back(p_element->m_node);
+                }
+                std::reverse(std::begin(m_tail_path_cache), std::end(m_tail_path_cache));
+            }
+            return m_tail_path_cache;
+        }
+
+        /*!
+            \brief Returns the last node of the tail path.
+
+            \return The last node of the tail path.
+        */
+        [[nodiscard]] const node_type& last_node() const
+        {
+            assert(m_p_tail_path);
+            return m_p_tail_path->m_node;
+        }
+
+        /*!
+            \brief Returns the tail path cost.
+
+            \return The tail path cost.
+        */
+        [[nodiscard]] cost_type tail_path_cost() const
+        {
+            return m_tail_path_cost;
+        }
+
+        /*!
+            \brief Returns the whole path cost.
+
+            \return The whole path cost.
+        */
+        [[nodiscard]] cost_type whole_path_cost() const
+        {
+            return m_whole_path_cost;
+        }
+
+        /*!
+            \brief Returns the constraint matching state.
+
+            \return The constraint matching state after the tail path.
+        */
+        [[nodiscard]] std::size_t constraint_state() const
+        {
+            return m_constraint_state;
+        }
+
+
+    private:
+        // types
+
+        struct tail_path_element
+        {
+            // constructors and destructor
+
+            tail_path_element(node_type node_, std::shared_ptr<const tail_path_element> p_next) :
+            m_node{ std::move(node_) },
+            m_p_next{ std::move(p_next) }
+            {}
+
+            ~tail_path_element()
+            {
+                // Unlinks the elements owned only by this one iteratively. A recursive destruction would overflow the
+                // stack for a long tail path.
+                auto p_next = std::move(m_p_next);
+                while (p_next && p_next.use_count() == 1)
+                {
+                    p_next = std::move(p_next->m_p_next);
+                }
+            }
+
+
+            // variables
+
+            const node_type m_node;
+
+            mutable std::shared_ptr<const tail_path_element> m_p_next;
+        };
+
+
+        // variables
+
+        std::shared_ptr<const tail_path_element> m_p_tail_path;
+
+        std::size_t m_tail_path_length;
+
+        cost_type m_tail_path_cost;
+
+        cost_type m_whole_path_cost;
+
+        std::size_t m_constraint_state;
+
+        mutable std::vector<node_type> m_tail_path_cache;
+    };
+
+
+    /*!
+        \brief A basic N-best lattice path iterator.
+
+        \tparam Value A value type.
+        \tparam Cost  A cost type.
+    */
+    template <typename Value, typename Cost = int>
+    class basic_n_best_iterator :
+    public boost::stl_interfaces::
+        iterator_interface<basic_n_best_iterator<Value, Cost>, std::forward_iterator_tag, basic_path<Value, Cost>>
+    {
+    public:
+        // types
+
+        //! The cost type.
+        using cost_type = typename cost_traits<Cost>::cost_type;
+
+        //! The path type.
+        using path_type = basic_path<Value, cost_type>;
+
+        //! The node type.
+        using node_type = basic_node<Value, cost_type>;
+
+        //! The lattice type.
+        using lattice_type = basic_lattice<Value, cost_type>;
+
+        //! The constraint type.
+        using constraint_type = basic_constraint<Value, cost_type>;
+
+        //! The cap type.
+        using cap_type = basic_cap<Value, cost_type>;
+
+
+        // constructors and destructor
+
+        /*!
+            \brief Creates an iterator.
+
+            It points to the last of the paths.
+        */
+        basic_n_best_iterator() :
+        m_p_lattice{},
+        m_caps{},
+        m_eos_hash{ 0 },
+        m_p_constraint{ std::make_shared<constraint_type>() },
+        m_path{},
+        m_index{ 0 },
+        m_counters{}
+        {}
+
+        /*!
+            \brief Creates an iterator.
+
+            \param lattice_     A lattice.
+            \param eos_node     An EOS node.
+            \param p_constraint A unique pointer to a constraint.
+
+            \throw std::invalid_argument When p_constraint is nullptr.
+        */
+        basic_n_best_iterator(
+            const lattice_type&                lattice_,
+            node_type                          eos_node,
+            std::unique_ptr<constraint_type>&& p_constraint) :
+        m_p_lattice{ &lattice_ },
+        m_caps{},
+        m_eos_hash{ calc_node_hash(eos_node) },
+        m_p_constraint{ std::move(p_constraint) },
+        m_path{},
+        m_index{ 0 },
+        m_counters{}
+        {
+            if (!m_p_constraint)
+            {
+                throw std::invalid_argument{ "p_constraint is nullptr." };
+            }
+
+            const auto tail_path_cost = eos_node.node_cost();
+            const auto whole_path_cost = eos_node.path_cost();
+            const auto constraint_state = m_p_constraint->next_state(m_p_constraint->initial_state(), eos_node);
+            m_caps.emplace(
+                std::vector<node_type>{ std::move(eos_node) }, tail_path_cost, whole_path_cost, constraint_state);
+            if (profile_enabled())
+            {
+                ++m_counters.cap_push_count;
+            }
+
+            m_path = open_cap(*m_p_lattice, m_caps, *m_p_constraint, m_counters);
+        }
+
+
+        // functions
+
+        /*!
+            \brief Dereferences the iterator.
+
+            \return The dereferenced value.
+        */
+        [[nodiscard]] const path_type& operator*() const
+        {
+            if (std::empty(m_path))
+            {
+                throw std::logic_error{ "No more path." };
+            }
+
+            return m_path;
+        }
+
+        /*!
+            \brief Dereferences the iterator.
+
+            \return The dereferenced value.
+        */
+        [[nodiscard]] path_type& operator*()
+        {
+            if (std::empty(m_path))
+            {
+                throw std::logic_error{ "No more path." };
+            }
+
+            return m_path;
+        }
+
+        /*!
+            \brief Returns the pointer to the value.
+
+            \return The pointer to the value.
+        */
+        [[nodiscard]] const path_type* operator->() const
+        {
+            return &operator*();
+        }
+
+        /*!
+            \brief Returns the pointer to the value.
+
+            \return The pointer to the value.
+        */
+        [[nodiscard]] path_type* operator->()
+        {
+            return &operator*();
+        }
+
+        /*!
+            \brief Returns true when one iterator is equal to another.
+
+            \param one   One iterator.
+            \param another Another iterator.
+
+            \retval true  When one is equal to another.
+            \retval false Otherwise.
+        */
+        friend bool operator==(const basic_n_best_iterator& one, const basic_n_best_iterator& another)
+        {
+            if (std::empty(one.m_path) && std::empty(another.m_path))
+            {
+                return true;
+            }
+
+            return one.m_p_lattice == another.m_p_lattice && one.m_eos_hash == another.m_eos_hash &&
+                   one.m_index == another.m_index;
+        }
+
+        /*!
+            \brief Increments the iterator.
+
+            \return This iterator.
+        */
+        basic_n_best_iterator& operator++()
+        {
+            if (std::empty(m_path))
+            {
+                throw std::logic_error{ "No more path." };
+            }
+
+            if (std::empty(m_caps))
+            {
+                m_path = path_type{};
+            }
+            else
+            {
+                m_path = open_cap(*m_p_lattice, m_caps, *m_p_constraint, m_counters);
+            }
+            ++m_index;
+
+            return *this;
+        }
+
+        /*!
+            \brief Postincrements the iterator.
+
+            \return The iterator before the incrementation.
+        */
+        basic_n_best_iterator operator++(int)
+        {
+            basic_n_best_iterator original{ *this };
+            ++(*this);
+            return original;
+        }
+
+        /*!
+            \brief Returns the profile counters.
+
+            \return The profile counters. All zero unless profile_enabled() returns true.
+        */
+        [[nodiscard]] const n_best_counters& counters() const
+        {
+            return m_counters;
+        }
+
+
+    private:
+        // static functions
+
+        static std::size_t calc_node_hash(const node_type& node_)
+        {
+            auto seed = static_cast<std::size_t>(0);
+            boost::hash_combine(seed, node_.p_key() ? node_.p_key()->hash_value() : 0);
+            boost::hash_combine(seed, boost::hash_value(node_.preceding_step()));
+            const auto preceding_edge_costs = node_.preceding_edge_costs();
+            boost::hash_combine(
+                seed, boost::hash_range(std::begin(preceding_edge_costs), std::end(preceding_edge_costs)));
+            boost::hash_combine(seed, boost::hash_value(node_.best_preceding_node()));
+            boost::hash_combine(seed, boost::hash_value(node_.node_cost()));
+            boost::hash_combine(seed, boost::hash_value(node_.path_cost()));
+            return seed;
+        }
+
+        static path_type open_cap(
+            const lattice_type&                                                           lattice_,
+            std::priority_queue<cap_type, std::vector<cap_type>, std::greater<cap_type>>& caps,
+            const constraint_type&                                                        constraint_,
+            n_best_counters&                                                              counters)
+        {
+            const profile_timer timer{ counters.open_duration };
+            const auto          profiled = profile_enabled();
+
+            path_type path_{};
+            while (!std::empty(caps))
+            {
+                // The caps share their tail paths. Only the path of the opened cap is materialized here.
+                auto next_cap = caps.top();
+                caps.pop();
+                if (profiled)
+                {
+                    ++counters.cap_open_count;
+                }
+
+                auto next_path = next_cap.tail_path();
+                auto constraint_state = next_cap.constraint_state();
+                assert(constraint_state != std::numeric_limits<std::size_t>::max());
+                bool nonconforming_path = false;
+                for (const auto* p_node = &next_cap.last_node(); !p_node->is_bos();)
+                {
+                    const auto  tail_path_cost = next_cap.tail_path_cost();
+                    const auto& preceding_nodes = lattice_.nodes_at(p_node->preceding_step());
+                    for (auto i = static_cast<std::size_t>(0); i < std::size(preceding_nodes); ++i)
+                    {
+                        if (i == p_node->best_preceding_node())
+                        {
+                            continue;
+                        }
+                        const auto& preceding_node = preceding_nodes[i];
+                        const auto  preceding_constraint_state =
+                            constraint_.next_state(constraint_state, preceding_node);
+                        if (preceding_constraint_state == std::numeric_limits<std::size_t>::max())
+                        {
+                            continue;
+                        }
+                        const auto preceding_edge_cost = p_node->preceding_edge_costs()[i];
+                        const auto cap_tail_path_cost = cost_traits<cost_type>::add(
+                            cost_traits<cost_type>::add(tail_path_cost, preceding_edge_cost),
+                            preceding_node.node_cost());
+                        if (cost_traits<cost_type>::is_infinity(cap_tail_path_cost))
+                        {
+                            continue;
+                        }
+                        const auto cap_whole_path_cost = cost_traits<cost_type>::add(
+                            cost_traits<cost_type>::add(tail_path_cost, preceding_edge_cost),
+                            preceding_node.path_cost());
+                        if (cost_traits<cost_type>::is_infinity(cap_whole_path_cost))
+                        {
+                            continue;
+                        }
+                        caps.emplace(
+                            next_cap,
+                            preceding_node,
+                            cap_tail_path_cost,
+                            cap_whole_path_cost,
+                            preceding_constraint_state);
+                        if (profiled)
+                        {
+                            ++counters.cap_push_count;
+                        }
+                    }
+
+                    const auto best_preceding_edge_cost = p_node->preceding_edge_costs()[p_node->best_preceding_node()];
+                    const auto& best_preceding_node = preceding_nodes[p_node->best_preceding_node()];
+                    next_path.push_back(best_preceding_node);
+                    constraint_state = constraint_.next_state(constraint_state, best_preceding_node);
+                    if (constraint_state == std::numeric_limits<std::size_t>::max())
+                    {
+                        nonconforming_path = true;
+                        break;
+                    }
+                    next_cap = cap_type{ next_cap,
+                                         best_preceding_node,
+                                         cost_traits<cost_type>::add(
+                                             tail_path_cost,
+                                             cost_traits<cost_type>::add(
+                                                 best_preceding_edge_cost, best_preceding_node.node_cost())),
+                                         next_cap.whole_path_cost(),
+                                         constraint_state };
+
+                    p_node = &next_cap.last_node();
+                }
+
+                if (!nonconforming_path)
+                {
+                    assert(constraint_state == 0);
+                    assert(constraint_.matches(next_path));
+                    path_ = path_type{ std::vector<node_type>{ std::rbegin(next_path), std::rend(next_path) },
+                                       next_cap.whole_path_cost() };
+                    break;
+                }
+            }
+
+            return path_;
+        }
+
+
+        // variables
+
+        const lattice_type* m_p_lattice;
+
+        std::priority_queue<cap_type, std::vector<cap_type>, std::greater<cap_type>> m_caps;
+
+        std::size_t m_eos_hash;
+
+        std::shared_ptr<constraint_type> m_p_constraint;
+
+        path_type m_path;
+
+        std::size_t m_index;
+
+        n_best_counters m_counters;
+    };
+
+
+    extern template class basic_cap<std::any>;
+
+    extern template class basic_n_best_iterator<std::any>;
+
+
+    /*!
+        \brief A cap.
+    */
+    using cap = basic_cap<std::any>;
+
+    /*!
+        \brief An N-best lattice path iterator.
+    */
+    using n_best_iterator = basic_n_best_iterator<std::any>;
+
+
+}
+
+
+#endif
@@ -1,61 +1,84 @@
-/*! \file
-    \brief A node constraint element.
-
-    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
-*/
-
-#if !defined(TETENGO_LATTICE_NODECONSTRAINTELEMENT_HPP)
-#define TETENGO_LATTICE_NODECONSTRAINTELEMENT_HPP
-
-#include <memory>
-
-#include <tetengo/lattice/constraint_element.hpp>
-
-
-namespace tetengo::lattice
-{
-    class node;
-
-
-    /*!
-        \brief A node constraint element.
-    */
-    class node_constraint_element : public constraint_element
-    {
-    public:
-        // constructors and destructor
-
-        /*!
-            \brief Creates a node constraint element.
-
-            \param node_ A node.
-        */
-        explicit node_constraint_element(node node_);
-
-        /*!
-            \brief Destroys the node constraint element.
-        */
-        virtual ~node_constraint_element();
-
-
-    private:
-        // types
-
-        class impl;
-
-
-        // variables
-
-        std::unique_ptr<impl> m_p_impl;
-
-
-        // virtual functions
-
-        virtual int matches_impl(const node& node_) const override;
-    };
-
-
-}
-
-
-#endif
+/*! \file
+    \brief A node constraint element.
+
+    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
+*/
+
+#if !defined(TETENGO_LATTICE_NODECONSTRAINTELEMENT_HPP)
+#define TETENGO_LATTICE_NODECONSTRAINTELEMENT_HPP
+
+#include <any>
+#include <utility>
+
+#include <tetengo/lattice/constraint_element.hpp>
+#include <tetengo/lattice/cost_traits.hpp>
+#include <tetengo/lattice/node.hpp>
+
+
+namespace tetengo::lattice
+{
+    /*!
+        \brief A basic node constraint element.
+
+        \tparam Value A value type.
+        \tparam Cost  A cost type.
+    */
+    template <typename Value, typename Cost = int>
+    class basic_node_constraint_element : public basic_constraint_element<Value, Cost>
+    {
+    public:
+        // types
+
+        //! The value type.
+        using value_type = Value;
+
+        //! The cost type.
+        using cost_type = typename cost_traits<Cost>::cost_type;
+
+        //! The node type.
+        using node_type = basic_node<value_type, cost_type>;
+
+
+        // constructors and destructor
+
+        /*!
+            \brief Creates a node constraint element.
+
+            \param node_ A node.
+        */
+        explicit basic_node_constraint_element(node_type node_) : m_node{ std::move(node_) } {}
+
+        /*!
+            \brief Destroys the node constraint element.
+        */
+        virtual ~basic_node_constraint_element() = default;
+
+
+    private:
+        // variables
+
+        const node_type m_node;
+
+
+        // virtual functions
+
+        virtual int matches_impl(const node_type& node_) const override
+        {
+            return node_ == m_node ? 0 : -1;
+        }
+    };
+
+
+    extern template class basic_node_constraint_element<std::any>;
+
+
+    /*!
+        \brief A node constraint element.
+    */
+    using node_constraint_element = basic_node_constraint_element<std::any>;
+
+
+}
+
+
+#endif
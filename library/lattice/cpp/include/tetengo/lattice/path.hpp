@@ -1,76 +1,114 @@
-/*! \file
-    \brief A path.
-
-    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
-*/
-
-#if !defined(TETENGO_LATTICE_PATH_HPP)
-#define TETENGO_LATTICE_PATH_HPP
-
-#include <vector>
-
-#include <tetengo/lattice/node.hpp>
-
-
-namespace tetengo::lattice
-{
-    /*!
-        \brief A path.
-    */
-    class path
-    {
-    public:
-        // constructors and destructor
-
-        /*!
-            \brief Creates an empty path.
-        */
-        path();
-
-        /*!
-            \brief Creates a path.
-
-            \param nodes Nodes.
-            \param cost  A cost.
-        */
-        path(std::vector<node> nodes, int cost);
-
-
-        // functions
-
-        /*!
-            \brief Returns true when this path is empty.
-
-            \retval true  When this path is empty.
-            \retval false Otherwise.
-        */
-        [[nodiscard]] bool empty() const;
-
-        /*!
-            \brief Returns the nodes.
-
-            \return The nodes.
-        */
-        [[nodiscard]] const std::vector<node>& nodes() const;
-
-        /*!
-            \brief Returns the cost.
-
-            \return The cost.
-        */
-        [[nodiscard]] int cost() const;
-
-
-    private:
-        // variables
-
-        std::vector<node> m_nodes;
-
-        int m_cost;
-    };
-
-
-}
-
-
-#endif
+/*! \file
+    \brief A path.
+
+    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
+*/
+
+#if !defined(TETENGO_LATTICE_PATH_HPP)
+#define TETENGO_LATTICE_PATH_HPP
+
+#include <any>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include <tetengo/lattice/cost_traits.hpp>
+#include <tetengo/lattice/node.hpp>
+
+
+namespace tetengo::lattice
+{
+    /*!
+        \brief A basic path.
+
+        \tparam Value A value type.
+        \tparam Cost  A cost type.
+    */
+    template <typename Value, typename Cost = int>
+    class basic_path
+    {
+    public:
+        // types
+
+        //! The value type.
+        using value_type = Value;
+
+        //! The cost type.
+        using cost_type = typename cost_traits<Cost>::cost_type;
+
+        //! The node type.
+        using node_type = basic_node<value_type, cost_type>;
+
+
+        // constructors and destructor
+
+        /*!
+            \brief Creates an empty path.
+        */
+        basic_path() : m_nodes{}, m_cost{} {}
+
+        /*!
+            \brief Creates a path.
+
+            \param nodes Nodes.
+            \param cost  A cost.
+        */
+        basic_path(std::vector<node_type> nodes, const cost_type cost) : m_nodes{ std::move(nodes) }, m_cost{ cost } {}
+
+
+        // functions
+
+        /*!
+            \brief Returns true when this path is empty.
+
+            \retval true  When this path is empty.
+            \retval false Otherwise.
+        */
+        [[nodiscard]] bool empty() const
+        {
+            return std::empty(m_nodes);
+        }
+
+        /*!
+            \brief Returns the nodes.
+
+            \return The nodes.
+        */
+        [[nodiscard]] const std::vector<node_type>& nodes() const
+        {
+            return m_nodes;
+        }
+
+        /*!
+            \brief Returns the cost.
+
+            \return The cost.
+        */
+        [[nodiscard]] cost_type cost() const
+        {
+            return m_cost;
+        }
+
+
+    private:
+        // variables
+
+        std::vector<node_type> m_nodes;
+
+        cost_type m_cost;
+    };
+
+
+    extern template class basic_path<std::any>;
+
+
+    /*!
+        \brief A path.
+    */
+    using path = basic_path<std::any>;
+
+
+}
+
+
+#endif
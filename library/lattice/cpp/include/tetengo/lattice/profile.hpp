@@ -0,0 +1,122 @@
+/*! \file
+    \brief A profile.
+
+    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
+*/
+
+#if !defined(TETENGO_LATTICE_PROFILE_HPP)
+#define TETENGO_LATTICE_PROFILE_HPP
+
+#include <chrono>
+#include <cstddef>
+
+#include <boost/core/noncopyable.hpp>
+
+
+namespace tetengo::lattice
+{
+    /*!
+        \brief Returns true when the profile counters are enabled.
+
+        The counters are enabled when the library is built with the macro TETENGO_LATTICE_PROFILE defined.
+        Otherwise they are compiled out and always zero.
+
+        \retval true  When the profile counters are enabled.
+        \retval false Otherwise.
+    */
+    [[nodiscard]] bool profile_enabled();
+
+
+    /*!
+        \brief Profile counters of a lattice.
+
+        The counters are cumulative since the construction of the lattice. Neither clear() nor reset() of the lattice
+        resets them.
+    */
+    struct lattice_counters
+    {
+        //! The count of the find_entries() calls to the vocabulary.
+        std::size_t entry_lookup_count{ 0 };
+
+        //! The count of the find_connection() calls to the vocabulary, namely the count of the evaluated edges.
+        std::size_t connection_lookup_count{ 0 };
+
+        //! The count of the nodes added to the steps.
+        std::size_t node_count{ 0 };
+
+        //! The total duration of push_back().
+        std::chrono::nanoseconds push_back_duration{ 0 };
+
+        //! The total duration of settle().
+        std::chrono::nanoseconds settle_duration{ 0 };
+    };
+
+
+    /*!
+        \brief Profile counters of an N-best iterator.
+
+        The counters are cumulative since the construction of the iterator, and copied with it.
+    */
+    struct n_best_counters
+    {
+        //! The count of the caps pushed into the queue.
+        std::size_t cap_push_count{ 0 };
+
+        //! The count of the caps popped from the queue and opened.
+        std::size_t cap_open_count{ 0 };
+
+        //! The total duration of opening the caps to make the paths.
+        std::chrono::nanoseconds open_duration{ 0 };
+    };
+
+
+    /*!
+        \brief A profile timer.
+
+        Adds the duration from its construction to its destruction to a counter.
+        It does nothing when the profile counters are disabled.
+    */
+    class profile_timer : private boost::noncopyable
+    {
+    public:
+        // constructors and destructor
+
+        /*!
+            \brief Creates a profile timer.
+
+            \param duration A duration counter.
+        */
+        explicit profile_timer(std::chrono::nanoseconds& duration) :
+        m_duration{ duration },
+        m_enabled{ profile_enabled() },
+        m_start{ m_enabled ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point{} }
+        {}
+
+        /*!
+            \brief Destroys the profile timer.
+        */
+        ~profile_timer()
+        {
+            if (m_enabled)
+            {
+                m_duration += std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now() - m_start);
+            }
+        }
+
+
+    private:
+        // variables
+
+        std::chrono::nanoseconds& m_duration;
+
+        const bool m_enabled;
+
+        const std::chrono::steady_clock::time_point m_start;
+    };
+
+
+}
+
+
+#endif
@@ -0,0 +1,105 @@
+/*! \file
+    \brief A string view input.
+
+    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
+*/
+
+#if !defined(TETENGO_LATTICE_STRINGVIEWINPUT_HPP)
+#define TETENGO_LATTICE_STRINGVIEWINPUT_HPP
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include <tetengo/lattice/input.hpp>
+
+namespace tetengo::lattice
+{
+    /*!
+        \brief A string view input.
+
+        A string view input refers to a range of a string buffer shared with other string view inputs.
+        Its subranges refer to the same buffer, so creating a subrange does not copy the characters.
+        An input holds just the buffer, an offset and a length, and creating a subrange allocates only the input.
+        Appending another input to the input whose range reaches the end of the buffer extends the buffer in place.
+
+        The string view inputs sharing a buffer must not be used concurrently.
+    */
+    class string_view_input : public input
+    {
+    public:
+        // constructors and destructor
+
+        /*!
+            \brief Creates a string view input with a new buffer.
+
+            \param value A value.
+        */
+        explicit string_view_input(std::string value);
+
+        /*!
+            \brief Creates a string view input referring to a buffer.
+
+            \param p_buffer A shared pointer to a buffer.
+            \param offset   An offset.
+            \param length   A length.
+
+            \throw std::invalid_argument When p_buffer is nullptr.
+            \throw std::out_of_range     When offset and/or length are out of the range of the buffer.
+        */
+        string_view_input(std::shared_ptr<std::string> p_buffer, std::size_t offset, std::size_t length);
+
+        /*!
+            \brief Destroys the string view input.
+        */
+        virtual ~string_view_input();
+
+
+        // functions
+
+        /*!
+            \brief Returns the value.
+
+            The value is valid until another input is appended to a string view input sharing the buffer.
+
+            \return The value.
+        */
+        [[nodiscard]] std::string_view value() const;
+
+
+    private:
+        // variables
+
+        std::shared_ptr<std::string> m_p_buffer;
+
+        std::size_t m_offset;
+
+        std::size_t m_length;
+
+
+        // virtual functions
+
+        virtual bool equal_to_impl(const input& another) const override;
+
+        virtual std::size_t hash_value_impl() const override;
+
+        virtual std::size_t length_impl() const override;
+
+        virtual std::unique_ptr<input> clone_impl() const override;
+
+        virtual std::unique_ptr<input> create_subrange_impl(std::size_t offset, std::size_t length) const override;
+
+        virtual void append_impl(std::unique_ptr<input>&& p_another) override;
+
+
+        // functions
+
+        void append_to_buffer(const std::string_view& another_value);
+    };
+
+
+}
+
+
+#endif
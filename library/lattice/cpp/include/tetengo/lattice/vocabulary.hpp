@@ -1,77 +1,234 @@
-/*! \file
-    \brief A vocabulary.
-
-    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
-*/
-
-#if !defined(TETENGO_LATTICE_VOCABULARY_HPP)
-#define TETENGO_LATTICE_VOCABULARY_HPP
-
-#include <vector>
-
-#include <boost/core/noncopyable.hpp>
-
-#include <tetengo/lattice/entry.hpp>
-
-
-namespace tetengo::lattice
-{
-    class connection;
-    class input;
-    class node;
-
-
-    /*!
-        \brief A vocabulary.
-    */
-    class vocabulary : private boost::noncopyable
-    {
-    public:
-        // constructors and destructor
-
-        /*!
-            \brief Creates a vocabulary.
-        */
-        vocabulary();
-
-        /*!
-            \brief Destroys the vocabulary.
-        */
-        virtual ~vocabulary();
-
-
-        // functions
-
-        /*!
-            \brief Finds entries.
-
-            \param key A key.
-
-            \return Entry views.
-        */
-        [[nodiscard]] std::vector<entry_view> find_entries(const input& key) const;
-
-        /*!
-            \brief Finds a connection between an origin node and a destination entry.
-
-            \param from An origin node.
-            \param to   A destination entry.
-
-            \return A connection between the origin node and the destination entry.
-        */
-        [[nodiscard]] connection find_connection(const node& from, const entry_view& to) const;
-
-
-    private:
-        // virtual functions
-
-        virtual std::vector<entry_view> find_entries_impl(const input& key) const = 0;
-
-        virtual connection find_connection_impl(const node& from, const entry_view& to) const = 0;
-    };
-
-
-}
-
-
-#endif
+/*! \file
+    \brief A vocabulary.
+
+    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
+*/
+
+#if !defined(TETENGO_LATTICE_VOCABULARY_HPP)
+#define TETENGO_LATTICE_VOCABULARY_HPP
+
+#include <any>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include <boost/core/noncopyable.hpp>
+
+#include <tetengo/lattice/connection.hpp>
+#include <tetengo/lattice/cost_traits.hpp>
+#include <tetengo/lattice/entry.hpp>
+#include <tetengo/lattice/input.hpp>
+#include <tetengo/lattice/node.hpp>
+
+
+namespace tetengo::lattice
+{
+    /*!
+        \brief A basic vocabulary.
+
+        find_entries(), find_connection(), find_connections() and find_entry_connections() may be called concurrently
+        from multiple threads, as batch_analyzer does.
+        The entry views returned by find_entries() must be valid as long as the vocabulary lives.
+
+        \tparam Value A value type.
+        \tparam Cost  A cost type.
+    */
+    template <typename Value, typename Cost = int>
+    class basic_vocabulary : private boost::noncopyable
+    {
+    public:
+        // types
+
+        //! The value type.
+        using value_type = Value;
+
+        //! The cost type.
+        using cost_type = typename cost_traits<Cost>::cost_type;
+
+        //! The entry view type.
+        using entry_view_type = basic_entry_view<value_type, cost_type>;
+
+        //! The node type.
+        using node_type = basic_node<value_type, cost_type>;
+
+        //! The connection type.
+        using connection_type = basic_connection<cost_type>;
+
+
+        // constructors and destructor
+
+        /*!
+            \brief Creates a vocabulary.
+        */
+        basic_vocabulary() = default;
+
+        /*!
+            \brief Destroys the vocabulary.
+        */
+        virtual ~basic_vocabulary() = default;
+
+
+        // functions
+
+        /*!
+            \brief Finds entries.
+
+            \param key A key.
+
+            \return Entry views.
+        */
+        [[nodiscard]] std::vector<entry_view_type> find_entries(const input& key) const
+        {
+            return find_entries_impl(key);
+        }
+
+        /*!
+            \brief Finds entries whose key is a subrange of an input.
+
+            The lattice calls this function with a vector allocated in its memory resource.
+            A vocabulary which does not override this function creates the subrange and calls find_entries().
+
+            \param input_  An input.
+            \param offset  An offset of the key in the input.
+            \param length  A length of the key.
+            \param entries A vector to which the entry views are appended.
+
+            \throw std::out_of_range When offset and/or length are out of the range of the input.
+        */
+        void find_subrange_entries(
+            const input&                       input_,
+            const std::size_t                  offset,
+            const std::size_t                  length,
+            std::pmr::vector<entry_view_type>& entries) const
+        {
+            if (offset + length > input_.length())
+            {
+                throw std::out_of_range{ "offset and/or length are out of the range." };
+            }
+
+            find_subrange_entries_impl(input_, offset, length, entries);
+        }
+
+        /*!
+            \brief Finds a connection between an origin node and a destination entry.
+
+            \param from An origin node.
+            \param to   A destination entry.
+
+            \return A connection between the origin node and the destination entry.
+        */
+        [[nodiscard]] connection_type find_connection(const node_type& from, const entry_view_type& to) const
+        {
+            return find_connection_impl(from, to);
+        }
+
+        /*!
+            \brief Finds the connection costs between origin nodes and a destination entry.
+
+            The lattice calls this function once for each entry with all the nodes of the preceding step.
+
+            \param from  Origin nodes.
+            \param to    A destination entry.
+            \param costs The storage for the output costs. The i-th cost is the one from from[i].
+
+            \throw std::invalid_argument When the sizes of from and costs are different.
+        */
+        void find_connections(
+            const std::span<const node_type> from,
+            const entry_view_type&           to,
+            const std::span<cost_type>       costs) const
+        {
+            if (std::size(costs) != std::size(from))
+            {
+                throw std::invalid_argument{ "The sizes of from and costs are different." };
+            }
+
+            find_connections_impl(from, to, costs);
+        }
+
+        /*!
+            \brief Finds the connection costs between origin entries and a destination entry.
+
+            A vocabulary whose connections depend only on the entries of the origin nodes supports this function.
+            The lattice calls it with the entries of the preceding step, and calls find_connections() only when it
+            is not supported.
+
+            \param from  Origin entries.
+            \param to    A destination entry.
+            \param costs The storage for the output costs. The i-th cost is the one from from[i].
+
+            \retval true  When the costs are stored.
+            \retval false When this vocabulary does not support this function.
+
+            \throw std::invalid_argument When the sizes of from and costs are different.
+        */
+        [[nodiscard]] bool find_entry_connections(
+            const std::span<const entry_view_type> from,
+            const entry_view_type&                 to,
+            const std::span<cost_type>             costs) const
+        {
+            if (std::size(costs) != std::size(from))
+            {
+                throw std::invalid_argument{ "The sizes of from and costs are different." };
+            }
+
+            return find_entry_connections_impl(from, to, costs);
+        }
+
+
+    private:
+        // virtual functions
+
+        virtual std::vector<entry_view_type> find_entries_impl(const input& key) const = 0;
+
+        virtual void find_subrange_entries_impl(
+            const input&                       input_,
+            const std::size_t                  offset,
+            const std::size_t                  length,
+            std::pmr::vector<entry_view_type>& entries) const
+        {
+            const auto p_key = input_.create_subrange(offset, length);
+            const auto found = find_entries_impl(*p_key);
+            entries.insert(std::end(entries), std::begin(found), std::end(found));
+        }
+
+        virtual connection_type find_connection_impl(const node_type& from, const entry_view_type& to) const = 0;
+
+        virtual void find_connections_impl(
+            const std::span<const node_type> from,
+            const entry_view_type&           to,
+            const std::span<cost_type>       costs) const
+        {
+            for (auto i = static_cast<std::size_t>(0); i < std::size(from); ++i)
+            {
+                costs[i] = find_connection_impl(from[i], to).cost();
+            }
+        }
+
+        virtual bool find_entry_connections_impl(
+            const std::span<const entry_view_type> /*from*/,
+            const entry_view_type& /*to*/,
+            const std::span<cost_type> /*costs*/) const
+        {
+            return false;
+        }
+    };
+
+
+    extern template class basic_vocabulary<std::any>;
+
+
+    /*!
+        \brief A vocabulary.
+    */
+    using vocabulary = basic_vocabulary<std::any>;
+
+
+}
+
+
+#endif
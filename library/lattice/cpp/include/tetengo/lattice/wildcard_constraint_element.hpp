@@ -1,62 +1,108 @@
-/*! \file
-    \brief A wildcard constraint element.
-
-    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
-*/
-
-#if !defined(TETENGO_LATTICE_WILDCARDCONSTRAINTELEMENT_HPP)
-#define TETENGO_LATTICE_WILDCARDCONSTRAINTELEMENT_HPP
-
-#include <cstddef>
-#include <memory>
-
-#include <tetengo/lattice/constraint_element.hpp>
-
-
-namespace tetengo::lattice
-{
-    class node;
-
-
-    /*!
-        \brief A wildcard constraint element.
-    */
-    class wildcard_constraint_element : public constraint_element
-    {
-    public:
-        // constructors and destructor
-
-        /*!
-            \brief Creates a wildcard constraint element.
-
-            \param preceding_step An index of a preceding step.
-        */
-        explicit wildcard_constraint_element(std::size_t preceding_step);
-
-        /*!
-            \brief Destroys the wildcard constraint element.
-        */
-        virtual ~wildcard_constraint_element();
-
-
-    private:
-        // types
-
-        class impl;
-
-
-        // variables
-
-        std::unique_ptr<impl> m_p_impl;
-
-
-        // virtual functions
-
-        virtual int matches_impl(const node& node_) const override;
-    };
-
-
-}
-
-
-#endif
+/*! \file
+    \brief A wildcard constraint element.
+
+    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
+*/
+
+#if !defined(TETENGO_LATTICE_WILDCARDCONSTRAINTELEMENT_HPP)
+#define TETENGO_LATTICE_WILDCARDCONSTRAINTELEMENT_HPP
+
+#include <any>
+#include <cstddef>
+#include <limits>
+
+#include <tetengo/lattice/constraint_element.hpp>
+#include <tetengo/lattice/cost_traits.hpp>
+#include <tetengo/lattice/node.hpp>
+
+
+namespace tetengo::lattice
+{
+    /*!
+        \brief A basic wildcard constraint element.
+
+        \tparam Value A value type.
+        \tparam Cost  A cost type.
+    */
+    template <typename Value, typename Cost = int>
+    class basic_wildcard_constraint_element : public basic_constraint_element<Value, Cost>
+    {
+    public:
+        // types
+
+        //! The value type.
+        using value_type = Value;
+
+        //! The cost type.
+        using cost_type = typename cost_traits<Cost>::cost_type;
+
+        //! The node type.
+        using node_type = basic_node<value_type, cost_type>;
+
+
+        // constructors and destructor
+
+        /*!
+            \brief Creates a wildcard constraint element.
+
+            \param preceding_step An index of a preceding step.
+        */
+        explicit basic_wildcard_constraint_element(const std::size_t preceding_step) :
+        m_preceding_step{ preceding_step }
+        {}
+
+        /*!
+            \brief Destroys the wildcard constraint element.
+        */
+        virtual ~basic_wildcard_constraint_element() = default;
+
+
+    private:
+        // variables
+
+        const std::size_t m_preceding_step;
+
+
+        // virtual functions
+
+        virtual int matches_impl(const node_type& node_) const override
+        {
+            if (m_preceding_step == std::numeric_limits<std::size_t>::max())
+            {
+                if (node_.preceding_step() == std::numeric_limits<std::size_t>::max())
+                {
+                    return 0;
+                }
+                else
+                {
+                    return 1;
+                }
+            }
+            else
+            {
+                if (node_.preceding_step() < m_preceding_step)
+                {
+                    return -1;
+                }
+                else
+                {
+                    return static_cast<int>(node_.preceding_step() - m_preceding_step);
+                }
+            }
+        }
+    };
+
+
+    extern template class basic_wildcard_constraint_element<std::any>;
+
+
+    /*!
+        \brief A wildcard constraint element.
+    */
+    using wildcard_constraint_element = basic_wildcard_constraint_element<std::any>;
+
+
+}
+
+
+#endif
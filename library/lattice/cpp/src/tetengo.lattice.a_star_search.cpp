@@ -0,0 +1,17 @@
+/*! \file
+    \brief An A* N-best lattice path search.
+
+    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
+*/
+
+#include <any>
+
+#include <tetengo/lattice/a_star_search.hpp>
+
+
+namespace tetengo::lattice
+{
+    template class basic_a_star_search<std::any>;
+
+
+}
@@ -0,0 +1,304 @@
+/*! \file
+    \brief A batch analyzer.
+
+    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <boost/core/noncopyable.hpp>
+
+#include <tetengo/lattice/batch_analyzer.hpp>
+#include <tetengo/lattice/constraint.hpp>
+#include <tetengo/lattice/entry.hpp>
+#include <tetengo/lattice/input.hpp>
+#include <tetengo/lattice/lattice.hpp>
+#include <tetengo/lattice/n_best_iterator.hpp>
+#include <tetengo/lattice/node.hpp>
+#include <tetengo/lattice/path.hpp>
+#include <tetengo/lattice/vocabulary.hpp>
+
+
+namespace tetengo::lattice
+{
+    analyzed_path::analyzed_path(std::vector<entry_view> entries, const int cost) :
+    m_entries{ std::move(entries) },
+    m_cost{ cost }
+    {}
+
+    const std::vector<entry_view>& analyzed_path::entries() const
+    {
+        return m_entries;
+    }
+
+    int analyzed_path::cost() const
+    {
+        return m_cost;
+    }
+
+
+    class batch_analyzer::impl : private boost::noncopyable
+    {
+    public:
+        // constructors and destructor
+
+        impl(const vocabulary& vocabulary_, const std::size_t thread_count) :
+        m_lattices{ make_lattices(vocabulary_, thread_count) },
+        m_mutex{},
+        m_condition_variable{},
+        m_p_job{ nullptr },
+        m_job_generation{ 0 },
+        m_finished_worker_count{ 0 },
+        m_stopping{ false },
+        m_threads{}
+        {
+            // The caller's thread works as the worker 0, so the pool has one thread fewer than the lattices.
+            try
+            {
+                m_threads.reserve(std::size(m_lattices) - 1);
+                for (auto i = static_cast<std::size_t>(1); i < std::size(m_lattices); ++i)
+                {
+                    m_threads.emplace_back(&impl::worker_procedure, this, i);
+                }
+            }
+            catch (...)
+            {
+                stop_workers();
+                throw;
+            }
+        }
+
+        ~impl()
+        {
+            stop_workers();
+        }
+
+
+        // functions
+
+        std::size_t thread_count() const
+        {
+            return std::size(m_lattices);
+        }
+
+        std::vector<std::vector<analyzed_path>>
+        analyze(std::vector<std::vector<std::unique_ptr<input>>>&& inputs, const std::size_t n)
+        {
+            std::vector<std::vector<analyzed_path>> results(std::size(inputs));
+
+            // The workers take the next input one by one, so a worker with short inputs takes more of them.
+            std::atomic<std::size_t> next_index{ 0 };
+            std::mutex               exception_mutex{};
+            std::exception_ptr       p_exception{};
+
+            const std::function<void(std::size_t)> job = [this,
+                                                          &inputs,
+                                                          n,
+                                                          &results,
+                                                          &next_index,
+                                                          &exception_mutex,
+                                                          &p_exception](const std::size_t thread_index) {
+                auto& lattice_ = *m_lattices[thread_index];
+                for (auto index = next_index.fetch_add(1); index < std::size(inputs); index = next_index.fetch_add(1))
+                {
+                    try
+                    {
+                        results[index] = analyze_one(lattice_, std::move(inputs[index]), n);
+                    }
+                    catch (...)
+                    {
+                        const std::lock_guard<std::mutex> lock{ exception_mutex };
+                        if (!p_exception)
+                        {
+                            p_exception = std::current_exception();
+                        }
+                        next_index = std::size(inputs);
+                        break;
+                    }
+                }
+            };
+
+            run_job(job);
+
+            if (p_exception)
+            {
+                std::rethrow_exception(p_exception);
+            }
+            return results;
+        }
+
+
+    private:
+        // static functions
+
+        static std::vector<std::unique_ptr<lattice>>
+        make_lattices(const vocabulary& vocabulary_, const std::size_t thread_count)
+        {
+            auto thread_count_ = thread_count;
+            if (thread_count_ == 0)
+            {
+                thread_count_ = std::max(std::thread::hardware_concurrency(), 1U);
+            }
+
+            std::vector<std::unique_ptr<lattice>> lattices{};
+            lattices.reserve(thread_count_);
+            for (auto i = static_cast<std::size_t>(0); i < thread_count_; ++i)
+            {
+                lattices.push_back(std::make_unique<lattice>(vocabulary_, std::pmr::new_delete_resource()));
+            }
+            return lattices;
+        }
+
+        static std::vector<analyzed_path>
+        analyze_one(lattice& lattice_, std::vector<std::unique_ptr<input>>&& inputs, const std::size_t n)
+        {
+            lattice_.clear();
+            for (auto& p_input: inputs)
+            {
+                lattice_.push_back(std::move(p_input));
+            }
+            auto eos_node_and_preceding_edge_costs = lattice_.settle();
+
+            std::vector<analyzed_path> paths{};
+            n_best_iterator            iterator{ lattice_,
+                                      std::move(eos_node_and_preceding_edge_costs.first),
+                                      std::make_unique<constraint>() };
+            const n_best_iterator      last{};
+            for (; std::size(paths) < n && iterator != last; ++iterator)
+            {
+                paths.push_back(to_analyzed_path(*iterator));
+            }
+            return paths;
+        }
+
+        static analyzed_path to_analyzed_path(const path& path_)
+        {
+            std::vector<entry_view> entries{};
+            if (std::size(path_.nodes()) > 2)
+            {
+                entries.reserve(std::size(path_.nodes()) - 2);
+                std::transform(
+                    std::next(std::begin(path_.nodes())),
+                    std::prev(std::end(path_.nodes())),
+                    std::back_inserter(entries),
+                    [](const auto& node_) { return entry_view{ node_.p_key(), &node_.value(), node_.node_cost() }; });
+            }
+            return analyzed_path{ std::move(entries), path_.cost() };
+        }
+
+
+        // variables
+
+        const std::vector<std::unique_ptr<lattice>> m_lattices;
+
+        std::mutex m_mutex;
+
+        std::condition_variable m_condition_variable;
+
+        const std::function<void(std::size_t)>* m_p_job;
+
+        std::size_t m_job_generation;
+
+        std::size_t m_finished_worker_count;
+
+        bool m_stopping;
+
+        std::vector<std::thread> m_threads;
+
+
+        // functions
+
+        void run_job(const std::function<void(std::size_t)>& job)
+        {
+            {
+                const std::lock_guard<std::mutex> lock{ m_mutex };
+                m_p_job = &job;
+                m_finished_worker_count = 0;
+                ++m_job_generation;
+            }
+            m_condition_variable.notify_all();
+
+            job(0);
+
+            std::unique_lock<std::mutex> lock{ m_mutex };
+            m_condition_variable.wait(lock, [this]() { return m_finished_worker_count == std::size(m_threads); });
+            m_p_job = nullptr;
+        }
+
+        void worker_procedure(const std::size_t thread_index)
+        {
+            auto job_generation = static_cast<std::size_t>(0);
+            for (;;)
+            {
+                const std::function<void(std::size_t)>* p_job = nullptr;
+                {
+                    std::unique_lock<std::mutex> lock{ m_mutex };
+                    m_condition_variable.wait(
+                        lock, [this, job_generation]() { return m_stopping || m_job_generation != job_generation; });
+                    if (m_stopping)
+                    {
+                        return;
+                    }
+                    job_generation = m_job_generation;
+                    p_job = m_p_job;
+                }
+
+                (*p_job)(thread_index);
+
+                {
+                    const std::lock_guard<std::mutex> lock{ m_mutex };
+                    ++m_finished_worker_count;
+                }
+                m_condition_variable.notify_all();
+            }
+        }
+
+        void stop_workers()
+        {
+            {
+                const std::lock_guard<std::mutex> lock{ m_mutex };
+                m_stopping = true;
+            }
+            m_condition_variable.notify_all();
+            for (auto& thread_: m_threads)
+            {
+                if (thread_.joinable())
+                {
+                    thread_.join();
+                }
+            }
+        }
+    };
+
+
+    batch_analyzer::batch_analyzer(const vocabulary& vocabulary_, const std::size_t thread_count) :
+    m_p_impl{ std::make_unique<impl>(vocabulary_, thread_count) }
+    {}
+
+    batch_analyzer::~batch_analyzer() = default;
+
+    std::size_t batch_analyzer::thread_count() const
+    {
+        return m_p_impl->thread_count();
+    }
+
+    std::vector<std::vector<analyzed_path>>
+    batch_analyzer::analyze(std::vector<std::vector<std::unique_ptr<input>>>&& inputs, const std::size_t n)
+    {
+        return m_p_impl->analyze(std::move(inputs), n);
+    }
+
+
+}
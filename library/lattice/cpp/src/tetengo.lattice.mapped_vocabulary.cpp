@@ -0,0 +1,743 @@
+/*! \file
+    \brief A mapped vocabulary.
+
+    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
+*/
+
+#include <algorithm>
+#include <any>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <optional>
+#include <ostream>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <boost/core/noncopyable.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include <tetengo/lattice/connection.hpp>
+#include <tetengo/lattice/entry.hpp>
+#include <tetengo/lattice/input.hpp>
+#include <tetengo/lattice/mapped_vocabulary.hpp>
+#include <tetengo/lattice/node.hpp>
+#include <tetengo/lattice/string_input.hpp>
+#include <tetengo/lattice/string_view_input.hpp>
+
+
+namespace tetengo::lattice
+{
+    namespace
+    {
+        /*
+            The layout of a compiled vocabulary:
+
+            header             magic (8 bytes), key count, key bucket count, entry count, connection bucket count,
+                               and the offsets of the following sections (8 bytes each)
+            key buckets        key index + 1, or 0 for a vacant bucket
+            key table          key offset in the blob (8 bytes), key length, first entry index, entry count, reserved
+            entry table        value offset in the blob (8 bytes), value length, cost, connection id, reserved
+            connection buckets origin connection id, destination connection id, cost
+            blob               keys and serialized values
+
+            The numbers are 4 bytes unless otherwise noted.
+            The connection ID of BOS/EOS is 0. The entries equal to each other share a connection ID.
+        */
+
+        constexpr std::string_view magic{ "TLVOCAB1" };
+
+        constexpr std::size_t header_size = 56;
+
+        constexpr std::size_t key_bucket_size = 4;
+
+        constexpr std::size_t key_record_size = 24;
+
+        constexpr std::size_t entry_record_size = 24;
+
+        constexpr std::size_t connection_bucket_size = 12;
+
+        constexpr std::uint32_t vacant_connection_id = std::numeric_limits<std::uint32_t>::max();
+
+        constexpr std::size_t key_state_shard_count = 16;
+
+        std::uint64_t hash_key(const std::string_view& key)
+        {
+            // FNV-1a, which gives the same values across processes and builds.
+            auto value = static_cast<std::uint64_t>(0xCBF29CE484222325ULL);
+            for (const auto c: key)
+            {
+                value ^= static_cast<std::uint64_t>(static_cast<unsigned char>(c));
+                value *= 0x00000100000001B3ULL;
+            }
+            return value;
+        }
+
+        std::uint64_t hash_connection(const std::uint32_t from_id, const std::uint32_t to_id)
+        {
+            auto value = (static_cast<std::uint64_t>(from_id) << 32) | static_cast<std::uint64_t>(to_id);
+            value ^= value >> 33;
+            value *= 0xFF51AFD7ED558CCDULL;
+            value ^= value >> 33;
+            value *= 0xC4CEB9FE1A85EC53ULL;
+            value ^= value >> 33;
+            return value;
+        }
+
+        std::size_t bucket_count_for(const std::size_t size)
+        {
+            auto count = static_cast<std::size_t>(1);
+            while (count < size * 2)
+            {
+                count *= 2;
+            }
+            return count;
+        }
+
+        template <typename T>
+        void write_number(std::string& buffer, const std::size_t offset, const T value)
+        {
+            std::memcpy(std::data(buffer) + offset, &value, sizeof(T));
+        }
+
+        template <typename T>
+        T read_number(const char* const p)
+        {
+            T value{};
+            std::memcpy(&value, p, sizeof(T));
+            return value;
+        }
+
+        std::uint32_t to_uint32(const std::size_t value)
+        {
+            if (value >= std::numeric_limits<std::uint32_t>::max())
+            {
+                throw std::length_error{ "The vocabulary is too large." };
+            }
+            return static_cast<std::uint32_t>(value);
+        }
+
+        std::optional<std::string_view> key_value_of(const input& key)
+        {
+            if (key.is<string_view_input>())
+            {
+                return key.as<string_view_input>().value();
+            }
+            if (key.is<string_input>())
+            {
+                return std::string_view{ key.as<string_input>().value() };
+            }
+            return std::nullopt;
+        }
+
+        entry_view origin_entry_of(const node& from)
+        {
+            return entry_view{ from.p_key(), &from.value(), from.node_cost() };
+        }
+
+        const entry_view& origin_entry_of(const entry_view& from)
+        {
+            return from;
+        }
+
+
+    }
+
+
+    class mapped_vocabulary::impl : private boost::noncopyable
+    {
+    public:
+        // static functions
+
+        static void write(
+            std::ostream&                                                    output_stream,
+            const std::vector<std::pair<std::string, std::vector<entry>>>&   entries,
+            const std::vector<std::pair<std::pair<entry, entry>, int>>&      connections,
+            const std::function<std::size_t(const entry_view&)>&             entry_hash,
+            const std::function<bool(const entry_view&, const entry_view&)>& entry_equal_to,
+            const std::function<std::string(const std::any&)>&               value_serializer)
+        {
+            std::vector<const std::pair<std::string, std::vector<entry>>*> keys{};
+            {
+                keys.reserve(std::size(entries));
+                std::unordered_set<std::string_view> key_set{};
+                for (const auto& e: entries)
+                {
+                    if (key_set.insert(e.first).second)
+                    {
+                        keys.push_back(&e);
+                    }
+                }
+            }
+            auto entry_count = static_cast<std::size_t>(0);
+            for (const auto* const p_key: keys)
+            {
+                entry_count += std::size(p_key->second);
+            }
+
+            std::unordered_map<
+                entry_view,
+                std::uint32_t,
+                std::function<std::size_t(const entry_view&)>,
+                std::function<bool(const entry_view&, const entry_view&)>>
+                connection_ids{ entry_count + 1, entry_hash, entry_equal_to };
+            connection_ids.insert(std::make_pair(entry_view{ entry::bos_eos() }, 0));
+
+            const auto key_count = std::size(keys);
+            const auto key_bucket_count = bucket_count_for(key_count);
+            const auto connection_bucket_count = bucket_count_for(std::size(connections));
+            const auto key_bucket_offset = header_size;
+            const auto key_table_offset = key_bucket_offset + key_bucket_size * key_bucket_count;
+            const auto entry_table_offset = key_table_offset + key_record_size * key_count;
+            const auto connection_table_offset = entry_table_offset + entry_record_size * entry_count;
+            const auto blob_offset = connection_table_offset + connection_bucket_size * connection_bucket_count;
+
+            std::string content(blob_offset, '\0');
+            std::copy(std::begin(magic), std::end(magic), std::begin(content));
+            write_number(content, 8, to_uint32(key_count));
+            write_number(content, 12, to_uint32(key_bucket_count));
+            write_number(content, 16, to_uint32(entry_count));
+            write_number(content, 20, to_uint32(connection_bucket_count));
+            write_number(content, 24, static_cast<std::uint64_t>(key_bucket_offset));
+            write_number(content, 32, static_cast<std::uint64_t>(key_table_offset));
+            write_number(content, 40, static_cast<std::uint64_t>(entry_table_offset));
+            write_number(content, 48, static_cast<std::uint64_t>(connection_table_offset));
+
+            auto entry_index = static_cast<std::size_t>(0);
+            for (auto i = static_cast<std::size_t>(0); i < key_count; ++i)
+            {
+                const auto& key = keys[i]->first;
+                for (auto bucket = hash_key(key) & (key_bucket_count - 1);;
+                     bucket = (bucket + 1) & (key_bucket_count - 1))
+                {
+                    const auto bucket_offset = key_bucket_offset + key_bucket_size * bucket;
+                    if (read_number<std::uint32_t>(std::data(content) + bucket_offset) == 0)
+                    {
+                        write_number(content, bucket_offset, to_uint32(i + 1));
+                        break;
+                    }
+                }
+
+                const auto key_record_offset = key_table_offset + key_record_size * i;
+                write_number(content, key_record_offset, static_cast<std::uint64_t>(std::size(content) - blob_offset));
+                write_number(content, key_record_offset + 8, to_uint32(std::size(key)));
+                write_number(content, key_record_offset + 12, to_uint32(entry_index));
+                write_number(content, key_record_offset + 16, to_uint32(std::size(keys[i]->second)));
+                content.append(key);
+
+                for (const auto& entry_: keys[i]->second)
+                {
+                    const auto value = value_serializer(entry_.value());
+                    const auto connection_id =
+                        connection_ids
+                            .insert(std::make_pair(entry_view{ entry_ }, to_uint32(std::size(connection_ids))))
+                            .first->second;
+
+                    const auto entry_record_offset = entry_table_offset + entry_record_size * entry_index;
+                    write_number(
+                        content, entry_record_offset, static_cast<std::uint64_t>(std::size(content) - blob_offset));
+                    write_number(content, entry_record_offset + 8, to_uint32(std::size(value)));
+                    write_number(content, entry_record_offset + 12, static_cast<std::int32_t>(entry_.cost()));
+                    write_number(content, entry_record_offset + 16, connection_id);
+                    content.append(value);
+                    ++entry_index;
+                }
+            }
+
+            for (auto i = static_cast<std::size_t>(0); i < connection_bucket_count; ++i)
+            {
+                write_number(content, connection_table_offset + connection_bucket_size * i, vacant_connection_id);
+            }
+            for (const auto& connection_: connections)
+            {
+                const auto found_from = connection_ids.find(entry_view{ connection_.first.first });
+                const auto found_to = connection_ids.find(entry_view{ connection_.first.second });
+                if (found_from == std::end(connection_ids) || found_to == std::end(connection_ids))
+                {
+                    continue;
+                }
+
+                for (auto bucket = hash_connection(found_from->second, found_to->second) &
+                                   (connection_bucket_count - 1);;
+                     bucket = (bucket + 1) & (connection_bucket_count - 1))
+                {
+                    const auto bucket_offset = connection_table_offset + connection_bucket_size * bucket;
+                    const auto from_id = read_number<std::uint32_t>(std::data(content) + bucket_offset);
+                    const auto to_id = read_number<std::uint32_t>(std::data(content) + bucket_offset + 4);
+                    if (from_id == found_from->second && to_id == found_to->second)
+                    {
+                        break;
+                    }
+                    if (from_id == vacant_connection_id)
+                    {
+                        write_number(content, bucket_offset, found_from->second);
+                        write_number(content, bucket_offset + 4, found_to->second);
+                        write_number(content, bucket_offset + 8, static_cast<std::int32_t>(connection_.second));
+                        break;
+                    }
+                }
+            }
+
+            output_stream.write(std::data(content), std::size(content));
+        }
+
+
+        // constructors and destructor
+
+        impl(
+            const boost::interprocess::file_mapping& file_mapping_,
+            const std::size_t                        content_offset,
+            const std::size_t                        file_size) :
+        m_region{ map_region(file_mapping_, content_offset, file_size) },
+        m_p_content{ static_cast<const char*>(m_region.get_address()) },
+        m_key_count{ read_number<std::uint32_t>(m_p_content + 8) },
+        m_key_bucket_count{ read_number<std::uint32_t>(m_p_content + 12) },
+        m_entry_count{ read_number<std::uint32_t>(m_p_content + 16) },
+        m_connection_bucket_count{ read_number<std::uint32_t>(m_p_content + 20) },
+        m_p_key_buckets{ m_p_content + read_number<std::uint64_t>(m_p_content + 24) },
+        m_p_key_table{ m_p_content + read_number<std::uint64_t>(m_p_content + 32) },
+        m_p_entry_table{ m_p_content + read_number<std::uint64_t>(m_p_content + 40) },
+        m_p_connection_table{ m_p_content + read_number<std::uint64_t>(m_p_content + 48) },
+        m_p_blob{ m_p_connection_table + connection_bucket_size * m_connection_bucket_count },
+        m_blob_size{ static_cast<std::size_t>(m_p_content + m_region.get_size() - m_p_blob) },
+        m_p_values{ std::allocator<std::any>{}.allocate(m_entry_count) },
+        m_key_state_shards{}
+        {}
+
+        ~impl()
+        {
+            for (const auto& shard: m_key_state_shards)
+            {
+                for (const auto& state: shard.states)
+                {
+                    std::destroy_n(m_p_values + state.second.first_entry, state.second.entry_count);
+                }
+            }
+            std::allocator<std::any>{}.deallocate(m_p_values, m_entry_count);
+        }
+
+
+        // functions
+
+        std::vector<entry_view> find_entries_impl(const input& key) const
+        {
+            const auto key_value = key_value_of(key);
+            if (!key_value)
+            {
+                throw std::invalid_argument{ "The key must be string_input or string_view_input." };
+            }
+            const auto key_index = find_key(*key_value);
+            if (!key_index)
+            {
+                return std::vector<entry_view>{};
+            }
+            const auto& state = key_state_of(*key_index);
+
+            std::vector<entry_view> entries{};
+            entries.reserve(state.entry_count);
+            for (auto i = state.first_entry; i < state.first_entry + state.entry_count; ++i)
+            {
+                entries.emplace_back(
+                    std::to_address(state.p_key),
+                    m_p_values + i,
+                    read_number<std::int32_t>(m_p_entry_table + entry_record_size * i + 12));
+            }
+            return entries;
+        }
+
+        void find_subrange_entries_impl(
+            const input&                  input_,
+            const std::size_t             offset,
+            const std::size_t             length,
+            std::pmr::vector<entry_view>& entries) const
+        {
+            const auto input_value = key_value_of(input_);
+            if (!input_value)
+            {
+                throw std::invalid_argument{ "The key must be string_input or string_view_input." };
+            }
+            const auto key_index = find_key(input_value->substr(offset, length));
+            if (!key_index)
+            {
+                return;
+            }
+            const auto& state = key_state_of(*key_index);
+
+            for (auto i = state.first_entry; i < state.first_entry + state.entry_count; ++i)
+            {
+                entries.emplace_back(
+                    std::to_address(state.p_key),
+                    m_p_values + i,
+                    read_number<std::int32_t>(m_p_entry_table + entry_record_size * i + 12));
+            }
+        }
+
+        connection find_connection_impl(const node& from, const entry_view& to) const
+        {
+            const auto from_id = find_connection_id(origin_entry_of(from));
+            const auto to_id = find_connection_id(to);
+            if (!from_id || !to_id)
+            {
+                return connection{ std::numeric_limits<int>::max() };
+            }
+
+            return connection{ find_connection_cost(*from_id, *to_id) };
+        }
+
+        template <typename From>
+        void find_connections_impl(
+            const std::span<const From> from,
+            const entry_view&           to,
+            const std::span<int>        costs) const
+        {
+            const auto to_id = find_connection_id(to);
+            if (!to_id)
+            {
+                std::fill(std::begin(costs), std::end(costs), std::numeric_limits<int>::max());
+                return;
+            }
+
+            for (auto i = static_cast<std::size_t>(0); i < std::size(from); ++i)
+            {
+                const auto from_id = find_connection_id(origin_entry_of(from[i]));
+                costs[i] = from_id ? find_connection_cost(*from_id, *to_id) : std::numeric_limits<int>::max();
+            }
+        }
+
+    private:
+        // types
+
+        struct key_record_type
+        {
+            std::string_view key;
+
+            std::size_t first_entry;
+
+            std::size_t entry_count;
+        };
+
+        struct key_state_type
+        {
+            std::unique_ptr<input> p_key;
+
+            std::size_t first_entry;
+
+            std::size_t entry_count;
+        };
+
+        struct key_state_shard_type
+        {
+            std::mutex mutex;
+
+            std::unordered_map<std::size_t, key_state_type> states;
+        };
+
+
+        // static functions
+
+        static boost::interprocess::mapped_region map_region(
+            const boost::interprocess::file_mapping& file_mapping_,
+            const std::size_t                        content_offset,
+            const std::size_t                        file_size)
+        {
+            if (content_offset > file_size)
+            {
+                throw std::invalid_argument{ "content_offset is greater than file_size." };
+            }
+            if (file_size - content_offset < header_size)
+            {
+                throw std::invalid_argument{ "The content is not a compiled vocabulary." };
+            }
+
+            boost::interprocess::mapped_region region{ file_mapping_,
+                                                       boost::interprocess::read_only,
+                                                       static_cast<boost::interprocess::offset_t>(content_offset),
+                                                       file_size - content_offset };
+            const auto* const p_content = static_cast<const char*>(region.get_address());
+            const auto        key_count = read_number<std::uint32_t>(p_content + 8);
+            const auto        key_bucket_count = read_number<std::uint32_t>(p_content + 12);
+            const auto        entry_count = read_number<std::uint32_t>(p_content + 16);
+            const auto        connection_bucket_count = read_number<std::uint32_t>(p_content + 20);
+            const auto        key_bucket_offset = static_cast<std::uint64_t>(header_size);
+            const auto        key_table_offset = key_bucket_offset + key_bucket_size * key_bucket_count;
+            const auto        entry_table_offset = key_table_offset + key_record_size * key_count;
+            const auto        connection_table_offset = entry_table_offset + entry_record_size * entry_count;
+            const auto        blob_offset = connection_table_offset + connection_bucket_size * connection_bucket_count;
+            const auto        is_power_of_two = [](const std::uint32_t value) {
+                return value > 0 && (value & (value - 1)) == 0;
+            };
+            if (std::string_view{ p_content, std::size(magic) } != magic || !is_power_of_two(key_bucket_count) ||
+                !is_power_of_two(connection_bucket_count) ||
+                read_number<std::uint64_t>(p_content + 24) != key_bucket_offset ||
+                read_number<std::uint64_t>(p_content + 32) != key_table_offset ||
+                read_number<std::uint64_t>(p_content + 40) != entry_table_offset ||
+                read_number<std::uint64_t>(p_content + 48) != connection_table_offset ||
+                blob_offset > region.get_size())
+            {
+                throw std::invalid_argument{ "The content is not a compiled vocabulary." };
+            }
+            return region;
+        }
+
+
+        // variables
+
+        const boost::interprocess::mapped_region m_region;
+
+        const char* const m_p_content;
+
+        const std::size_t m_key_count;
+
+        const std::size_t m_key_bucket_count;
+
+        const std::size_t m_entry_count;
+
+        const std::size_t m_connection_bucket_count;
+
+        const char* const m_p_key_buckets;
+
+        const char* const m_p_key_table;
+
+        const char* const m_p_entry_table;
+
+        const char* const m_p_connection_table;
+
+        const char* const m_p_blob;
+
+        const std::size_t m_blob_size;
+
+        std::any* const m_p_values;
+
+        mutable std::array<key_state_shard_type, key_state_shard_count> m_key_state_shards;
+
+
+        // functions
+
+        std::optional<std::size_t> find_key(const std::string_view& key) const
+        {
+            auto bucket = hash_key(key) & (m_key_bucket_count - 1);
+            for (auto i = static_cast<std::size_t>(0); i < m_key_bucket_count; ++i)
+            {
+                const auto key_index_plus_one = read_number<std::uint32_t>(m_p_key_buckets + key_bucket_size * bucket);
+                if (key_index_plus_one == 0)
+                {
+                    return std::nullopt;
+                }
+                if (key_index_plus_one > m_key_count)
+                {
+                    throw std::runtime_error{ "The key bucket is broken." };
+                }
+                if (key_record_at(key_index_plus_one - 1).key == key)
+                {
+                    return key_index_plus_one - 1;
+                }
+                bucket = (bucket + 1) & (m_key_bucket_count - 1);
+            }
+            return std::nullopt;
+        }
+
+        key_record_type key_record_at(const std::size_t key_index) const
+        {
+            const auto* const p_key_record = m_p_key_table + key_record_size * key_index;
+            const auto        key_offset = read_number<std::uint64_t>(p_key_record);
+            const auto        key_length = static_cast<std::uint64_t>(read_number<std::uint32_t>(p_key_record + 8));
+            const auto first_entry = static_cast<std::uint64_t>(read_number<std::uint32_t>(p_key_record + 12));
+            const auto entry_count = static_cast<std::uint64_t>(read_number<std::uint32_t>(p_key_record + 16));
+            if (key_offset > m_blob_size || key_length > m_blob_size - key_offset ||
+                first_entry + entry_count > m_entry_count)
+            {
+                throw std::runtime_error{ "The key record is broken." };
+            }
+            return key_record_type{ std::string_view{ m_p_blob + key_offset, static_cast<std::size_t>(key_length) },
+                                    static_cast<std::size_t>(first_entry),
+                                    static_cast<std::size_t>(entry_count) };
+        }
+
+        std::string_view value_at(const std::size_t entry_index) const
+        {
+            const auto* const p_entry_record = m_p_entry_table + entry_record_size * entry_index;
+            const auto        value_offset = read_number<std::uint64_t>(p_entry_record);
+            const auto value_length = static_cast<std::uint64_t>(read_number<std::uint32_t>(p_entry_record + 8));
+            if (value_offset > m_blob_size || value_length > m_blob_size - value_offset)
+            {
+                throw std::runtime_error{ "The entry record is broken." };
+            }
+            return std::string_view{ m_p_blob + value_offset, static_cast<std::size_t>(value_length) };
+        }
+
+        key_state_shard_type& key_state_shard_of(const std::size_t key_index) const
+        {
+            return m_key_state_shards[key_index % key_state_shard_count];
+        }
+
+        const key_state_type& key_state_of(const std::size_t key_index) const
+        {
+            // The key inputs and the values are created on the first lookup of each key, so that the construction
+            // does not depend on the vocabulary size. The elements of an unordered_map are not moved by a rehash.
+            // The values are placed in the storage indexed by the entry indices.
+            auto&                             shard = key_state_shard_of(key_index);
+            const std::lock_guard<std::mutex> lock{ shard.mutex };
+            const auto                        found = shard.states.find(key_index);
+            if (found != std::end(shard.states))
+            {
+                return found->second;
+            }
+
+            const auto                    record = key_record_at(key_index);
+            std::vector<std::string_view> values{};
+            values.reserve(record.entry_count);
+            for (auto i = record.first_entry; i < record.first_entry + record.entry_count; ++i)
+            {
+                values.push_back(value_at(i));
+            }
+            auto p_key = std::make_unique<string_input>(std::string{ record.key });
+            for (auto i = static_cast<std::size_t>(0); i < record.entry_count; ++i)
+            {
+                std::construct_at(m_p_values + record.first_entry + i, values[i]);
+            }
+            return shard.states
+                .emplace(key_index, key_state_type{ std::move(p_key), record.first_entry, record.entry_count })
+                .first->second;
+        }
+
+        std::optional<std::uint32_t> find_connection_id(const entry_view& entry) const
+        {
+            if (!entry.p_key())
+            {
+                return 0;
+            }
+
+            // A value found in this vocabulary is at the position of its entry index in the storage. So its connection
+            // ID is resolved without searching the key nor taking a lock.
+            const std::less<const std::any*> less{};
+            if (!less(entry.value(), m_p_values) && less(entry.value(), m_p_values + m_entry_count))
+            {
+                return connection_id_at(static_cast<std::size_t>(entry.value() - m_p_values));
+            }
+
+            const auto key_value = key_value_of(*entry.p_key());
+            if (!key_value)
+            {
+                return std::nullopt;
+            }
+            const auto key_index = find_key(*key_value);
+            if (!key_index)
+            {
+                return std::nullopt;
+            }
+            const auto* const p_value = std::any_cast<std::string_view>(entry.value());
+            if (!p_value)
+            {
+                return std::nullopt;
+            }
+            const auto record = key_record_at(*key_index);
+            for (auto i = record.first_entry; i < record.first_entry + record.entry_count; ++i)
+            {
+                if (value_at(i) == *p_value &&
+                    read_number<std::int32_t>(m_p_entry_table + entry_record_size * i + 12) == entry.cost())
+                {
+                    return connection_id_at(i);
+                }
+            }
+            return std::nullopt;
+        }
+
+        std::uint32_t connection_id_at(const std::size_t entry_index) const
+        {
+            return read_number<std::uint32_t>(m_p_entry_table + entry_record_size * entry_index + 16);
+        }
+
+        int find_connection_cost(const std::uint32_t from_id, const std::uint32_t to_id) const
+        {
+            auto bucket = hash_connection(from_id, to_id) & (m_connection_bucket_count - 1);
+            for (auto i = static_cast<std::size_t>(0); i < m_connection_bucket_count; ++i)
+            {
+                const auto* const p_bucket = m_p_connection_table + connection_bucket_size * bucket;
+                const auto        bucket_from_id = read_number<std::uint32_t>(p_bucket);
+                if (bucket_from_id == vacant_connection_id)
+                {
+                    break;
+                }
+                if (bucket_from_id == from_id && read_number<std::uint32_t>(p_bucket + 4) == to_id)
+                {
+                    return read_number<std::int32_t>(p_bucket + 8);
+                }
+                bucket = (bucket + 1) & (m_connection_bucket_count - 1);
+            }
+            return std::numeric_limits<int>::max();
+        }
+    };
+
+
+    void mapped_vocabulary::write(
+        std::ostream&                                                    output_stream,
+        const std::vector<std::pair<std::string, std::vector<entry>>>&   entries,
+        const std::vector<std::pair<std::pair<entry, entry>, int>>&      connections,
+        const std::function<std::size_t(const entry_view&)>&             entry_hash,
+        const std::function<bool(const entry_view&, const entry_view&)>& entry_equal_to,
+        const std::function<std::string(const std::any&)>&               value_serializer)
+    {
+        impl::write(output_stream, entries, connections, entry_hash, entry_equal_to, value_serializer);
+    }
+
+    mapped_vocabulary::mapped_vocabulary(
+        const boost::interprocess::file_mapping& file_mapping_,
+        const std::size_t                        content_offset,
+        const std::size_t                        file_size) :
+    m_p_impl{ std::make_unique<impl>(file_mapping_, content_offset, file_size) }
+    {}
+
+    mapped_vocabulary::~mapped_vocabulary() = default;
+
+    std::vector<entry_view> mapped_vocabulary::find_entries_impl(const input& key) const
+    {
+        return m_p_impl->find_entries_impl(key);
+    }
+
+    void mapped_vocabulary::find_subrange_entries_impl(
+        const input&                  input_,
+        const std::size_t             offset,
+        const std::size_t             length,
+        std::pmr::vector<entry_view>& entries) const
+    {
+        m_p_impl->find_subrange_entries_impl(input_, offset, length, entries);
+    }
+
+    connection mapped_vocabulary::find_connection_impl(const node& from, const entry_view& to) const
+    {
+        return m_p_impl->find_connection_impl(from, to);
+    }
+
+    void mapped_vocabulary::find_connections_impl(
+        const std::span<const node> from,
+        const entry_view&           to,
+        const std::span<int>        costs) const
+    {
+        m_p_impl->find_connections_impl(from, to, costs);
+    }
+
+    bool mapped_vocabulary::find_entry_connections_impl(
+        const std::span<const entry_view> from,
+        const entry_view&                 to,
+        const std::span<int>              costs) const
+    {
+        m_p_impl->find_connections_impl(from, to, costs);
+        return true;
+    }
+
+
+}
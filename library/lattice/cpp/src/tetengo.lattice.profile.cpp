@@ -0,0 +1,22 @@
+/*! \file
+    \brief A profile.
+
+    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
+*/
+
+#include <tetengo/lattice/profile.hpp>
+
+
+namespace tetengo::lattice
+{
+    bool profile_enabled()
+    {
+#if defined(TETENGO_LATTICE_PROFILE)
+        return true;
+#else
+        return false;
+#endif
+    }
+
+
+}
@@ -0,0 +1,125 @@
+/*! \file
+    \brief A string view input.
+
+    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
+*/
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include <boost/container_hash/hash.hpp>
+
+#include <tetengo/lattice/input.hpp>
+#include <tetengo/lattice/string_view_input.hpp>
+
+
+namespace tetengo::lattice
+{
+    string_view_input::string_view_input(std::string value) :
+    m_p_buffer{ std::make_shared<std::string>(std::move(value)) },
+    m_offset{ 0 },
+    m_length{ std::size(*m_p_buffer) }
+    {}
+
+    string_view_input::string_view_input(
+        std::shared_ptr<std::string> p_buffer,
+        const std::size_t            offset,
+        const std::size_t            length) :
+    m_p_buffer{ std::move(p_buffer) },
+    m_offset{ offset },
+    m_length{ length }
+    {
+        if (!m_p_buffer)
+        {
+            throw std::invalid_argument{ "p_buffer is nullptr." };
+        }
+        if (m_offset + m_length > std::size(*m_p_buffer))
+        {
+            throw std::out_of_range{ "offset and/or length are out of the range." };
+        }
+    }
+
+    string_view_input::~string_view_input() = default;
+
+    std::string_view string_view_input::value() const
+    {
+        return std::string_view{ *m_p_buffer }.substr(m_offset, m_length);
+    }
+
+    bool string_view_input::equal_to_impl(const input& another) const
+    {
+        return another.as<string_view_input>().value() == value();
+    }
+
+    std::size_t string_view_input::hash_value_impl() const
+    {
+        const auto value_ = value();
+        return boost::hash_range(std::begin(value_), std::end(value_));
+    }
+
+    std::size_t string_view_input::length_impl() const
+    {
+        return m_length;
+    }
+
+    std::unique_ptr<input> string_view_input::clone_impl() const
+    {
+        return std::make_unique<string_view_input>(m_p_buffer, m_offset, m_length);
+    }
+
+    std::unique_ptr<input>
+    string_view_input::create_subrange_impl(const std::size_t offset, const std::size_t length) const
+    {
+        if (offset + length > m_length)
+        {
+            throw std::out_of_range{ "offset and/or length are out of the range." };
+        }
+
+        return std::make_unique<string_view_input>(m_p_buffer, m_offset + offset, length);
+    }
+
+    void string_view_input::append_impl(std::unique_ptr<input>&& p_another)
+    {
+        if (!p_another)
+        {
+            throw std::invalid_argument{ "p_another is nullptr." };
+        }
+        if (!p_another->is<string_view_input>())
+        {
+            throw std::invalid_argument{ "Mismatch type of p_another." };
+        }
+
+        const auto& another = p_another->as<string_view_input>();
+        if (another.m_p_buffer == m_p_buffer)
+        {
+            const std::string another_value{ another.value() };
+            append_to_buffer(another_value);
+        }
+        else
+        {
+            append_to_buffer(another.value());
+        }
+    }
+
+    void string_view_input::append_to_buffer(const std::string_view& another_value)
+    {
+        // The other inputs sharing the buffer only refer to their ranges, so the buffer can be extended in place when
+        // this range reaches its end.
+        // The range is moved to a new buffer when the part before it gets longer than itself, so that a range sliding
+        // over a stream does not keep all the stream in the buffer.
+        if (m_offset + m_length != std::size(*m_p_buffer) || m_offset > m_length)
+        {
+            m_p_buffer = std::make_shared<std::string>(value());
+            m_offset = 0;
+        }
+        m_p_buffer->append(another_value);
+        m_length += std::size(another_value);
+    }
+
+
+}
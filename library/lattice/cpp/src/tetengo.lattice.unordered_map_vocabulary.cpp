@@ -1,202 +1,461 @@
-/*! \file
-    \brief An unordered map vocabulary.
-
-    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
-*/
-
-#include <algorithm>
-#include <cstddef>
-#include <functional>
-#include <iterator>
-#include <limits>
-#include <memory>
-#include <string>
-#include <type_traits>
-#include <unordered_map>
-#include <utility>
-#include <vector>
-
-#include <boost/core/noncopyable.hpp>
-
-#include <tetengo/lattice/connection.hpp>
-#include <tetengo/lattice/entry.hpp>
-#include <tetengo/lattice/input.hpp>
-#include <tetengo/lattice/node.hpp>
-#include <tetengo/lattice/string_input.hpp>
-#include <tetengo/lattice/unordered_map_vocabulary.hpp>
-
-
-namespace tetengo::lattice
-{
-    class unordered_map_vocabulary::impl : private boost::noncopyable
-    {
-    public:
-        // constructors and destructor
-
-        impl(
-            std::vector<std::pair<std::string, std::vector<entry>>>   entries,
-            std::vector<std::pair<std::pair<entry, entry>, int>>      connections,
-            std::function<std::size_t(const entry_view&)>             entry_hash,
-            std::function<bool(const entry_view&, const entry_view&)> entry_equal_to) :
-        m_entry_map{ make_entry_map(std::move(entries)) },
-        m_connection_keys{},
-        m_p_connection_map{}
-        {
-            build_connection_map(
-                std::move(connections),
-                std::move(entry_hash),
-                std::move(entry_equal_to),
-                m_connection_keys,
-                m_p_connection_map);
-        }
-
-
-        // functions
-
-        std::vector<entry_view> find_entries_impl(const input& key) const
-        {
-            const auto found = m_entry_map.find(std::string{ key.as<string_input>().value() });
-            if (found == std::end(m_entry_map))
-            {
-                return std::vector<entry_view>{};
-            }
-
-            std::vector<entry_view> entries{};
-            entries.reserve(std::size(found->second));
-            std::copy(std::begin(found->second), std::end(found->second), std::back_inserter(entries));
-            return entries;
-        }
-
-        connection find_connection_impl(const node& from, const entry_view& to) const
-        {
-            const entry_view from_entry_view{ from.p_key(), &from.value(), from.node_cost() };
-            const auto       found = m_p_connection_map->find(std::make_pair(from_entry_view, to));
-            if (found == std::end(*m_p_connection_map))
-            {
-                return connection{ std::numeric_limits<int>::max() };
-            }
-            return connection{ found->second };
-        }
-
-
-    private:
-        // types
-
-        using entry_map_type = std::unordered_map<std::string, std::vector<entry>>;
-
-        struct connection_map_hash
-        {
-            std::function<std::size_t(const entry_view&)> hash;
-
-            explicit connection_map_hash(std::function<std::size_t(const entry_view&)> hash) : hash{ std::move(hash) }
-            {}
-
-            std::size_t operator()(const std::pair<entry_view, entry_view>& key) const
-            {
-                return hash(key.first) ^ hash(key.second);
-            }
-        };
-
-        struct connection_map_key_eq
-        {
-            std::function<bool(const entry_view&, const entry_view&)> key_eq;
-
-            explicit connection_map_key_eq(std::function<bool(const entry_view&, const entry_view&)> key_eq) :
-            key_eq{ std::move(key_eq) }
-            {}
-
-            bool operator()(
-                const std::pair<entry_view, entry_view>& one,
-                const std::pair<entry_view, entry_view>& another) const
-            {
-                return key_eq(one.first, another.first) && key_eq(one.second, another.second);
-            }
-        };
-
-        using connection_map_type =
-            std::unordered_map<std::pair<entry_view, entry_view>, int, connection_map_hash, connection_map_key_eq>;
-
-
-        // static functions
-
-        static entry_map_type make_entry_map(std::vector<std::pair<std::string, std::vector<entry>>> entries)
-        {
-            entry_map_type map{};
-            map.reserve(std::size(entries));
-            for (auto&& e: entries)
-            {
-                map.insert(std::make_pair(std::move(e.first), std::move(e.second)));
-            }
-            return map;
-        }
-
-        static void build_connection_map(
-            std::vector<std::pair<std::pair<entry, entry>, int>>      connections,
-            std::function<std::size_t(const entry_view&)>             entry_hash,
-            std::function<bool(const entry_view&, const entry_view&)> entry_equal_to,
-            std::vector<std::pair<entry, entry>>&                     connection_keys,
-            std::unique_ptr<connection_map_type>&                     p_connection_map)
-        {
-            connection_keys.reserve(std::size(connections));
-            for (auto&& e: connections)
-            {
-                connection_keys.push_back(std::move(e.first));
-            }
-
-            auto p_map = std::make_unique<connection_map_type>(
-                std::size(connections),
-                connection_map_hash{ std::move(entry_hash) },
-                connection_map_key_eq{ std::move(entry_equal_to) });
-            p_map->reserve(std::size(connections));
-            for (auto i = static_cast<std::size_t>(0); i < std::size(connections); ++i)
-            {
-                const auto&      connection_key = connection_keys[i];
-                const entry_view from{ connection_key.first.p_key(),
-                                       &connection_key.first.value(),
-                                       connection_key.first.cost() };
-                const entry_view to{ connection_key.second.p_key(),
-                                     &connection_key.second.value(),
-                                     connection_key.second.cost() };
-                p_map->insert(std::make_pair(std::make_pair(from, to), connections[i].second));
-            }
-
-            p_connection_map = std::move(p_map);
-        }
-
-
-        // variables
-
-        const entry_map_type m_entry_map;
-
-        std::vector<std::pair<entry, entry>> m_connection_keys;
-
-        std::unique_ptr<connection_map_type> m_p_connection_map;
-    };
-
-
-    unordered_map_vocabulary::unordered_map_vocabulary(
-        std::vector<std::pair<std::string, std::vector<entry>>>   entries,
-        std::vector<std::pair<std::pair<entry, entry>, int>>      connections,
-        std::function<std::size_t(const entry_view&)>             entry_hash,
-        std::function<bool(const entry_view&, const entry_view&)> entry_equal_to) :
-    m_p_impl{ std::make_unique<impl>(
-        std::move(entries),
-        std::move(connections),
-        std::move(entry_hash),
-        std::move(entry_equal_to)) }
-    {}
-
-    unordered_map_vocabulary::~unordered_map_vocabulary() = default;
-
-    std::vector<entry_view> unordered_map_vocabulary::find_entries_impl(const input& key) const
-    {
-        return m_p_impl->find_entries_impl(key);
-    }
-
-    connection unordered_map_vocabulary::find_connection_impl(const node& from, const entry_view& to) const
-    {
-        return m_p_impl->find_connection_impl(from, to);
-    }
-
-
-}
+/*! \file
+    \brief An unordered map vocabulary.
+
+    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
+*/
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <boost/core/noncopyable.hpp>
+
+#include <tetengo/lattice/connection.hpp>
+#include <tetengo/lattice/entry.hpp>
+#include <tetengo/lattice/input.hpp>
+#include <tetengo/lattice/node.hpp>
+#include <tetengo/lattice/string_input.hpp>
+#include <tetengo/lattice/string_view_input.hpp>
+#include <tetengo/lattice/unordered_map_vocabulary.hpp>
+
+
+namespace tetengo::lattice
+{
+    namespace
+    {
+        template <typename Value>
+        class flat_table
+        {
+        public:
+            // constructors and destructor
+
+            explicit flat_table(const std::size_t size) : m_slots{}, m_mask{}
+            {
+                auto capacity = static_cast<std::size_t>(1);
+                while (capacity < size * 2)
+                {
+                    capacity *= 2;
+                }
+                m_slots.assign(capacity, std::make_pair(empty_key(), Value{}));
+                m_mask = capacity - 1;
+            }
+
+
+            // functions
+
+            bool insert(const std::uint64_t key, Value value)
+            {
+                assert(key != empty_key());
+                for (auto i = mix(key) & m_mask;; i = (i + 1) & m_mask)
+                {
+                    auto& slot = m_slots[i];
+                    if (slot.first == key)
+                    {
+                        return false;
+                    }
+                    if (slot.first == empty_key())
+                    {
+                        slot = std::make_pair(key, std::move(value));
+                        return true;
+                    }
+                }
+            }
+
+            const Value* find(const std::uint64_t key) const
+            {
+                for (auto i = mix(key) & m_mask;; i = (i + 1) & m_mask)
+                {
+                    const auto& slot = m_slots[i];
+                    if (slot.first == key)
+                    {
+                        return &slot.second;
+                    }
+                    if (slot.first == empty_key())
+                    {
+                        return nullptr;
+                    }
+                }
+            }
+
+
+        private:
+            // static functions
+
+            static constexpr std::uint64_t empty_key()
+            {
+                return std::numeric_limits<std::uint64_t>::max();
+            }
+
+            static std::size_t mix(std::uint64_t key)
+            {
+                key ^= key >> 33;
+                key *= 0xFF51AFD7ED558CCDULL;
+                key ^= key >> 33;
+                key *= 0xC4CEB9FE1A85EC53ULL;
+                key ^= key >> 33;
+                return static_cast<std::size_t>(key);
+            }
+
+
+            // variables
+
+            std::vector<std::pair<std::uint64_t, Value>> m_slots;
+
+            std::size_t m_mask;
+        };
+
+        entry_view origin_entry_of(const node& from)
+        {
+            return entry_view{ from.p_key(), &from.value(), from.node_cost() };
+        }
+
+        const entry_view& origin_entry_of(const entry_view& from)
+        {
+            return from;
+        }
+
+        std::string_view key_value_of(const input& key)
+        {
+            return key.is<string_view_input>() ? key.as<string_view_input>().value() :
+                                                 std::string_view{ key.as<string_input>().value() };
+        }
+
+
+    }
+
+
+    class unordered_map_vocabulary::impl : private boost::noncopyable
+    {
+    public:
+        // constructors and destructor
+
+        impl(
+            std::vector<std::pair<std::string, std::vector<entry>>>   entries,
+            std::vector<std::pair<std::pair<entry, entry>, int>>      connections,
+            std::function<std::size_t(const entry_view&)>             entry_hash,
+            std::function<bool(const entry_view&, const entry_view&)> entry_equal_to) :
+        m_entry_map{ make_entry_map(std::move(entries)) },
+        m_connection_keys{ make_connection_keys(connections) },
+        m_entry_id_map{ 0,
+                        entry_id_map_hash{ std::move(entry_hash) },
+                        entry_id_map_key_eq{ std::move(entry_equal_to) } },
+        m_owned_entry_ids{ owned_entry_count(m_entry_map) },
+        m_connection_table{ std::size(connections) }
+        {
+            build_entry_ids();
+            build_connection_table(connections);
+        }
+
+
+        // functions
+
+        std::vector<entry_view> find_entries_impl(const input& key) const
+        {
+            const auto found = m_entry_map.find(key_value_of(key));
+            if (found == std::end(m_entry_map))
+            {
+                return std::vector<entry_view>{};
+            }
+
+            std::vector<entry_view> entries{};
+            entries.reserve(std::size(found->second));
+            std::copy(std::begin(found->second), std::end(found->second), std::back_inserter(entries));
+            return entries;
+        }
+
+        void find_subrange_entries_impl(
+            const input&                  input_,
+            const std::size_t             offset,
+            const std::size_t             length,
+            std::pmr::vector<entry_view>& entries) const
+        {
+            const auto found = m_entry_map.find(key_value_of(input_).substr(offset, length));
+            if (found == std::end(m_entry_map))
+            {
+                return;
+            }
+
+            entries.insert(std::end(entries), std::begin(found->second), std::end(found->second));
+        }
+
+        connection find_connection_impl(const node& from, const entry_view& to) const
+        {
+            const auto from_id = find_entry_id(origin_entry_of(from));
+            const auto to_id = find_entry_id(to);
+            if (from_id == no_entry_id() || to_id == no_entry_id())
+            {
+                return connection{ std::numeric_limits<int>::max() };
+            }
+
+            const auto* const p_cost = m_connection_table.find(connection_table_key(from_id, to_id));
+            return connection{ p_cost ? *p_cost : std::numeric_limits<int>::max() };
+        }
+
+        template <typename From>
+        void find_connections_impl(
+            const std::span<const From> from,
+            const entry_view&           to,
+            const std::span<int>        costs) const
+        {
+            const auto to_id = find_entry_id(to);
+            if (to_id == no_entry_id())
+            {
+                std::fill(std::begin(costs), std::end(costs), std::numeric_limits<int>::max());
+                return;
+            }
+
+            for (auto i = static_cast<std::size_t>(0); i < std::size(from); ++i)
+            {
+                const auto from_id = find_entry_id(origin_entry_of(from[i]));
+                if (from_id == no_entry_id())
+                {
+                    costs[i] = std::numeric_limits<int>::max();
+                    continue;
+                }
+
+                const auto* const p_cost = m_connection_table.find(connection_table_key(from_id, to_id));
+                costs[i] = p_cost ? *p_cost : std::numeric_limits<int>::max();
+            }
+        }
+
+    private:
+        // types
+
+        struct entry_map_hash
+        {
+            using is_transparent = void;
+
+            std::size_t operator()(const std::string_view& key) const
+            {
+                return std::hash<std::string_view>{}(key);
+            }
+        };
+
+        using entry_map_type = std::unordered_map<std::string, std::vector<entry>, entry_map_hash, std::equal_to<>>;
+
+        struct entry_id_map_hash
+        {
+            std::function<std::size_t(const entry_view&)> hash;
+
+            explicit entry_id_map_hash(std::function<std::size_t(const entry_view&)> hash) : hash{ std::move(hash) } {}
+
+            std::size_t operator()(const entry_view& key) const
+            {
+                return hash(key);
+            }
+        };
+
+        struct entry_id_map_key_eq
+        {
+            std::function<bool(const entry_view&, const entry_view&)> key_eq;
+
+            explicit entry_id_map_key_eq(std::function<bool(const entry_view&, const entry_view&)> key_eq) :
+            key_eq{ std::move(key_eq) }
+            {}
+
+            bool operator()(const entry_view& one, const entry_view& another) const
+            {
+                return key_eq(one, another);
+            }
+        };
+
+        using entry_id_map_type = std::unordered_map<entry_view, std::size_t, entry_id_map_hash, entry_id_map_key_eq>;
+
+        struct owned_entry_id
+        {
+            const input* p_key;
+
+            int cost;
+
+            std::size_t id;
+        };
+
+
+        // static functions
+
+        static constexpr std::size_t no_entry_id()
+        {
+            return std::numeric_limits<std::uint32_t>::max();
+        }
+
+        static entry_map_type make_entry_map(std::vector<std::pair<std::string, std::vector<entry>>> entries)
+        {
+            entry_map_type map{};
+            map.reserve(std::size(entries));
+            for (auto&& e: entries)
+            {
+                map.insert(std::make_pair(std::move(e.first), std::move(e.second)));
+            }
+            return map;
+        }
+
+        static std::size_t owned_entry_count(const entry_map_type& entry_map)
+        {
+            // The BOS/EOS entries are also counted.
+            auto count = static_cast<std::size_t>(2);
+            for (const auto& e: entry_map)
+            {
+                count += std::size(e.second);
+            }
+            return count;
+        }
+
+        static std::vector<std::pair<entry, entry>>
+        make_connection_keys(std::vector<std::pair<std::pair<entry, entry>, int>>& connections)
+        {
+            std::vector<std::pair<entry, entry>> keys{};
+            keys.reserve(std::size(connections));
+            for (auto&& e: connections)
+            {
+                keys.push_back(std::move(e.first));
+            }
+            return keys;
+        }
+
+        static std::uint64_t connection_table_key(const std::size_t from_id, const std::size_t to_id)
+        {
+            return (static_cast<std::uint64_t>(from_id) << 32) | static_cast<std::uint64_t>(to_id);
+        }
+
+        static std::uint64_t owned_entry_ids_key(const entry_view& entry)
+        {
+            return static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(entry.value()));
+        }
+
+
+        // variables
+
+        const entry_map_type m_entry_map;
+
+        const std::vector<std::pair<entry, entry>> m_connection_keys;
+
+        entry_id_map_type m_entry_id_map;
+
+        flat_table<owned_entry_id> m_owned_entry_ids;
+
+        flat_table<int> m_connection_table;
+
+
+        // functions
+
+        std::size_t intern(const entry_view& entry)
+        {
+            const auto inserted = m_entry_id_map.insert(std::make_pair(entry, std::size(m_entry_id_map)));
+            if (std::size(m_entry_id_map) >= no_entry_id())
+            {
+                throw std::length_error{ "Too many distinct entries." };
+            }
+            return inserted.first->second;
+        }
+
+        void build_entry_ids()
+        {
+            m_entry_id_map.reserve(owned_entry_count(m_entry_map) + 2 * std::size(m_connection_keys));
+
+            // The entries owned by this vocabulary are identified by the addresses of their values, so that
+            // find_connection() calls the user-provided hash and equal_to functions only for foreign entries.
+            const auto register_owned = [this](const entry_view& entry) {
+                m_owned_entry_ids.insert(
+                    owned_entry_ids_key(entry), owned_entry_id{ entry.p_key(), entry.cost(), intern(entry) });
+            };
+            register_owned(entry_view::bos_eos());
+            register_owned(entry_view{ entry::bos_eos() });
+            for (const auto& e: m_entry_map)
+            {
+                for (const auto& entry_: e.second)
+                {
+                    register_owned(entry_view{ entry_ });
+                }
+            }
+        }
+
+        void build_connection_table(const std::vector<std::pair<std::pair<entry, entry>, int>>& connections)
+        {
+            for (auto i = static_cast<std::size_t>(0); i < std::size(connections); ++i)
+            {
+                const auto from_id = intern(entry_view{ m_connection_keys[i].first });
+                const auto to_id = intern(entry_view{ m_connection_keys[i].second });
+                m_connection_table.insert(connection_table_key(from_id, to_id), connections[i].second);
+            }
+        }
+
+        std::size_t find_entry_id(const entry_view& entry) const
+        {
+            if (const auto* const p_owned = m_owned_entry_ids.find(owned_entry_ids_key(entry));
+                p_owned && p_owned->p_key == entry.p_key() && p_owned->cost == entry.cost())
+            {
+                return p_owned->id;
+            }
+
+            const auto found = m_entry_id_map.find(entry);
+            return found != std::end(m_entry_id_map) ? found->second : no_entry_id();
+        }
+    };
+
+
+    unordered_map_vocabulary::unordered_map_vocabulary(
+        std::vector<std::pair<std::string, std::vector<entry>>>   entries,
+        std::vector<std::pair<std::pair<entry, entry>, int>>      connections,
+        std::function<std::size_t(const entry_view&)>             entry_hash,
+        std::function<bool(const entry_view&, const entry_view&)> entry_equal_to) :
+    m_p_impl{ std::make_unique<impl>(
+        std::move(entries),
+        std::move(connections),
+        std::move(entry_hash),
+        std::move(entry_equal_to)) }
+    {}
+
+    unordered_map_vocabulary::~unordered_map_vocabulary() = default;
+
+    std::vector<entry_view> unordered_map_vocabulary::find_entries_impl(const input& key) const
+    {
+        return m_p_impl->find_entries_impl(key);
+    }
+
+    void unordered_map_vocabulary::find_subrange_entries_impl(
+        const input&                  input_,
+        const std::size_t             offset,
+        const std::size_t             length,
+        std::pmr::vector<entry_view>& entries) const
+    {
+        m_p_impl->find_subrange_entries_impl(input_, offset, length, entries);
+    }
+
+    connection unordered_map_vocabulary::find_connection_impl(const node& from, const entry_view& to) const
+    {
+        return m_p_impl->find_connection_impl(from, to);
+    }
+
+    void unordered_map_vocabulary::find_connections_impl(
+        const std::span<const node> from,
+        const entry_view&           to,
+        const std::span<int>        costs) const
+    {
+        m_p_impl->find_connections_impl(from, to, costs);
+    }
+
+    bool unordered_map_vocabulary::find_entry_connections_impl(
+        const std::span<const entry_view> from,
+        const entry_view&                 to,
+        const std::span<int>              costs) const
+    {
+        m_p_impl->find_connections_impl(from, to, costs);
+        return true;
+    }
+
+
+}
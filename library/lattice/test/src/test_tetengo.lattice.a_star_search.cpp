@@ -0,0 +1,450 @@
+/*! \file
+    \brief An A* N-best lattice path search.
+
+    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
+*/
+
+#include <any>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/stl_interfaces/iterator_interface.hpp> // IWYU pragma: keep
+#include <boost/test/unit_test.hpp>
+
+#include <tetengo/lattice/a_star_search.hpp>
+#include <tetengo/lattice/connection.hpp>
+#include <tetengo/lattice/constraint.hpp>
+#include <tetengo/lattice/constraint_element.hpp>
+#include <tetengo/lattice/cost_traits.hpp>
+#include <tetengo/lattice/entry.hpp>
+#include <tetengo/lattice/input.hpp>
+#include <tetengo/lattice/lattice.hpp>
+#include <tetengo/lattice/n_best_iterator.hpp>
+#include <tetengo/lattice/node.hpp>
+#include <tetengo/lattice/node_constraint_element.hpp>
+#include <tetengo/lattice/path.hpp>
+#include <tetengo/lattice/string_input.hpp>
+#include <tetengo/lattice/unordered_map_vocabulary.hpp>
+#include <tetengo/lattice/vocabulary.hpp>
+#include <tetengo/lattice/wildcard_constraint_element.hpp>
+
+
+namespace
+{
+    std::unique_ptr<tetengo::lattice::input> to_input(const char* const string)
+    {
+        return std::make_unique<tetengo::lattice::string_input>(string);
+    }
+
+    /*
+                   +------------------mizuho/sakura/tsubame-------------------+
+                   |                path cost: 4270/3220/2990                 |
+                   |                                                          |
+                   +------------ariake/rapid811------------+                  |
+                   |          path cost: 2850/2010         |                  |
+                   |                                       |                  |
+        BOS--(Hakata)--kamome/local415--(Tosu)--local813--(Omuta)--local817--(Kumamoto)--EOS
+                     path cost: 1640/1370   |   pc: 2830           pc: 3160   |     path cost:3390
+                                            |                                 |
+                                            +------------local815-------------+
+                                                      path cost: 3550
+
+        (0) 3390  BOS - tsubame - EOS
+            [ sakura(3620),   local817(3760), local815(4050), mizuho(4670)   ]
+        (1) 3620  BOS - sakura - EOS
+            [ local817(3760), local815(4050), mizuho(4670)                   ]
+        (2) 3760  BOS - rapid811 - local817 - EOS
+            [ local815(4050), ariake(4600),   mizuho(4670),   local813(4680) ]
+        (3) 4050  BOS - local415 - local815 - EOS
+            [ kamome(4320),   ariake(4600),   mizuho(4670),   local813(4680) ]
+        (4) 4320  BOS - kamome - local815 - EOS
+            [ ariake(4600),   mizuho(4670),   local813(4680)                 ]
+        (5) 4600  BOS - ariake - local817 - EOS
+            [ mizuho(4670),   local813(4680)                                 ]
+        (6) 4670  BOS - mizuho - EOS
+            [ local813(4680)                                                 ]
+        (7) 4680  BOS - local415 - local813 - local817 - EOS
+            [ kamome(4950)                                                   ]
+        (8) 4950  BOS - kamome - local813 - local817 - EOS
+            [                                                                ]
+        (9) ----  -
+            [                                                                ]
+    */
+    const std::vector<std::pair<std::string, std::vector<tetengo::lattice::entry>>> entries{
+        { "[HakataTosu][TosuOmuta][OmutaKumamoto]",
+          {
+              { to_input("Hakata-Tosu-Omuta-Kumamoto"), std::string{ "mizuho" }, 3670 },
+              { to_input("Hakata-Tosu-Omuta-Kumamoto"), std::string{ "sakura" }, 2620 },
+              { to_input("Hakata-Tosu-Omuta-Kumamoto"), std::string{ "tsubame" }, 2390 },
+          } },
+        { "[HakataTosu][TosuOmuta]",
+          {
+              { to_input("Hakata-Tosu-Omuta"), std::string{ "ariake" }, 2150 },
+              { to_input("Hakata-Tosu-Omuta"), std::string{ "rapid811" }, 1310 },
+          } },
+        { "[HakataTosu]",
+          {
+              { to_input("Hakata-Tosu"), std::string{ "kamome" }, 840 },
+              { to_input("Hakata-Tosu"), std::string{ "local415" }, 570 },
+          } },
+        { "[TosuOmuta]",
+          {
+              { to_input("Tosu-Omuta"), std::string{ "local813" }, 860 },
+          } },
+        { "[TosuOmuta][OmutaKumamoto]",
+          {
+              { to_input("Tosu-Omuta-Kumamoto"), std::string{ "local815" }, 1680 },
+          } },
+        { "[OmutaKumamoto]",
+          {
+              { to_input("Omuta-Kumamoto"), std::string{ "local817" }, 950 },
+          } },
+    };
+
+    const std::vector<std::pair<std::pair<tetengo::lattice::entry, tetengo::lattice::entry>, int>> connections{
+        { { tetengo::lattice::entry::bos_eos(), { to_input("Hakata-Tosu-Omuta-Kumamoto"), {}, 0 } }, 600 },
+        { { tetengo::lattice::entry::bos_eos(), { to_input("Hakata-Tosu-Omuta"), {}, 0 } }, 700 },
+        { { tetengo::lattice::entry::bos_eos(), { to_input("Hakata-Tosu"), {}, 0 } }, 800 },
+        { { tetengo::lattice::entry::bos_eos(), tetengo::lattice::entry::bos_eos() }, 8000 },
+        { { { to_input("Hakata-Tosu"), {}, 0 }, { to_input("Tosu-Omuta-Kumamoto"), {}, 0 } }, 500 },
+        { { { to_input("Hakata-Tosu"), {}, 0 }, { to_input("Tosu-Omuta"), {}, 0 } }, 600 },
+        { { { to_input("Hakata-Tosu"), {}, 0 }, tetengo::lattice::entry::bos_eos() }, 6000 },
+        { { { to_input("Hakata-Tosu-Omuta"), {}, 0 }, { to_input("Omuta-Kumamoto"), {}, 0 } }, 200 },
+        { { { to_input("Hakata-Tosu-Omuta"), {}, 0 }, tetengo::lattice::entry::bos_eos() }, 2000 },
+        { { { to_input("Tosu-Omuta"), {}, 0 }, { to_input("Omuta-Kumamoto"), {}, 0 } }, 300 },
+        { { { to_input("Tosu-Omuta"), {}, 0 }, tetengo::lattice::entry::bos_eos() }, 3000 },
+        { { { to_input("Hakata-Tosu-Omuta-Kumamoto"), {}, 0 }, tetengo::lattice::entry::bos_eos() }, 400 },
+        { { { to_input("Tosu-Omuta-Kumamoto"), {}, 0 }, tetengo::lattice::entry::bos_eos() }, 500 },
+        { { { to_input("Omuta-Kumamoto"), {}, 0 }, tetengo::lattice::entry::bos_eos() }, 600 },
+    };
+
+    std::size_t cpp_entry_hash(const tetengo::lattice::entry_view& entry)
+    {
+        return entry.p_key() ? entry.p_key()->hash_value() : 0;
+    }
+
+    bool cpp_entry_equal_to(const tetengo::lattice::entry_view& one, const tetengo::lattice::entry_view& another)
+    {
+        return (!one.p_key() && !another.p_key()) ||
+               (one.p_key() && another.p_key() && *one.p_key() == *another.p_key());
+    }
+
+    std::unique_ptr<tetengo::lattice::vocabulary> create_cpp_vocabulary()
+    {
+        return std::make_unique<tetengo::lattice::unordered_map_vocabulary>(
+            entries, connections, cpp_entry_hash, cpp_entry_equal_to);
+    }
+
+    void push_back_inputs(tetengo::lattice::lattice& lattice_)
+    {
+        lattice_.push_back(to_input("[HakataTosu]"));
+        lattice_.push_back(to_input("[TosuOmuta]"));
+        lattice_.push_back(to_input("[OmutaKumamoto]"));
+    }
+
+    std::vector<std::string> to_values(const tetengo::lattice::path& path_)
+    {
+        std::vector<std::string> values{};
+        for (const auto& node: path_.nodes())
+        {
+            if (node.value().has_value())
+            {
+                values.push_back(std::any_cast<std::string>(node.value()));
+            }
+        }
+        return values;
+    }
+
+    struct train
+    {
+        std::string name;
+
+        int number;
+    };
+
+    class fractional_train_vocabulary : public tetengo::lattice::basic_vocabulary<train, double>
+    {
+    public:
+        // constructors and destructor
+
+        fractional_train_vocabulary() : m_entries{}
+        {
+            m_entries.emplace_back(to_input("a"), train{ "alpha", 1 }, 1.5);
+            m_entries.emplace_back(to_input("a"), train{ "apple", 2 }, 2.25);
+            m_entries.emplace_back(to_input("b"), train{ "bravo", 4 }, 0.5);
+        }
+
+
+    private:
+        // variables
+
+        std::vector<tetengo::lattice::basic_entry<train, double>> m_entries;
+
+
+        // virtual functions
+
+        virtual std::vector<entry_view_type> find_entries_impl(const tetengo::lattice::input& key) const override
+        {
+            std::vector<entry_view_type> found{};
+            for (const auto& entry: m_entries)
+            {
+                if (*entry.p_key() == key)
+                {
+                    found.emplace_back(entry);
+                }
+            }
+            return found;
+        }
+
+        virtual connection_type find_connection_impl(const node_type& from, const entry_view_type& to) const override
+        {
+            if (from.value().name == "alpha" && to.value()->name == "bravo")
+            {
+                return connection_type{ tetengo::lattice::cost_traits<double>::infinity() };
+            }
+            return connection_type{ 0.25 * (from.value().number + to.value()->number) };
+        }
+    };
+
+
+}
+
+
+BOOST_AUTO_TEST_SUITE(test_tetengo)
+BOOST_AUTO_TEST_SUITE(lattice)
+BOOST_AUTO_TEST_SUITE(a_star_search)
+
+
+BOOST_AUTO_TEST_CASE(construction)
+{
+    BOOST_TEST_PASSPOINT();
+
+    {
+        const auto                p_vocabulary = create_cpp_vocabulary();
+        tetengo::lattice::lattice lattice_{ *p_vocabulary };
+        push_back_inputs(lattice_);
+
+        auto                                  eos_node_and_preceding_edge_costs = lattice_.settle();
+        const tetengo::lattice::a_star_search search{ lattice_,
+                                                      std::move(eos_node_and_preceding_edge_costs.first),
+                                                      std::make_unique<tetengo::lattice::constraint>(),
+                                                      10,
+                                                      1000 };
+    }
+    {
+        const auto                p_vocabulary = create_cpp_vocabulary();
+        tetengo::lattice::lattice lattice_{ *p_vocabulary };
+        push_back_inputs(lattice_);
+
+        auto eos_node_and_preceding_edge_costs = lattice_.settle();
+        BOOST_CHECK_THROW(
+            const tetengo::lattice::a_star_search search(
+                lattice_,
+                std::move(eos_node_and_preceding_edge_costs.first),
+                std::unique_ptr<tetengo::lattice::constraint>(),
+                10,
+                1000),
+            std::invalid_argument);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(next)
+{
+    BOOST_TEST_PASSPOINT();
+
+    {
+        const auto                p_vocabulary = create_cpp_vocabulary();
+        tetengo::lattice::lattice lattice_{ *p_vocabulary };
+        push_back_inputs(lattice_);
+
+        auto                            eos_node_and_preceding_edge_costs = lattice_.settle();
+        tetengo::lattice::a_star_search search{ lattice_,
+                                                eos_node_and_preceding_edge_costs.first,
+                                                std::make_unique<tetengo::lattice::constraint>(),
+                                                100,
+                                                1000 };
+
+        tetengo::lattice::n_best_iterator       iterator{ lattice_,
+                                                    std::move(eos_node_and_preceding_edge_costs.first),
+                                                    std::make_unique<tetengo::lattice::constraint>() };
+        const tetengo::lattice::n_best_iterator last{};
+        for (; iterator != last; ++iterator)
+        {
+            const auto path = search.next();
+            BOOST_TEST_REQUIRE(path.has_value());
+            BOOST_TEST(path->cost() == iterator->cost());
+            BOOST_TEST(to_values(*path) == to_values(*iterator));
+        }
+        BOOST_TEST(!search.next());
+        BOOST_TEST(!search.budget_exhausted());
+    }
+    {
+        const auto                p_vocabulary = create_cpp_vocabulary();
+        tetengo::lattice::lattice lattice_{ *p_vocabulary };
+        push_back_inputs(lattice_);
+
+        auto                            eos_node_and_preceding_edge_costs = lattice_.settle();
+        tetengo::lattice::a_star_search search{ lattice_,
+                                                std::move(eos_node_and_preceding_edge_costs.first),
+                                                std::make_unique<tetengo::lattice::constraint>(),
+                                                3,
+                                                1000 };
+
+        {
+            const auto path = search.next();
+            BOOST_TEST_REQUIRE(path.has_value());
+            BOOST_TEST(path->cost() == 3390);
+            BOOST_TEST((to_values(*path) == std::vector<std::string>{ "tsubame" }));
+        }
+        {
+            const auto path = search.next();
+            BOOST_TEST_REQUIRE(path.has_value());
+            BOOST_TEST(path->cost() == 3620);
+            BOOST_TEST((to_values(*path) == std::vector<std::string>{ "sakura" }));
+        }
+        {
+            const auto path = search.next();
+            BOOST_TEST_REQUIRE(path.has_value());
+            BOOST_TEST(path->cost() == 3760);
+            BOOST_TEST((to_values(*path) == std::vector<std::string>{ "rapid811", "local817" }));
+        }
+        BOOST_TEST(!search.next());
+        BOOST_TEST(!search.budget_exhausted());
+    }
+    {
+        const auto                p_vocabulary = create_cpp_vocabulary();
+        tetengo::lattice::lattice lattice_{ *p_vocabulary };
+        push_back_inputs(lattice_);
+
+        auto eos_node_and_preceding_edge_costs = lattice_.settle();
+
+        std::vector<std::unique_ptr<tetengo::lattice::constraint_element>> pattern{};
+        pattern.push_back(std::make_unique<tetengo::lattice::node_constraint_element>(lattice_.nodes_at(0)[0]));
+        pattern.push_back(std::make_unique<tetengo::lattice::wildcard_constraint_element>(0));
+        pattern.push_back(std::make_unique<tetengo::lattice::node_constraint_element>(lattice_.nodes_at(3)[4]));
+        pattern.push_back(
+            std::make_unique<tetengo::lattice::node_constraint_element>(eos_node_and_preceding_edge_costs.first));
+        tetengo::lattice::a_star_search search{ lattice_,
+                                                std::move(eos_node_and_preceding_edge_costs.first),
+                                                std::make_unique<tetengo::lattice::constraint>(std::move(pattern)),
+                                                100,
+                                                1000 };
+
+        {
+            const auto path = search.next();
+            BOOST_TEST_REQUIRE(path.has_value());
+            BOOST_TEST(path->cost() == 3760);
+            BOOST_TEST((to_values(*path) == std::vector<std::string>{ "rapid811", "local817" }));
+        }
+        {
+            const auto path = search.next();
+            BOOST_TEST_REQUIRE(path.has_value());
+            BOOST_TEST(path->cost() == 4600);
+            BOOST_TEST((to_values(*path) == std::vector<std::string>{ "ariake", "local817" }));
+        }
+        {
+            const auto path = search.next();
+            BOOST_TEST_REQUIRE(path.has_value());
+            BOOST_TEST(path->cost() == 4680);
+            BOOST_TEST((to_values(*path) == std::vector<std::string>{ "local415", "local813", "local817" }));
+        }
+        {
+            const auto path = search.next();
+            BOOST_TEST_REQUIRE(path.has_value());
+            BOOST_TEST(path->cost() == 4950);
+            BOOST_TEST((to_values(*path) == std::vector<std::string>{ "kamome", "local813", "local817" }));
+        }
+        BOOST_TEST(!search.next());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(expansion_count)
+{
+    BOOST_TEST_PASSPOINT();
+
+    const auto                p_vocabulary = create_cpp_vocabulary();
+    tetengo::lattice::lattice lattice_{ *p_vocabulary };
+    push_back_inputs(lattice_);
+
+    auto                            eos_node_and_preceding_edge_costs = lattice_.settle();
+    tetengo::lattice::a_star_search search{ lattice_,
+                                            std::move(eos_node_and_preceding_edge_costs.first),
+                                            std::make_unique<tetengo::lattice::constraint>(),
+                                            100,
+                                            1000 };
+
+    BOOST_TEST(search.expansion_count() == 0U);
+    const auto path = search.next();
+    BOOST_TEST_REQUIRE(path.has_value());
+    BOOST_TEST(search.expansion_count() == 3U);
+}
+
+BOOST_AUTO_TEST_CASE(budget_exhausted)
+{
+    BOOST_TEST_PASSPOINT();
+
+    const auto                p_vocabulary = create_cpp_vocabulary();
+    tetengo::lattice::lattice lattice_{ *p_vocabulary };
+    push_back_inputs(lattice_);
+
+    auto                            eos_node_and_preceding_edge_costs = lattice_.settle();
+    tetengo::lattice::a_star_search search{ lattice_,
+                                            std::move(eos_node_and_preceding_edge_costs.first),
+                                            std::make_unique<tetengo::lattice::constraint>(),
+                                            100,
+                                            3 };
+
+    BOOST_TEST(!search.budget_exhausted());
+    {
+        const auto path = search.next();
+        BOOST_TEST_REQUIRE(path.has_value());
+        BOOST_TEST(path->cost() == 3390);
+    }
+    BOOST_TEST(!search.budget_exhausted());
+    {
+        const auto path = search.next();
+        BOOST_TEST(!path.has_value());
+    }
+    BOOST_TEST(search.budget_exhausted());
+    BOOST_TEST(search.expansion_count() == 3U);
+}
+
+BOOST_AUTO_TEST_CASE(basic_a_star_search)
+{
+    BOOST_TEST_PASSPOINT();
+
+    const fractional_train_vocabulary              vocabulary_{};
+    tetengo::lattice::basic_lattice<train, double> lattice_{ vocabulary_ };
+    lattice_.push_back(to_input("a"));
+    lattice_.push_back(to_input("b"));
+
+    auto eos_node_and_preceding_edge_costs = lattice_.settle();
+    tetengo::lattice::basic_a_star_search<train, double> search{
+        lattice_,
+        std::move(eos_node_and_preceding_edge_costs.first),
+        std::make_unique<tetengo::lattice::basic_constraint<train, double>>(),
+        100,
+        1000
+    };
+
+    {
+        const auto path = search.next();
+        BOOST_TEST_REQUIRE(path.has_value());
+        BOOST_TEST(path->cost() == 5.75);
+        BOOST_TEST_REQUIRE(std::size(path->nodes()) == 4U);
+        BOOST_TEST(path->nodes()[1].value().name == "apple");
+        BOOST_TEST(path->nodes()[2].value().name == "bravo");
+    }
+    BOOST_TEST(!search.next());
+    BOOST_TEST(!search.budget_exhausted());
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,597 @@
+/*! \file
+    \brief A batch analyzer.
+
+    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
+*/
+
+#include <any>
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/preprocessor.hpp>
+#include <boost/scope_exit.hpp>
+#include <boost/stl_interfaces/iterator_interface.hpp> // IWYU pragma: keep
+#include <boost/test/unit_test.hpp>
+
+#include <tetengo/lattice/batchAnalyzer.h>
+#include <tetengo/lattice/batch_analyzer.hpp>
+#include <tetengo/lattice/constraint.hpp>
+#include <tetengo/lattice/entry.h>
+#include <tetengo/lattice/entry.hpp>
+#include <tetengo/lattice/input.h>
+#include <tetengo/lattice/input.hpp>
+#include <tetengo/lattice/lattice.hpp>
+#include <tetengo/lattice/n_best_iterator.hpp>
+#include <tetengo/lattice/node.hpp>
+#include <tetengo/lattice/path.hpp>
+#include <tetengo/lattice/string_input.hpp>
+#include <tetengo/lattice/unordered_map_vocabulary.hpp>
+#include <tetengo/lattice/vocabulary.h>
+#include <tetengo/lattice/vocabulary.hpp>
+
+
+namespace
+{
+    std::unique_ptr<tetengo::lattice::input> to_input(const char* const string)
+    {
+        return std::make_unique<tetengo::lattice::string_input>(string);
+    }
+
+    /*
+                   +------------------mizuho/sakura/tsubame-------------------+
+                   |                path cost: 4270/3220/2990                 |
+                   |                                                          |
+                   +------------ariake/rapid811------------+                  |
+                   |          path cost: 2850/2010         |                  |
+                   |                                       |                  |
+        BOS--(Hakata)--kamome/local415--(Tosu)--local813--(Omuta)--local817--(Kumamoto)--EOS
+                     path cost: 1640/1370   |   pc: 2830           pc: 3160   |     path cost:3390
+                                            |                                 |
+                                            +------------local815-------------+
+                                                      path cost: 3550
+
+        (0) 3390  BOS - tsubame - EOS
+            [ sakura(3620),   local817(3760), local815(4050), mizuho(4670)   ]
+        (1) 3620  BOS - sakura - EOS
+            [ local817(3760), local815(4050), mizuho(4670)                   ]
+        (2) 3760  BOS - rapid811 - local817 - EOS
+            [ local815(4050), ariake(4600),   mizuho(4670),   local813(4680) ]
+        (3) 4050  BOS - local415 - local815 - EOS
+            [ kamome(4320),   ariake(4600),   mizuho(4670),   local813(4680) ]
+        (4) 4320  BOS - kamome - local815 - EOS
+            [ ariake(4600),   mizuho(4670),   local813(4680)                 ]
+        (5) 4600  BOS - ariake - local817 - EOS
+            [ mizuho(4670),   local813(4680)                                 ]
+        (6) 4670  BOS - mizuho - EOS
+            [ local813(4680)                                                 ]
+        (7) 4680  BOS - local415 - local813 - local817 - EOS
+            [ kamome(4950)                                                   ]
+        (8) 4950  BOS - kamome - local813 - local817 - EOS
+            [                                                                ]
+        (9) ----  -
+            [                                                                ]
+    */
+    const std::vector<std::pair<std::string, std::vector<tetengo::lattice::entry>>> entries{
+        { "[HakataTosu][TosuOmuta][OmutaKumamoto]",
+          {
+              { to_input("Hakata-Tosu-Omuta-Kumamoto"), std::string{ "mizuho" }, 3670 },
+              { to_input("Hakata-Tosu-Omuta-Kumamoto"), std::string{ "sakura" }, 2620 },
+              { to_input("Hakata-Tosu-Omuta-Kumamoto"), std::string{ "tsubame" }, 2390 },
+          } },
+        { "[HakataTosu][TosuOmuta]",
+          {
+              { to_input("Hakata-Tosu-Omuta"), std::string{ "ariake" }, 2150 },
+              { to_input("Hakata-Tosu-Omuta"), std::string{ "rapid811" }, 1310 },
+          } },
+        { "[HakataTosu]",
+          {
+              { to_input("Hakata-Tosu"), std::string{ "kamome" }, 840 },
+              { to_input("Hakata-Tosu"), std::string{ "local415" }, 570 },
+          } },
+        { "[TosuOmuta]",
+          {
+              { to_input("Tosu-Omuta"), std::string{ "local813" }, 860 },
+          } },
+        { "[TosuOmuta][OmutaKumamoto]",
+          {
+              { to_input("Tosu-Omuta-Kumamoto"), std::string{ "local815" }, 1680 },
+          } },
+        { "[OmutaKumamoto]",
+          {
+              { to_input("Omuta-Kumamoto"), std::string{ "local817" }, 950 },
+          } },
+    };
+
+    const std::vector<std::pair<std::pair<tetengo::lattice::entry, tetengo::lattice::entry>, int>> connections{
+        { { tetengo::lattice::entry::bos_eos(), { to_input("Hakata-Tosu-Omuta-Kumamoto"), {}, 0 } }, 600 },
+        { { tetengo::lattice::entry::bos_eos(), { to_input("Hakata-Tosu-Omuta"), {}, 0 } }, 700 },
+        { { tetengo::lattice::entry::bos_eos(), { to_input("Hakata-Tosu"), {}, 0 } }, 800 },
+        { { tetengo::lattice::entry::bos_eos(), tetengo::lattice::entry::bos_eos() }, 8000 },
+        { { { to_input("Hakata-Tosu"), {}, 0 }, { to_input("Tosu-Omuta-Kumamoto"), {}, 0 } }, 500 },
+        { { { to_input("Hakata-Tosu"), {}, 0 }, { to_input("Tosu-Omuta"), {}, 0 } }, 600 },
+        { { { to_input("Hakata-Tosu"), {}, 0 }, tetengo::lattice::entry::bos_eos() }, 6000 },
+        { { { to_input("Hakata-Tosu-Omuta"), {}, 0 }, { to_input("Omuta-Kumamoto"), {}, 0 } }, 200 },
+        { { { to_input("Hakata-Tosu-Omuta"), {}, 0 }, tetengo::lattice::entry::bos_eos() }, 2000 },
+        { { { to_input("Tosu-Omuta"), {}, 0 }, { to_input("Omuta-Kumamoto"), {}, 0 } }, 300 },
+        { { { to_input("Tosu-Omuta"), {}, 0 }, tetengo::lattice::entry::bos_eos() }, 3000 },
+        { { { to_input("Hakata-Tosu-Omuta-Kumamoto"), {}, 0 }, tetengo::lattice::entry::bos_eos() }, 400 },
+        { { { to_input("Tosu-Omuta-Kumamoto"), {}, 0 }, tetengo::lattice::entry::bos_eos() }, 500 },
+        { { { to_input("Omuta-Kumamoto"), {}, 0 }, tetengo::lattice::entry::bos_eos() }, 600 },
+    };
+
+    std::size_t cpp_entry_hash(const tetengo::lattice::entry_view& entry)
+    {
+        return entry.p_key() ? entry.p_key()->hash_value() : 0;
+    }
+
+    bool cpp_entry_equal_to(const tetengo::lattice::entry_view& one, const tetengo::lattice::entry_view& another)
+    {
+        return (!one.p_key() && !another.p_key()) ||
+               (one.p_key() && another.p_key() && *one.p_key() == *another.p_key());
+    }
+
+    std::unique_ptr<tetengo::lattice::vocabulary> create_cpp_vocabulary()
+    {
+        return std::make_unique<tetengo::lattice::unordered_map_vocabulary>(
+            entries, connections, cpp_entry_hash, cpp_entry_equal_to);
+    }
+
+    std::vector<std::unique_ptr<tetengo::lattice::input>> make_inputs(const std::vector<const char*>& strings)
+    {
+        std::vector<std::unique_ptr<tetengo::lattice::input>> inputs{};
+        inputs.reserve(std::size(strings));
+        for (const auto* const string: strings)
+        {
+            inputs.push_back(to_input(string));
+        }
+        return inputs;
+    }
+
+    const std::vector<std::vector<const char*>> input_strings{
+        { "[HakataTosu]", "[TosuOmuta]", "[OmutaKumamoto]" },
+        { "[HakataTosu][TosuOmuta]", "[OmutaKumamoto]" },
+        { "[HakataTosu]", "[TosuOmuta][OmutaKumamoto]" },
+        { "[HakataTosu][TosuOmuta][OmutaKumamoto]" },
+        { "[HakataTosu]" },
+    };
+
+    std::vector<std::vector<std::unique_ptr<tetengo::lattice::input>>> make_batch_inputs(const std::size_t repeat_count)
+    {
+        std::vector<std::vector<std::unique_ptr<tetengo::lattice::input>>> batch_inputs{};
+        batch_inputs.reserve(std::size(input_strings) * repeat_count);
+        for (auto i = static_cast<std::size_t>(0); i < repeat_count; ++i)
+        {
+            for (const auto& strings: input_strings)
+            {
+                batch_inputs.push_back(make_inputs(strings));
+            }
+        }
+        return batch_inputs;
+    }
+
+    std::vector<std::string> to_values(const tetengo::lattice::path& path_)
+    {
+        std::vector<std::string> values{};
+        for (const auto& node: path_.nodes())
+        {
+            if (node.value().has_value())
+            {
+                values.push_back(std::any_cast<std::string>(node.value()));
+            }
+        }
+        return values;
+    }
+
+    std::vector<std::string> to_values(const tetengo::lattice::analyzed_path& path_)
+    {
+        std::vector<std::string> values{};
+        for (const auto& entry: path_.entries())
+        {
+            values.push_back(std::any_cast<std::string>(*entry.value()));
+        }
+        return values;
+    }
+
+    std::vector<std::pair<int, std::vector<std::string>>>
+    analyze_sequentially(const tetengo::lattice::vocabulary& vocabulary_, const std::vector<const char*>& strings)
+    {
+        tetengo::lattice::lattice lattice_{ vocabulary_ };
+        for (const auto* const string: strings)
+        {
+            lattice_.push_back(to_input(string));
+        }
+        auto eos_node_and_preceding_edge_costs = lattice_.settle();
+
+        std::vector<std::pair<int, std::vector<std::string>>> paths{};
+        tetengo::lattice::n_best_iterator                     iterator{ lattice_,
+                                                    std::move(eos_node_and_preceding_edge_costs.first),
+                                                    std::make_unique<tetengo::lattice::constraint>() };
+        const tetengo::lattice::n_best_iterator               last{};
+        for (; std::size(paths) < 3 && iterator != last; ++iterator)
+        {
+            paths.emplace_back(iterator->cost(), to_values(*iterator));
+        }
+        return paths;
+    }
+
+    size_t c_entry_hash(const tetengo_lattice_entryView_t* const p_entry)
+    {
+        if (p_entry)
+        {
+            const auto* const p_entry_key = tetengo_lattice_entryView_createKeyOf(p_entry->key_handle);
+            BOOST_SCOPE_EXIT(p_entry_key)
+            {
+                tetengo_lattice_input_destroy(p_entry_key);
+            }
+            BOOST_SCOPE_EXIT_END;
+            return p_entry_key ? tetengo_lattice_input_hashValue(p_entry_key) : 0;
+        }
+        else
+        {
+            assert(false);
+            return 0;
+        }
+    }
+
+    int
+    c_entry_equal_to(const tetengo_lattice_entryView_t* const p_one, const tetengo_lattice_entryView_t* const p_another)
+    {
+        if (p_one && p_another)
+        {
+            const auto* const p_one_key = tetengo_lattice_entryView_createKeyOf(p_one->key_handle);
+            BOOST_SCOPE_EXIT(p_one_key)
+            {
+                tetengo_lattice_input_destroy(p_one_key);
+            }
+            BOOST_SCOPE_EXIT_END;
+            const auto* const p_another_key = tetengo_lattice_entryView_createKeyOf(p_another->key_handle);
+            BOOST_SCOPE_EXIT(p_another_key)
+            {
+                tetengo_lattice_input_destroy(p_another_key);
+            }
+            BOOST_SCOPE_EXIT_END;
+            return (!p_one_key && !p_another_key) ||
+                   (p_one_key && p_another_key && tetengo_lattice_input_equal(p_one_key, p_another_key));
+        }
+        else
+        {
+            assert(false);
+            return 0;
+        }
+    }
+
+    tetengo_lattice_vocabulary_t* create_c_vocabulary()
+    {
+        std::vector<tetengo_lattice_entry_t> entry_values{};
+        std::vector<std::size_t>             entry_value_offsets{};
+        entry_value_offsets.reserve(std::size(entries) + 1);
+        for (const auto& e: entries)
+        {
+            entry_values.reserve(std::size(entry_values) + std::size(e.second));
+            entry_value_offsets.push_back(std::size(entry_values));
+
+            for (const auto& ev: e.second)
+            {
+                entry_values.push_back({ reinterpret_cast<tetengo_lattice_entry_keyHandle_t>(ev.p_key()),
+                                         std::any_cast<std::string>(&ev.value()),
+                                         ev.cost() });
+            }
+        }
+        entry_value_offsets.push_back(std::size(entry_values));
+
+        std::vector<tetengo_lattice_keyEntriesPair_t> key_entries_pairs{};
+        key_entries_pairs.reserve(std::size(entries));
+        for (auto i = static_cast<std::size_t>(0); i < std::size(entries); ++i)
+        {
+            const auto& entry = entries[i];
+            key_entries_pairs.push_back({ { entry.first.c_str(), entry.first.length() },
+                                          &entry_values[entry_value_offsets[i]],
+                                          entry_value_offsets[i + 1] - entry_value_offsets[i] });
+        }
+
+        std::vector<tetengo_lattice_entry_t> connection_froms{};
+        connection_froms.reserve(std::size(connections));
+        std::vector<tetengo_lattice_entry_t> connection_tos{};
+        connection_tos.reserve(std::size(connections));
+        for (const auto& c: connections)
+        {
+            connection_froms.push_back({ reinterpret_cast<tetengo_lattice_entry_keyHandle_t>(c.first.first.p_key()),
+                                         std::any_cast<std::string>(&c.first.first.value()),
+                                         c.first.first.cost() });
+            connection_tos.push_back({ reinterpret_cast<tetengo_lattice_entry_keyHandle_t>(c.first.second.p_key()),
+                                       std::any_cast<std::string>(&c.first.second.value()),
+                                       c.first.second.cost() });
+        }
+
+        std::vector<tetengo_lattice_entriesConnectionCostPair_t> entries_connection_cost_pairs{};
+        entries_connection_cost_pairs.reserve(std::size(connections));
+        for (auto i = static_cast<std::size_t>(0); i < std::size(connections); ++i)
+        {
+            const auto& connection = connections[i];
+            const auto& from = connection_froms[i];
+            const auto& to = connection_tos[i];
+            entries_connection_cost_pairs.push_back({ &from, &to, connection.second });
+        }
+
+        return tetengo_lattice_vocabulary_createUnorderedMapVocabulary(
+            std::data(key_entries_pairs),
+            std::size(key_entries_pairs),
+            std::data(entries_connection_cost_pairs),
+            std::size(entries_connection_cost_pairs),
+            c_entry_hash,
+            c_entry_equal_to);
+    }
+
+
+}
+
+
+BOOST_AUTO_TEST_SUITE(test_tetengo)
+BOOST_AUTO_TEST_SUITE(lattice)
+BOOST_AUTO_TEST_SUITE(analyzed_path)
+
+
+BOOST_AUTO_TEST_CASE(construction)
+{
+    BOOST_TEST_PASSPOINT();
+
+    const tetengo::lattice::string_input  key{ "mizuho" };
+    const std::any                        value{ 42 };
+    const tetengo::lattice::analyzed_path path_{ { { &key, &value, 24 } }, 4242 };
+}
+
+BOOST_AUTO_TEST_CASE(entries)
+{
+    BOOST_TEST_PASSPOINT();
+
+    const tetengo::lattice::string_input  key{ "mizuho" };
+    const std::any                        value{ 42 };
+    const tetengo::lattice::analyzed_path path_{ { { &key, &value, 24 } }, 4242 };
+
+    BOOST_TEST_REQUIRE(std::size(path_.entries()) == 1U);
+    BOOST_TEST(path_.entries()[0].p_key() == &key);
+    BOOST_TEST(path_.entries()[0].value() == &value);
+    BOOST_TEST(path_.entries()[0].cost() == 24);
+}
+
+BOOST_AUTO_TEST_CASE(cost)
+{
+    BOOST_TEST_PASSPOINT();
+
+    const tetengo::lattice::analyzed_path path_{ {}, 4242 };
+
+    BOOST_TEST(path_.cost() == 4242);
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE(batch_analyzer)
+
+
+BOOST_AUTO_TEST_CASE(construction)
+{
+    BOOST_TEST_PASSPOINT();
+
+    {
+        const auto                             p_vocabulary = create_cpp_vocabulary();
+        const tetengo::lattice::batch_analyzer analyzer{ *p_vocabulary, 4 };
+    }
+
+    {
+        const auto* const p_vocabulary = create_c_vocabulary();
+        BOOST_SCOPE_EXIT(p_vocabulary)
+        {
+            tetengo_lattice_vocabulary_destroy(p_vocabulary);
+        }
+        BOOST_SCOPE_EXIT_END;
+        BOOST_TEST_REQUIRE(p_vocabulary);
+
+        const auto* const p_analyzer = tetengo_lattice_batchAnalyzer_create(p_vocabulary, 4);
+        BOOST_SCOPE_EXIT(p_analyzer)
+        {
+            tetengo_lattice_batchAnalyzer_destroy(p_analyzer);
+        }
+        BOOST_SCOPE_EXIT_END;
+        BOOST_TEST(p_analyzer);
+    }
+    {
+        const auto* const p_analyzer = tetengo_lattice_batchAnalyzer_create(nullptr, 4);
+        BOOST_TEST(!p_analyzer);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(thread_count)
+{
+    BOOST_TEST_PASSPOINT();
+
+    {
+        const auto                             p_vocabulary = create_cpp_vocabulary();
+        const tetengo::lattice::batch_analyzer analyzer{ *p_vocabulary, 4 };
+
+        BOOST_TEST(analyzer.thread_count() == 4U);
+    }
+    {
+        const auto                             p_vocabulary = create_cpp_vocabulary();
+        const tetengo::lattice::batch_analyzer analyzer{ *p_vocabulary, 0 };
+
+        BOOST_TEST(analyzer.thread_count() > 0U);
+    }
+
+    {
+        const auto* const p_vocabulary = create_c_vocabulary();
+        BOOST_SCOPE_EXIT(p_vocabulary)
+        {
+            tetengo_lattice_vocabulary_destroy(p_vocabulary);
+        }
+        BOOST_SCOPE_EXIT_END;
+        BOOST_TEST_REQUIRE(p_vocabulary);
+
+        const auto* const p_analyzer = tetengo_lattice_batchAnalyzer_create(p_vocabulary, 4);
+        BOOST_SCOPE_EXIT(p_analyzer)
+        {
+            tetengo_lattice_batchAnalyzer_destroy(p_analyzer);
+        }
+        BOOST_SCOPE_EXIT_END;
+        BOOST_TEST_REQUIRE(p_analyzer);
+
+        BOOST_TEST(tetengo_lattice_batchAnalyzer_threadCount(p_analyzer) == 4U);
+    }
+    {
+        BOOST_TEST(tetengo_lattice_batchAnalyzer_threadCount(nullptr) == 0U);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(analyze)
+{
+    BOOST_TEST_PASSPOINT();
+
+    {
+        const auto                       p_vocabulary = create_cpp_vocabulary();
+        tetengo::lattice::batch_analyzer analyzer{ *p_vocabulary, 4 };
+
+        for (auto i = 0; i < 2; ++i)
+        {
+            const auto results = analyzer.analyze(make_batch_inputs(10), 3);
+
+            BOOST_TEST_REQUIRE(std::size(results) == std::size(input_strings) * 10);
+            for (auto j = static_cast<std::size_t>(0); j < std::size(results); ++j)
+            {
+                const auto expected = analyze_sequentially(*p_vocabulary, input_strings[j % std::size(input_strings)]);
+                BOOST_TEST_REQUIRE(std::size(results[j]) == std::size(expected));
+                for (auto k = static_cast<std::size_t>(0); k < std::size(expected); ++k)
+                {
+                    BOOST_TEST(results[j][k].cost() == expected[k].first);
+                    BOOST_TEST(to_values(results[j][k]) == expected[k].second);
+                }
+            }
+        }
+    }
+    {
+        const auto                       p_vocabulary = create_cpp_vocabulary();
+        tetengo::lattice::batch_analyzer analyzer{ *p_vocabulary, 4 };
+
+        const auto results = analyzer.analyze(make_batch_inputs(1), 3);
+
+        BOOST_TEST_REQUIRE(std::size(results[0]) == 3U);
+        BOOST_TEST(results[0][0].cost() == 3390);
+        BOOST_TEST((to_values(results[0][0]) == std::vector<std::string>{ "tsubame" }));
+        BOOST_TEST(results[0][1].cost() == 3620);
+        BOOST_TEST((to_values(results[0][1]) == std::vector<std::string>{ "sakura" }));
+        BOOST_TEST(results[0][2].cost() == 3760);
+        BOOST_TEST((to_values(results[0][2]) == std::vector<std::string>{ "rapid811", "local817" }));
+    }
+    {
+        const auto                       p_vocabulary = create_cpp_vocabulary();
+        tetengo::lattice::batch_analyzer analyzer{ *p_vocabulary, 4 };
+
+        const auto results = analyzer.analyze({}, 3);
+
+        BOOST_TEST(std::empty(results));
+    }
+    {
+        const auto                       p_vocabulary = create_cpp_vocabulary();
+        tetengo::lattice::batch_analyzer analyzer{ *p_vocabulary, 4 };
+
+        auto inputs = make_batch_inputs(10);
+        inputs[7].push_back(to_input("[Unknown]"));
+        BOOST_CHECK_THROW(
+            [[maybe_unused]] const auto results = analyzer.analyze(std::move(inputs), 3), std::invalid_argument);
+
+        const auto results = analyzer.analyze(make_batch_inputs(1), 3);
+        BOOST_TEST_REQUIRE(std::size(results[0]) == 3U);
+        BOOST_TEST(results[0][0].cost() == 3390);
+    }
+
+    {
+        const auto* const p_vocabulary = create_c_vocabulary();
+        BOOST_SCOPE_EXIT(p_vocabulary)
+        {
+            tetengo_lattice_vocabulary_destroy(p_vocabulary);
+        }
+        BOOST_SCOPE_EXIT_END;
+        BOOST_TEST_REQUIRE(p_vocabulary);
+
+        auto* const p_analyzer = tetengo_lattice_batchAnalyzer_create(p_vocabulary, 2);
+        BOOST_SCOPE_EXIT(p_analyzer)
+        {
+            tetengo_lattice_batchAnalyzer_destroy(p_analyzer);
+        }
+        BOOST_SCOPE_EXIT_END;
+        BOOST_TEST_REQUIRE(p_analyzer);
+
+        const std::vector<tetengo_lattice_input_t*> inputs{
+            tetengo_lattice_input_createStringInput("[HakataTosu]"),
+            tetengo_lattice_input_createStringInput("[TosuOmuta]"),
+            tetengo_lattice_input_createStringInput("[OmutaKumamoto]"),
+            tetengo_lattice_input_createStringInput("[HakataTosu]"),
+        };
+        const std::vector<size_t> input_counts{ 3, 1 };
+        const auto                result = tetengo_lattice_batchAnalyzer_analyze(
+            p_analyzer, std::data(inputs), std::data(input_counts), std::size(input_counts), 3);
+        BOOST_TEST_REQUIRE(result);
+
+        BOOST_TEST(tetengo_lattice_batchAnalyzer_pathCount(p_analyzer, 0) == 3U);
+        {
+            const auto entry_count = tetengo_lattice_batchAnalyzer_path(p_analyzer, 0, 0, nullptr, nullptr);
+            BOOST_TEST_REQUIRE(entry_count == 1U);
+            std::vector<tetengo_lattice_entryView_t> entries(entry_count);
+            auto                                     cost = 0;
+            const auto                               entry_count_again =
+                tetengo_lattice_batchAnalyzer_path(p_analyzer, 0, 0, std::data(entries), &cost);
+            BOOST_TEST(entry_count_again == entry_count);
+            BOOST_TEST(cost == 3390);
+            const auto* const p_value =
+                static_cast<const std::string*>(tetengo_lattice_entryView_valueOf(entries[0].value_handle));
+            BOOST_TEST_REQUIRE(p_value);
+            BOOST_TEST(*p_value == "tsubame");
+            BOOST_TEST(entries[0].cost == 2390);
+        }
+        {
+            const auto entry_count = tetengo_lattice_batchAnalyzer_path(p_analyzer, 0, 2, nullptr, nullptr);
+            BOOST_TEST(entry_count == 2U);
+        }
+        BOOST_TEST(tetengo_lattice_batchAnalyzer_pathCount(p_analyzer, 1) > 0U);
+        BOOST_TEST(tetengo_lattice_batchAnalyzer_pathCount(p_analyzer, 2) == 0U);
+        BOOST_TEST(tetengo_lattice_batchAnalyzer_path(p_analyzer, 0, 3, nullptr, nullptr) == 0U);
+    }
+    {
+        const auto* const p_vocabulary = create_c_vocabulary();
+        BOOST_SCOPE_EXIT(p_vocabulary)
+        {
+            tetengo_lattice_vocabulary_destroy(p_vocabulary);
+        }
+        BOOST_SCOPE_EXIT_END;
+        BOOST_TEST_REQUIRE(p_vocabulary);
+
+        auto* const p_analyzer = tetengo_lattice_batchAnalyzer_create(p_vocabulary, 2);
+        BOOST_SCOPE_EXIT(p_analyzer)
+        {
+            tetengo_lattice_batchAnalyzer_destroy(p_analyzer);
+        }
+        BOOST_SCOPE_EXIT_END;
+        BOOST_TEST_REQUIRE(p_analyzer);
+
+        const std::vector<tetengo_lattice_input_t*> inputs{ tetengo_lattice_input_createStringInput("[Unknown]") };
+        const std::vector<size_t>                   input_counts{ 1 };
+        const auto                                  result = tetengo_lattice_batchAnalyzer_analyze(
+            p_analyzer, std::data(inputs), std::data(input_counts), std::size(input_counts), 3);
+        BOOST_TEST(!result);
+    }
+    {
+        const std::vector<tetengo_lattice_input_t*> inputs{ tetengo_lattice_input_createStringInput("[HakataTosu]") };
+        const std::vector<size_t>                   input_counts{ 1 };
+        const auto                                  result = tetengo_lattice_batchAnalyzer_analyze(
+            nullptr, std::data(inputs), std::data(input_counts), std::size(input_counts), 3);
+        BOOST_TEST(!result);
+    }
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,86 @@
+/*! \file
+    \brief Cost traits.
+
+    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
+*/
+
+#include <cstdint>
+#include <limits>
+
+#include <boost/preprocessor.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <tetengo/lattice/cost_traits.hpp>
+
+
+BOOST_AUTO_TEST_SUITE(test_tetengo)
+BOOST_AUTO_TEST_SUITE(lattice)
+BOOST_AUTO_TEST_SUITE(cost_traits)
+
+
+BOOST_AUTO_TEST_CASE(infinity)
+{
+    BOOST_TEST_PASSPOINT();
+
+    {
+        static_assert(tetengo::lattice::cost_traits<int>::infinity() == std::numeric_limits<int>::max());
+        static_assert(
+            tetengo::lattice::cost_traits<std::int64_t>::infinity() == std::numeric_limits<std::int64_t>::max());
+        static_assert(tetengo::lattice::cost_traits<float>::infinity() == std::numeric_limits<float>::infinity());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(is_infinity)
+{
+    BOOST_TEST_PASSPOINT();
+
+    {
+        BOOST_TEST(tetengo::lattice::cost_traits<int>::is_infinity(std::numeric_limits<int>::max()));
+        BOOST_TEST(!tetengo::lattice::cost_traits<int>::is_infinity(42));
+    }
+    {
+        BOOST_TEST(tetengo::lattice::cost_traits<float>::is_infinity(std::numeric_limits<float>::infinity()));
+        BOOST_TEST(!tetengo::lattice::cost_traits<float>::is_infinity(std::numeric_limits<float>::max()));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(add)
+{
+    BOOST_TEST_PASSPOINT();
+
+    {
+        using traits_type = tetengo::lattice::cost_traits<int>;
+
+        BOOST_TEST(traits_type::add(42, 24) == 66);
+        BOOST_TEST(traits_type::add(42, -24) == 18);
+        BOOST_TEST(traits_type::add(traits_type::infinity(), 42) == traits_type::infinity());
+        BOOST_TEST(traits_type::add(42, traits_type::infinity()) == traits_type::infinity());
+        BOOST_TEST(traits_type::add(traits_type::infinity(), -42) == traits_type::infinity());
+        BOOST_TEST(traits_type::add(std::numeric_limits<int>::max() - 1, 2) == traits_type::infinity());
+        BOOST_TEST(traits_type::add(std::numeric_limits<int>::min() + 1, -2) == std::numeric_limits<int>::min());
+    }
+    {
+        using traits_type = tetengo::lattice::cost_traits<std::int64_t>;
+
+        const auto large = static_cast<std::int64_t>(std::numeric_limits<int>::max());
+        BOOST_TEST(traits_type::add(large, large) == large * 2);
+        BOOST_TEST(traits_type::add(traits_type::infinity(), 1) == traits_type::infinity());
+        BOOST_TEST(traits_type::add(std::numeric_limits<std::int64_t>::max() - 1, 2) == traits_type::infinity());
+    }
+    {
+        using traits_type = tetengo::lattice::cost_traits<float>;
+
+        BOOST_TEST(traits_type::add(0.5f, 0.25f) == 0.75f);
+        BOOST_TEST(traits_type::add(0.5f, -0.25f) == 0.25f);
+        BOOST_TEST(traits_type::add(traits_type::infinity(), 0.5f) == traits_type::infinity());
+        BOOST_TEST(traits_type::add(0.5f, traits_type::infinity()) == traits_type::infinity());
+    }
+    {
+        static_assert(tetengo::lattice::cost_traits<int>::add(42, 24) == 66);
+    }
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,476 @@
+/*! \file
+    \brief A mapped vocabulary.
+
+    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
+*/
+
+#include <any>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <ios>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/preprocessor.hpp>
+#include <boost/scope_exit.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <tetengo/lattice/connection.hpp>
+#include <tetengo/lattice/entry.hpp>
+#include <tetengo/lattice/input.hpp>
+#include <tetengo/lattice/mapped_vocabulary.hpp>
+#include <tetengo/lattice/node.hpp>
+#include <tetengo/lattice/string_input.hpp>
+#include <tetengo/lattice/string_view_input.hpp>
+
+
+namespace
+{
+    constexpr char operator""_c(const unsigned long long int uc)
+    {
+        return static_cast<char>(uc);
+    }
+
+    const std::string key_mizuho{ 0xE3_c, 0x81_c, 0xBF_c, 0xE3_c, 0x81_c, 0x9A_c, 0xE3_c, 0x81_c, 0xBB_c };
+
+    const std::string surface_mizuho{ 0xE7_c, 0x91_c, 0x9E_c, 0xE7_c, 0xA9_c, 0x82_c };
+
+    const std::string key_sakura{ 0xE3_c, 0x81_c, 0x95_c, 0xE3_c, 0x81_c, 0x8F_c, 0xE3_c, 0x82_c, 0x89_c };
+
+    const std::string surface_sakura1{ 0xE6_c, 0xA1_c, 0x9C_c };
+
+    const std::string surface_sakura2{ 0xE3_c, 0x81_c, 0x95_c, 0xE3_c, 0x81_c, 0x8F_c, 0xE3_c, 0x82_c, 0x89_c };
+
+    tetengo::lattice::node make_node(const tetengo::lattice::entry_view& entry)
+    {
+        static const std::vector<int> preceding_edge_costs{};
+        return tetengo::lattice::node{ entry,
+                                       0,
+                                       std::numeric_limits<std::size_t>::max(),
+                                       &preceding_edge_costs,
+                                       std::numeric_limits<std::size_t>::max(),
+                                       std::numeric_limits<int>::max() };
+    }
+
+    std::size_t entry_hash(const tetengo::lattice::entry_view& entry)
+    {
+        return entry.p_key() ? entry.p_key()->hash_value() : 0;
+    }
+
+    bool entry_equal_to(const tetengo::lattice::entry_view& one, const tetengo::lattice::entry_view& another)
+    {
+        return (!one.p_key() && !another.p_key()) ||
+               (one.p_key() && another.p_key() && *one.p_key() == *another.p_key() &&
+                std::any_cast<std::string>(*one.value()) == std::any_cast<std::string>(*another.value()));
+    }
+
+    std::string serialize_value(const std::any& value)
+    {
+        return std::any_cast<std::string>(value);
+    }
+
+    void write_vocabulary(std::ostream& stream)
+    {
+        std::vector<std::pair<std::string, std::vector<tetengo::lattice::entry>>> entries{};
+        entries.emplace_back(key_mizuho, std::vector<tetengo::lattice::entry>{});
+        entries.back().second.emplace_back(
+            std::make_unique<tetengo::lattice::string_input>(key_mizuho), surface_mizuho, 42);
+        entries.emplace_back(key_sakura, std::vector<tetengo::lattice::entry>{});
+        entries.back().second.emplace_back(
+            std::make_unique<tetengo::lattice::string_input>(key_sakura), surface_sakura1, 24);
+        entries.back().second.emplace_back(
+            std::make_unique<tetengo::lattice::string_input>(key_sakura), surface_sakura2, 2424);
+
+        std::vector<std::pair<std::pair<tetengo::lattice::entry, tetengo::lattice::entry>, int>> connections{};
+        connections.emplace_back(
+            std::make_pair(tetengo::lattice::entry::bos_eos(), entries[0].second[0]), 100);
+        connections.emplace_back(std::make_pair(entries[0].second[0], entries[1].second[0]), 4242);
+        connections.emplace_back(std::make_pair(entries[1].second[1], tetengo::lattice::entry::bos_eos()), 200);
+
+        tetengo::lattice::mapped_vocabulary::write(
+            stream, entries, connections, entry_hash, entry_equal_to, serialize_value);
+    }
+
+    std::filesystem::path temporary_file_path(const std::string& header = std::string{}, const bool valid = true)
+    {
+        const auto path = std::filesystem::temp_directory_path() / "test_tetengo.lattice.mapped_vocabulary";
+
+        {
+            std::ofstream stream{ path, std::ios_base::binary };
+            stream.write(std::data(header), std::size(header));
+            if (valid)
+            {
+                write_vocabulary(stream);
+            }
+            else
+            {
+                const std::string content(64, 'X');
+                stream.write(std::data(content), std::size(content));
+            }
+        }
+
+        return path;
+    }
+
+    std::filesystem::path broken_file_path()
+    {
+        std::ostringstream content_stream{};
+        write_vocabulary(content_stream);
+        auto content = content_stream.str();
+
+        std::uint64_t key_table_offset = 0;
+        std::memcpy(&key_table_offset, std::data(content) + 32, sizeof(key_table_offset));
+        const auto broken_key_offset = static_cast<std::uint64_t>(std::size(content));
+        std::memcpy(std::data(content) + key_table_offset, &broken_key_offset, sizeof(broken_key_offset));
+
+        const auto path = std::filesystem::temp_directory_path() / "test_tetengo.lattice.mapped_vocabulary";
+        {
+            std::ofstream stream{ path, std::ios_base::binary };
+            stream.write(std::data(content), std::size(content));
+        }
+
+        return path;
+    }
+
+
+}
+
+
+BOOST_AUTO_TEST_SUITE(test_tetengo)
+BOOST_AUTO_TEST_SUITE(lattice)
+BOOST_AUTO_TEST_SUITE(mapped_vocabulary)
+
+
+BOOST_AUTO_TEST_CASE(construction)
+{
+    BOOST_TEST_PASSPOINT();
+
+    {
+        const auto file_path = temporary_file_path();
+        BOOST_SCOPE_EXIT(&file_path)
+        {
+            std::filesystem::remove(file_path);
+        }
+        BOOST_SCOPE_EXIT_END;
+
+        const boost::interprocess::file_mapping file_mapping{ file_path.c_str(), boost::interprocess::read_only };
+        const auto file_size = static_cast<std::size_t>(std::filesystem::file_size(file_path));
+
+        const tetengo::lattice::mapped_vocabulary vocabulary{ file_mapping, 0, file_size };
+    }
+    {
+        const auto file_path = temporary_file_path("hoge");
+        BOOST_SCOPE_EXIT(&file_path)
+        {
+            std::filesystem::remove(file_path);
+        }
+        BOOST_SCOPE_EXIT_END;
+
+        const boost::interprocess::file_mapping file_mapping{ file_path.c_str(), boost::interprocess::read_only };
+        const auto file_size = static_cast<std::size_t>(std::filesystem::file_size(file_path));
+
+        const tetengo::lattice::mapped_vocabulary vocabulary{ file_mapping, 4, file_size };
+    }
+    {
+        const auto file_path = temporary_file_path();
+        BOOST_SCOPE_EXIT(&file_path)
+        {
+            std::filesystem::remove(file_path);
+        }
+        BOOST_SCOPE_EXIT_END;
+
+        const boost::interprocess::file_mapping file_mapping{ file_path.c_str(), boost::interprocess::read_only };
+        const auto file_size = static_cast<std::size_t>(std::filesystem::file_size(file_path));
+        BOOST_CHECK_THROW(
+            const tetengo::lattice::mapped_vocabulary vocabulary(file_mapping, file_size + 1, file_size),
+            std::invalid_argument);
+    }
+    {
+        const auto file_path = temporary_file_path("", false);
+        BOOST_SCOPE_EXIT(&file_path)
+        {
+            std::filesystem::remove(file_path);
+        }
+        BOOST_SCOPE_EXIT_END;
+
+        const boost::interprocess::file_mapping file_mapping{ file_path.c_str(), boost::interprocess::read_only };
+        const auto file_size = static_cast<std::size_t>(std::filesystem::file_size(file_path));
+        BOOST_CHECK_THROW(
+            const tetengo::lattice::mapped_vocabulary vocabulary(file_mapping, 0, file_size), std::invalid_argument);
+    }
+    {
+        const auto file_path = temporary_file_path("hoge", false);
+        BOOST_SCOPE_EXIT(&file_path)
+        {
+            std::filesystem::remove(file_path);
+        }
+        BOOST_SCOPE_EXIT_END;
+
+        const boost::interprocess::file_mapping file_mapping{ file_path.c_str(), boost::interprocess::read_only };
+        const auto file_size = static_cast<std::size_t>(std::filesystem::file_size(file_path));
+        BOOST_CHECK_THROW(
+            const tetengo::lattice::mapped_vocabulary vocabulary(file_mapping, file_size - 4, file_size),
+            std::invalid_argument);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(find_entries)
+{
+    BOOST_TEST_PASSPOINT();
+
+    {
+        const auto file_path = temporary_file_path();
+        BOOST_SCOPE_EXIT(&file_path)
+        {
+            std::filesystem::remove(file_path);
+        }
+        BOOST_SCOPE_EXIT_END;
+
+        const boost::interprocess::file_mapping file_mapping{ file_path.c_str(), boost::interprocess::read_only };
+        const auto file_size = static_cast<std::size_t>(std::filesystem::file_size(file_path));
+
+        const tetengo::lattice::mapped_vocabulary vocabulary{ file_mapping, 0, file_size };
+
+        {
+            const auto found = vocabulary.find_entries(tetengo::lattice::string_input{ key_mizuho });
+            BOOST_TEST_REQUIRE(std::size(found) == 1U);
+            BOOST_TEST_REQUIRE(found[0].p_key());
+            BOOST_TEST(found[0].p_key()->as<tetengo::lattice::string_input>().value() == key_mizuho);
+            BOOST_TEST(std::any_cast<std::string_view>(*found[0].value()) == surface_mizuho);
+            BOOST_TEST(found[0].cost() == 42);
+        }
+        {
+            const auto found = vocabulary.find_entries(tetengo::lattice::string_view_input{ key_sakura });
+            BOOST_TEST_REQUIRE(std::size(found) == 2U);
+            BOOST_TEST(found[0].p_key()->as<tetengo::lattice::string_input>().value() == key_sakura);
+            BOOST_TEST(std::any_cast<std::string_view>(*found[0].value()) == surface_sakura1);
+            BOOST_TEST(found[0].cost() == 24);
+            BOOST_TEST(found[1].p_key()->as<tetengo::lattice::string_input>().value() == key_sakura);
+            BOOST_TEST(std::any_cast<std::string_view>(*found[1].value()) == surface_sakura2);
+            BOOST_TEST(found[1].cost() == 2424);
+
+            const auto found_again = vocabulary.find_entries(tetengo::lattice::string_input{ key_sakura });
+            BOOST_TEST_REQUIRE(std::size(found_again) == 2U);
+            BOOST_TEST(found_again[0].p_key() == found[0].p_key());
+            BOOST_TEST(found_again[0].value() == found[0].value());
+        }
+        {
+            const auto found = vocabulary.find_entries(tetengo::lattice::string_input{ surface_sakura1 });
+            BOOST_TEST(std::empty(found));
+        }
+    }
+    {
+        const auto file_path = broken_file_path();
+        BOOST_SCOPE_EXIT(&file_path)
+        {
+            std::filesystem::remove(file_path);
+        }
+        BOOST_SCOPE_EXIT_END;
+
+        const boost::interprocess::file_mapping file_mapping{ file_path.c_str(), boost::interprocess::read_only };
+        const auto file_size = static_cast<std::size_t>(std::filesystem::file_size(file_path));
+
+        const tetengo::lattice::mapped_vocabulary vocabulary{ file_mapping, 0, file_size };
+
+        BOOST_CHECK_THROW(
+            [[maybe_unused]] const auto found = vocabulary.find_entries(tetengo::lattice::string_input{ key_mizuho }),
+            std::runtime_error);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(find_subrange_entries)
+{
+    BOOST_TEST_PASSPOINT();
+
+    {
+        const auto file_path = temporary_file_path();
+        BOOST_SCOPE_EXIT(&file_path)
+        {
+            std::filesystem::remove(file_path);
+        }
+        BOOST_SCOPE_EXIT_END;
+
+        const boost::interprocess::file_mapping file_mapping{ file_path.c_str(), boost::interprocess::read_only };
+        const auto file_size = static_cast<std::size_t>(std::filesystem::file_size(file_path));
+
+        const tetengo::lattice::mapped_vocabulary vocabulary{ file_mapping, 0, file_size };
+
+        const tetengo::lattice::string_view_input input{ key_mizuho + key_sakura };
+
+        std::pmr::vector<tetengo::lattice::entry_view> found{};
+        vocabulary.find_subrange_entries(input, 0, key_mizuho.length(), found);
+        vocabulary.find_subrange_entries(input, key_mizuho.length(), key_sakura.length(), found);
+        vocabulary.find_subrange_entries(input, 0, input.length(), found);
+        BOOST_TEST_REQUIRE(std::size(found) == 3U);
+        BOOST_TEST(found[0].p_key()->as<tetengo::lattice::string_input>().value() == key_mizuho);
+        BOOST_TEST(std::any_cast<std::string_view>(*found[0].value()) == surface_mizuho);
+        BOOST_TEST(found[1].p_key()->as<tetengo::lattice::string_input>().value() == key_sakura);
+        BOOST_TEST(std::any_cast<std::string_view>(*found[1].value()) == surface_sakura1);
+        BOOST_TEST(found[2].p_key()->as<tetengo::lattice::string_input>().value() == key_sakura);
+        BOOST_TEST(std::any_cast<std::string_view>(*found[2].value()) == surface_sakura2);
+
+        const auto found_by_key = vocabulary.find_entries(tetengo::lattice::string_input{ key_sakura });
+        BOOST_TEST_REQUIRE(std::size(found_by_key) == 2U);
+        BOOST_TEST(found_by_key[0].value() == found[1].value());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(find_connection)
+{
+    BOOST_TEST_PASSPOINT();
+
+    {
+        const auto file_path = temporary_file_path();
+        BOOST_SCOPE_EXIT(&file_path)
+        {
+            std::filesystem::remove(file_path);
+        }
+        BOOST_SCOPE_EXIT_END;
+
+        const boost::interprocess::file_mapping file_mapping{ file_path.c_str(), boost::interprocess::read_only };
+        const auto file_size = static_cast<std::size_t>(std::filesystem::file_size(file_path));
+
+        const tetengo::lattice::mapped_vocabulary vocabulary{ file_mapping, 0, file_size };
+
+        const auto entries_mizuho = vocabulary.find_entries(tetengo::lattice::string_input{ key_mizuho });
+        BOOST_TEST_REQUIRE(std::size(entries_mizuho) == 1U);
+        const auto entries_sakura = vocabulary.find_entries(tetengo::lattice::string_input{ key_sakura });
+        BOOST_TEST_REQUIRE(std::size(entries_sakura) == 2U);
+
+        {
+            const auto connection = vocabulary.find_connection(
+                make_node(tetengo::lattice::entry_view::bos_eos()), entries_mizuho[0]);
+
+            BOOST_TEST(connection.cost() == 100);
+        }
+        {
+            const auto connection = vocabulary.find_connection(make_node(entries_mizuho[0]), entries_sakura[0]);
+
+            BOOST_TEST(connection.cost() == 4242);
+        }
+        {
+            const auto connection =
+                vocabulary.find_connection(make_node(entries_sakura[1]), tetengo::lattice::entry_view::bos_eos());
+
+            BOOST_TEST(connection.cost() == 200);
+        }
+        {
+            const auto connection = vocabulary.find_connection(make_node(entries_mizuho[0]), entries_sakura[1]);
+
+            BOOST_TEST(connection.cost() == std::numeric_limits<int>::max());
+        }
+        {
+            const auto connection = vocabulary.find_connection(make_node(entries_mizuho[0]), entries_mizuho[0]);
+
+            BOOST_TEST(connection.cost() == std::numeric_limits<int>::max());
+        }
+        {
+            const tetengo::lattice::entry to{ std::make_unique<tetengo::lattice::string_input>(key_sakura),
+                                              std::string_view{ surface_sakura1 },
+                                              24 };
+
+            const auto connection = vocabulary.find_connection(make_node(entries_mizuho[0]), to);
+
+            BOOST_TEST(connection.cost() == 4242);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(find_connections)
+{
+    BOOST_TEST_PASSPOINT();
+
+    {
+        const auto file_path = temporary_file_path();
+        BOOST_SCOPE_EXIT(&file_path)
+        {
+            std::filesystem::remove(file_path);
+        }
+        BOOST_SCOPE_EXIT_END;
+
+        const boost::interprocess::file_mapping file_mapping{ file_path.c_str(), boost::interprocess::read_only };
+        const auto file_size = static_cast<std::size_t>(std::filesystem::file_size(file_path));
+
+        const tetengo::lattice::mapped_vocabulary vocabulary{ file_mapping, 0, file_size };
+
+        const auto entries_mizuho = vocabulary.find_entries(tetengo::lattice::string_input{ key_mizuho });
+        BOOST_TEST_REQUIRE(std::size(entries_mizuho) == 1U);
+        const auto entries_sakura = vocabulary.find_entries(tetengo::lattice::string_input{ key_sakura });
+        BOOST_TEST_REQUIRE(std::size(entries_sakura) == 2U);
+        const std::vector<tetengo::lattice::node> from{ make_node(tetengo::lattice::entry_view::bos_eos()),
+                                                        make_node(entries_mizuho[0]),
+                                                        make_node(entries_sakura[1]) };
+
+        {
+            std::vector<int> costs(std::size(from), 0);
+            vocabulary.find_connections(from, entries_sakura[0], costs);
+
+            BOOST_TEST(costs[0] == std::numeric_limits<int>::max());
+            BOOST_TEST(costs[1] == 4242);
+            BOOST_TEST(costs[2] == std::numeric_limits<int>::max());
+        }
+        {
+            std::vector<int> costs(std::size(from), 0);
+            vocabulary.find_connections(from, tetengo::lattice::entry_view::bos_eos(), costs);
+
+            BOOST_TEST(costs[0] == std::numeric_limits<int>::max());
+            BOOST_TEST(costs[1] == std::numeric_limits<int>::max());
+            BOOST_TEST(costs[2] == 200);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(find_entry_connections)
+{
+    BOOST_TEST_PASSPOINT();
+
+    {
+        const auto file_path = temporary_file_path();
+        BOOST_SCOPE_EXIT(&file_path)
+        {
+            std::filesystem::remove(file_path);
+        }
+        BOOST_SCOPE_EXIT_END;
+
+        const boost::interprocess::file_mapping file_mapping{ file_path.c_str(), boost::interprocess::read_only };
+        const auto file_size = static_cast<std::size_t>(std::filesystem::file_size(file_path));
+
+        const tetengo::lattice::mapped_vocabulary vocabulary{ file_mapping, 0, file_size };
+
+        const auto entries_mizuho = vocabulary.find_entries(tetengo::lattice::string_input{ key_mizuho });
+        BOOST_TEST_REQUIRE(std::size(entries_mizuho) == 1U);
+        const auto entries_sakura = vocabulary.find_entries(tetengo::lattice::string_input{ key_sakura });
+        BOOST_TEST_REQUIRE(std::size(entries_sakura) == 2U);
+        const std::vector<tetengo::lattice::entry_view> from{ tetengo::lattice::entry_view::bos_eos(),
+                                                              entries_mizuho[0],
+                                                              entries_sakura[1] };
+
+        {
+            std::vector<int> costs(std::size(from), 0);
+            const auto       result = vocabulary.find_entry_connections(from, entries_sakura[0], costs);
+
+            BOOST_TEST_REQUIRE(result);
+            BOOST_TEST(costs[0] == std::numeric_limits<int>::max());
+            BOOST_TEST(costs[1] == 4242);
+            BOOST_TEST(costs[2] == std::numeric_limits<int>::max());
+        }
+    }
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
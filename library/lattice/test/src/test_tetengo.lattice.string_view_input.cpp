@@ -0,0 +1,331 @@
+/*! \file
+    \brief A string view input.
+
+    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
+*/
+
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include <boost/operators.hpp>
+#include <boost/preprocessor.hpp>
+#include <boost/scope_exit.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <tetengo/lattice/input.h>
+#include <tetengo/lattice/input.hpp>
+#include <tetengo/lattice/string_input.hpp>
+#include <tetengo/lattice/string_view_input.hpp>
+
+
+BOOST_AUTO_TEST_SUITE(test_tetengo)
+BOOST_AUTO_TEST_SUITE(lattice)
+BOOST_AUTO_TEST_SUITE(string_view_input)
+
+
+BOOST_AUTO_TEST_CASE(construction)
+{
+    BOOST_TEST_PASSPOINT();
+
+    {
+        const tetengo::lattice::string_view_input input{ "hoge" };
+    }
+    {
+        const auto                                p_buffer = std::make_shared<std::string>("hogefuga");
+        const tetengo::lattice::string_view_input input{ p_buffer, 2, 4 };
+    }
+    {
+        BOOST_CHECK_THROW(const tetengo::lattice::string_view_input input(nullptr, 0, 0), std::invalid_argument);
+    }
+    {
+        const auto p_buffer = std::make_shared<std::string>("hogefuga");
+        BOOST_CHECK_THROW(const tetengo::lattice::string_view_input input(p_buffer, 6, 3), std::out_of_range);
+    }
+
+    {
+        const auto* const p_input = tetengo_lattice_input_createStringViewInput("hoge");
+        BOOST_SCOPE_EXIT(p_input)
+        {
+            tetengo_lattice_input_destroy(p_input);
+        }
+        BOOST_SCOPE_EXIT_END;
+        BOOST_TEST(p_input);
+    }
+    {
+        const auto* const p_input = tetengo_lattice_input_createStringViewInput(nullptr);
+        BOOST_TEST(!p_input);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(value)
+{
+    BOOST_TEST_PASSPOINT();
+
+    {
+        const tetengo::lattice::string_view_input input{ "hoge" };
+
+        BOOST_TEST(input.value() == "hoge");
+    }
+    {
+        const auto                                p_buffer = std::make_shared<std::string>("hogefuga");
+        const tetengo::lattice::string_view_input input{ p_buffer, 2, 4 };
+
+        BOOST_TEST(input.value() == "gefu");
+        BOOST_TEST(std::data(input.value()) == std::data(*p_buffer) + 2);
+    }
+
+    {
+        const auto* const p_input = tetengo_lattice_input_createStringViewInput("hoge");
+        BOOST_SCOPE_EXIT(p_input)
+        {
+            tetengo_lattice_input_destroy(p_input);
+        }
+        BOOST_SCOPE_EXIT_END;
+        BOOST_TEST_REQUIRE(p_input);
+
+        auto              length = static_cast<size_t>(0);
+        const auto* const value = tetengo_lattice_stringViewInput_value(p_input, &length);
+        BOOST_TEST_REQUIRE(value);
+        BOOST_TEST((std::string_view{ value, length } == "hoge"));
+    }
+    {
+        const auto* const p_input = tetengo_lattice_input_createStringInput("hoge");
+        BOOST_SCOPE_EXIT(p_input)
+        {
+            tetengo_lattice_input_destroy(p_input);
+        }
+        BOOST_SCOPE_EXIT_END;
+        BOOST_TEST_REQUIRE(p_input);
+
+        auto length = static_cast<size_t>(0);
+        BOOST_TEST(!tetengo_lattice_stringViewInput_value(p_input, &length));
+    }
+    {
+        const auto* const p_input = tetengo_lattice_input_createStringViewInput("hoge");
+        BOOST_SCOPE_EXIT(p_input)
+        {
+            tetengo_lattice_input_destroy(p_input);
+        }
+        BOOST_SCOPE_EXIT_END;
+        BOOST_TEST_REQUIRE(p_input);
+
+        BOOST_TEST(!tetengo_lattice_stringViewInput_value(p_input, nullptr));
+    }
+    {
+        auto length = static_cast<size_t>(0);
+        BOOST_TEST(!tetengo_lattice_stringViewInput_value(nullptr, &length));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(operator_equal)
+{
+    BOOST_TEST_PASSPOINT();
+
+    {
+        const tetengo::lattice::string_view_input input1{ "hoge" };
+        const tetengo::lattice::string_view_input input2{ std::make_shared<std::string>("fugahoge"), 4, 4 };
+
+        BOOST_CHECK(input1 == input2);
+        BOOST_CHECK(input2 == input1);
+    }
+    {
+        const tetengo::lattice::string_view_input input1{ "hoge" };
+        const tetengo::lattice::string_view_input input2{ "fuga" };
+
+        BOOST_CHECK(input1 != input2);
+        BOOST_CHECK(input2 != input1);
+    }
+    {
+        const tetengo::lattice::string_view_input input1{ "hoge" };
+        const tetengo::lattice::string_input      input2{ "hoge" };
+
+        BOOST_CHECK(input1 != input2);
+        BOOST_CHECK(input2 != input1);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(hash_value)
+{
+    BOOST_TEST_PASSPOINT();
+
+    {
+        const tetengo::lattice::string_view_input input1{ "hoge" };
+        const tetengo::lattice::string_view_input input2{ std::make_shared<std::string>("fugahoge"), 4, 4 };
+
+        BOOST_TEST(input1.hash_value() == input2.hash_value());
+    }
+    {
+        const tetengo::lattice::string_view_input input1{ "hoge" };
+        const tetengo::lattice::string_view_input input2{ "fuga" };
+
+        BOOST_TEST(input1.hash_value() != input2.hash_value());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(length)
+{
+    BOOST_TEST_PASSPOINT();
+
+    {
+        const tetengo::lattice::string_view_input input{ "hoge" };
+
+        BOOST_TEST(input.length() == 4U);
+    }
+    {
+        const tetengo::lattice::string_view_input input{ std::make_shared<std::string>("hogefuga"), 2, 3 };
+
+        BOOST_TEST(input.length() == 3U);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(clone)
+{
+    BOOST_TEST_PASSPOINT();
+
+    {
+        const tetengo::lattice::string_view_input input{ "hoge" };
+
+        const auto p_clone = input.clone();
+        BOOST_REQUIRE(p_clone);
+        BOOST_TEST_REQUIRE(p_clone->is<tetengo::lattice::string_view_input>());
+        BOOST_TEST(p_clone->as<tetengo::lattice::string_view_input>().value() == "hoge");
+    }
+}
+
+BOOST_AUTO_TEST_CASE(create_subrange)
+{
+    BOOST_TEST_PASSPOINT();
+
+    {
+        const tetengo::lattice::string_view_input input{ "hoge" };
+
+        const auto p_subrange = input.create_subrange(0, 4);
+        BOOST_REQUIRE(p_subrange);
+        BOOST_TEST_REQUIRE(p_subrange->is<tetengo::lattice::string_view_input>());
+        BOOST_TEST(p_subrange->as<tetengo::lattice::string_view_input>().value() == "hoge");
+    }
+    {
+        const tetengo::lattice::string_view_input input{ "hoge" };
+
+        const auto p_subrange = input.create_subrange(1, 2);
+        BOOST_REQUIRE(p_subrange);
+        BOOST_TEST_REQUIRE(p_subrange->is<tetengo::lattice::string_view_input>());
+        const auto& subrange = p_subrange->as<tetengo::lattice::string_view_input>();
+        BOOST_TEST(subrange.value() == "og");
+        BOOST_TEST(std::data(subrange.value()) == std::data(input.value()) + 1);
+    }
+    {
+        const tetengo::lattice::string_view_input input{ std::make_shared<std::string>("hogefuga"), 2, 4 };
+
+        const auto p_subrange = input.create_subrange(1, 3);
+        BOOST_REQUIRE(p_subrange);
+        BOOST_TEST(p_subrange->as<tetengo::lattice::string_view_input>().value() == "efu");
+    }
+    {
+        const tetengo::lattice::string_view_input input{ "hoge" };
+
+        const auto p_subrange = input.create_subrange(4, 0);
+        BOOST_REQUIRE(p_subrange);
+        BOOST_TEST(p_subrange->as<tetengo::lattice::string_view_input>().value() == "");
+    }
+    {
+        const tetengo::lattice::string_view_input input{ std::make_shared<std::string>("hogefuga"), 2, 4 };
+
+        BOOST_CHECK_THROW(const auto p_subrange = input.create_subrange(0, 5), std::out_of_range);
+    }
+    {
+        const tetengo::lattice::string_view_input input{ "hoge" };
+
+        BOOST_CHECK_THROW(const auto p_subrange = input.create_subrange(5, 0), std::out_of_range);
+    }
+
+    {
+        const auto* const p_input = tetengo_lattice_input_createStringViewInput("hoge");
+        BOOST_SCOPE_EXIT(p_input)
+        {
+            tetengo_lattice_input_destroy(p_input);
+        }
+        BOOST_SCOPE_EXIT_END;
+        BOOST_TEST_REQUIRE(p_input);
+
+        const auto* const p_subrange = tetengo_lattice_input_createSubrange(p_input, 1, 2);
+        BOOST_SCOPE_EXIT(p_subrange)
+        {
+            tetengo_lattice_input_destroy(p_subrange);
+        }
+        BOOST_SCOPE_EXIT_END;
+        BOOST_TEST_REQUIRE(p_subrange);
+        auto              length = static_cast<size_t>(0);
+        const auto* const value = tetengo_lattice_stringViewInput_value(p_subrange, &length);
+        BOOST_TEST_REQUIRE(value);
+        BOOST_TEST((std::string_view{ value, length } == "og"));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(append)
+{
+    BOOST_TEST_PASSPOINT();
+
+    {
+        tetengo::lattice::string_view_input input{ "hoge" };
+
+        input.append(std::make_unique<tetengo::lattice::string_view_input>("fuga"));
+
+        BOOST_TEST(input.value() == "hogefuga");
+    }
+    {
+        tetengo::lattice::string_view_input input{ "hoge" };
+        const auto                          p_subrange = input.create_subrange(1, 2);
+
+        input.append(std::make_unique<tetengo::lattice::string_view_input>("fuga"));
+        input.append(input.create_subrange(0, 2));
+
+        BOOST_TEST(input.value() == "hogefugaho");
+        BOOST_TEST(p_subrange->as<tetengo::lattice::string_view_input>().value() == "og");
+    }
+    {
+        tetengo::lattice::string_view_input input{ "hoge" };
+        auto                                p_subrange = input.create_subrange(1, 2);
+
+        input.append(std::make_unique<tetengo::lattice::string_view_input>("fuga"));
+        p_subrange->append(std::make_unique<tetengo::lattice::string_view_input>("piyo"));
+
+        BOOST_TEST(input.value() == "hogefuga");
+        BOOST_TEST(p_subrange->as<tetengo::lattice::string_view_input>().value() == "ogpiyo");
+    }
+    {
+        tetengo::lattice::string_view_input input{ "hoge" };
+
+        BOOST_CHECK_THROW(input.append(nullptr), std::invalid_argument);
+        BOOST_CHECK_THROW(
+            input.append(std::make_unique<tetengo::lattice::string_input>("fuga")), std::invalid_argument);
+    }
+
+    {
+        auto* const p_input = tetengo_lattice_input_createStringViewInput("hoge");
+        BOOST_SCOPE_EXIT(p_input)
+        {
+            tetengo_lattice_input_destroy(p_input);
+        }
+        BOOST_SCOPE_EXIT_END;
+        BOOST_TEST_REQUIRE(p_input);
+
+        auto* const p_another = tetengo_lattice_input_createStringViewInput("fuga");
+        BOOST_TEST_REQUIRE(p_another);
+        const auto result = tetengo_lattice_input_append(p_input, p_another);
+        BOOST_TEST_REQUIRE(result);
+
+        auto              length = static_cast<size_t>(0);
+        const auto* const value = tetengo_lattice_stringViewInput_value(p_input, &length);
+        BOOST_TEST_REQUIRE(value);
+        BOOST_TEST((std::string_view{ value, length } == "hogefuga"));
+    }
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
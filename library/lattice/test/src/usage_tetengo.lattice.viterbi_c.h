@@ -1,24 +1,24 @@
-/*! \file
-    \brief The usage of Viterbi search.
-
-    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
-*/
-
-
-#if !defined(USAGETETENGO_LATTICE_VITERBI_C_H)
-#define USAGETETENGO_LATTICE_VITERBI_C_H
-
-
-#if defined(__cplusplus)
-extern "C" {
-#endif
-
-void usage_tetengo_lattice_viterbi();
-
-
-#if defined(__cplusplus)
-}
-#endif
-
-
-#endif
+/*! \file
+    \brief The usage of Viterbi search.
+
+    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
+*/
+
+
+#if !defined(USAGETETENGO_LATTICE_VITERBI_C_H)
+#define USAGETETENGO_LATTICE_VITERBI_C_H
+
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+void usage_tetengo_lattice_viterbi();
+
+
+#if defined(__cplusplus)
+}
+#endif
+
+
+#endif
@@ -1,20 +1,20 @@
-/*! \file
-    \brief The usage of Viterbi search.
-
-    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
-*/
-
-
-#if !defined(USAGETETENGO_LATTICE_VITERBI_CPP_HPP)
-#define USAGETETENGO_LATTICE_VITERBI_CPP_HPP
-
-
-namespace usage_tetengo::lattice
-{
-    void viterbi();
-
-
-}
-
-
-#endif
+/*! \file
+    \brief The usage of Viterbi search.
+
+    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
+*/
+
+
+#if !defined(USAGETETENGO_LATTICE_VITERBI_CPP_HPP)
+#define USAGETETENGO_LATTICE_VITERBI_CPP_HPP
+
+
+namespace usage_tetengo::lattice
+{
+    void viterbi();
+
+
+}
+
+
+#endif
@@ -1,24 +1,24 @@
-/*! \file
-    \brief The usage of property saving and loading.
-
-    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
-*/
-
-
-#if !defined(USAGETETENGO_PROPERTY_SAVELOAD_C_H)
-#define USAGETETENGO_PROPERTY_SAVELOAD_C_H
-
-
-#if defined(__cplusplus)
-extern "C" {
-#endif
-
-void usage_tetengo_property_saveLoad();
-
-
-#if defined(__cplusplus)
-}
-#endif
-
-
-#endif
+/*! \file
+    \brief The usage of property saving and loading.
+
+    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
+*/
+
+
+#if !defined(USAGETETENGO_PROPERTY_SAVELOAD_C_H)
+#define USAGETETENGO_PROPERTY_SAVELOAD_C_H
+
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+void usage_tetengo_property_saveLoad();
+
+
+#if defined(__cplusplus)
+}
+#endif
+
+
+#endif
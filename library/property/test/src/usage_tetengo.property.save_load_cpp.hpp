@@ -1,20 +1,20 @@
-/*! \file
-    \brief The usage of property saving and loading.
-
-    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
-*/
-
-
-#if !defined(USAGETETENGO_PROPERTY_SAVELOAD_CPP_HPP)
-#define USAGETETENGO_PROPERTY_SAVELOAD_CPP_HPP
-
-
-namespace usage_tetengo::property
-{
-    void save_load();
-
-
-}
-
-
-#endif
+/*! \file
+    \brief The usage of property saving and loading.
+
+    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
+*/
+
+
+#if !defined(USAGETETENGO_PROPERTY_SAVELOAD_CPP_HPP)
+#define USAGETETENGO_PROPERTY_SAVELOAD_CPP_HPP
+
+
+namespace usage_tetengo::property
+{
+    void save_load();
+
+
+}
+
+
+#endif
@@ -1,15 +1,15 @@
-/*! \file
-    \brief An encoder.
-
-    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
-*/
-
-#include <tetengo/text/encoder.hpp>
-
-
-namespace tetengo::text
-{
-    encoder_base::~encoder_base() = default;
-
-
-}
+/*! \file
+    \brief An encoder.
+
+    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
+*/
+
+#include <tetengo/text/encoder.hpp>
+
+
+namespace tetengo::text
+{
+    encoder_base::~encoder_base() = default;
+
+
+}
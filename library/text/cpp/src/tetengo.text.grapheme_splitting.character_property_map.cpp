@@ -1,2476 +1,2476 @@
-/*! \file
-    \brief A character property map.
-
-    This file is generated by tool/make_character_property_map_cpp.py.
-
-    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
-*/
-
-#include <cstddef>
-
-#include "tetengo.text.grapheme_splitting.character_property_map.hpp"
-
-
-namespace tetengo::text::grapheme_splitting
-{
-    const std::size_t character_property_map_size = 2452;
-
-    // clang-format off
-    const character_property_map_element_type character_property_map[] = {
-        { 0x0000, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::control },
-        { 0x000A, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::lf },
-        { 0x000B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::control },
-        { 0x000D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::cr },
-        { 0x000E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::control },
-        { 0x0020, east_asian_width_class_type::narrow, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0023, east_asian_width_class_type::narrow, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x0024, east_asian_width_class_type::narrow, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x002A, east_asian_width_class_type::narrow, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x002B, east_asian_width_class_type::narrow, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0030, east_asian_width_class_type::narrow, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x003A, east_asian_width_class_type::narrow, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x007F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::control },
-        { 0x00A0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x00A1, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x00A2, east_asian_width_class_type::narrow, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x00A4, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x00A5, east_asian_width_class_type::narrow, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x00A7, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x00A9, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x00AA, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x00AB, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x00AC, east_asian_width_class_type::narrow, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x00AD, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::control },
-        { 0x00AE, east_asian_width_class_type::ambiguous, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x00AF, east_asian_width_class_type::narrow, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x00B0, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x00B5, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x00B6, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x00BB, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x00BC, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x00C0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x00C6, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x00C7, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x00D0, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x00D1, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x00D7, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x00D9, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x00DE, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x00E2, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x00E6, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x00E7, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x00E8, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x00EB, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x00EC, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x00EE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x00F0, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x00F1, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x00F2, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x00F4, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x00F7, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x00FB, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x00FC, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x00FD, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x00FE, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x00FF, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0101, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0102, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0111, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0112, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0113, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0114, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x011B, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x011C, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0126, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0128, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x012B, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x012C, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0131, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0134, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0138, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0139, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x013F, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0143, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0144, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0145, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0148, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x014C, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x014D, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x014E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0152, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0154, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0166, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0168, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x016B, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x016C, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x01CE, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x01CF, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x01D0, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x01D1, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x01D2, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x01D3, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x01D4, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x01D5, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x01D6, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x01D7, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x01D8, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x01D9, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x01DA, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x01DB, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x01DC, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x01DD, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0251, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0252, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0261, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0262, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x02C4, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x02C5, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x02C7, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x02C8, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x02C9, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x02CC, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x02CD, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x02CE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x02D0, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x02D1, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x02D8, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x02DC, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x02DD, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x02DE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x02DF, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x02E0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0300, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0370, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0391, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x03A2, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x03A3, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x03AA, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x03B1, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x03C2, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x03C3, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x03CA, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0401, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0402, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0410, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0450, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0451, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0452, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0483, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x048A, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0591, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x05BE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x05BF, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x05C0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x05C1, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x05C3, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x05C4, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x05C6, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x05C7, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x05C8, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0600, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::prepend },
-        { 0x0606, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0610, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x061B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x061C, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::control },
-        { 0x061D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x064B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0660, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0670, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0671, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x06D6, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x06DD, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::prepend },
-        { 0x06DE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x06DF, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x06E5, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x06E7, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x06E9, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x06EA, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x06EE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x070F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::prepend },
-        { 0x0710, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0711, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0712, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0730, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x074B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x07A6, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x07B1, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x07EB, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x07F4, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x07FD, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x07FE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0816, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x081A, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x081B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0824, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0825, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0828, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0829, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x082E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0859, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x085C, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0890, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::prepend },
-        { 0x0892, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0898, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x08A0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x08CA, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x08E2, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::prepend },
-        { 0x08E3, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0903, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x0904, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x093A, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x093B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x093C, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x093D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x093E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x0941, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0949, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x094D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x094E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x0950, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0951, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0958, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0962, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0964, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0981, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0982, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x0984, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x09BC, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x09BD, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x09BE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x09BF, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x09C1, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x09C5, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x09C7, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x09C9, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x09CB, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x09CD, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x09CE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x09D7, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x09D8, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x09E2, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x09E4, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x09FE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x09FF, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0A01, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0A03, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x0A04, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0A3C, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0A3D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0A3E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x0A41, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0A43, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0A47, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0A49, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0A4B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0A4E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0A51, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0A52, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0A70, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0A72, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0A75, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0A76, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0A81, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0A83, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x0A84, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0ABC, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0ABD, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0ABE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x0AC1, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0AC6, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0AC7, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0AC9, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x0ACA, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0ACB, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x0ACD, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0ACE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0AE2, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0AE4, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0AFA, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0B00, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0B01, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0B02, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x0B04, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0B3C, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0B3D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0B3E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0B40, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x0B41, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0B45, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0B47, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x0B49, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0B4B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x0B4D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0B4E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0B55, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0B58, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0B62, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0B64, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0B82, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0B83, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0BBE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0BBF, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x0BC0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0BC1, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x0BC3, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0BC6, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x0BC9, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0BCA, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x0BCD, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0BCE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0BD7, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0BD8, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0C00, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0C01, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x0C04, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0C05, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0C3C, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0C3D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0C3E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0C41, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x0C45, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0C46, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0C49, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0C4A, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0C4E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0C55, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0C57, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0C62, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0C64, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0C81, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0C82, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x0C84, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0CBC, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0CBD, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0CBE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x0CBF, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0CC0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x0CC2, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0CC3, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x0CC5, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0CC6, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0CC7, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x0CC9, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0CCA, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x0CCC, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0CCE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0CD5, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0CD7, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0CE2, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0CE4, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0D00, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0D02, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x0D04, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0D3B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0D3D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0D3E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0D3F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x0D41, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0D45, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0D46, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x0D49, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0D4A, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x0D4D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0D4E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::prepend },
-        { 0x0D4F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0D57, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0D58, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0D62, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0D64, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0D81, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0D82, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x0D84, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0DCA, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0DCB, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0DCF, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0DD0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x0DD2, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0DD5, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0DD6, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0DD7, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0DD8, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x0DDF, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0DE0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0DF2, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x0DF4, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0E31, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0E32, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0E33, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x0E34, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0E3B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0E47, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0E4F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0EB1, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0EB2, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0EB3, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x0EB4, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0EBD, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0EC8, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0ECE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0F18, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0F1A, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0F35, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0F36, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0F37, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0F38, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0F39, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0F3A, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0F3E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x0F40, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0F71, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0F7F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x0F80, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0F85, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0F86, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0F88, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0F8D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0F98, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0F99, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0FBD, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x0FC6, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x0FC7, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x102D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1031, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x1032, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1038, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1039, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x103B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x103D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x103F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1056, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x1058, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x105A, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x105E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1061, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1071, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1075, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1082, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1083, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1084, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x1085, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1087, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x108D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x108E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x109D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x109E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1100, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::l },
-        { 0x1160, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::v },
-        { 0x11A8, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::t },
-        { 0x1200, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x135D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1360, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1712, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1715, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x1716, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1732, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1734, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x1735, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1752, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1754, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1772, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1774, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x17B4, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x17B6, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x17B7, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x17BE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x17C6, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x17C7, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x17C9, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x17D4, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x17DD, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x17DE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x180B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x180E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::control },
-        { 0x180F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1810, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1885, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1887, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x18A9, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x18AA, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1920, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1923, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x1927, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1929, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x192C, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1930, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x1932, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1933, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x1939, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x193C, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1A17, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1A19, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x1A1B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1A1C, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1A55, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x1A56, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1A57, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x1A58, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1A5F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1A60, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1A61, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1A62, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1A63, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1A65, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1A6D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x1A73, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1A7D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1A7F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1A80, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1AB0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1ACF, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1B00, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1B04, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x1B05, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1B34, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1B3B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x1B3C, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1B3D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x1B42, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1B43, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x1B45, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1B6B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1B74, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1B80, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1B82, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x1B83, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1BA1, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x1BA2, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1BA6, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x1BA8, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1BAA, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x1BAB, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1BAE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1BE6, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1BE7, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x1BE8, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1BEA, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x1BED, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1BEE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x1BEF, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1BF2, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x1BF4, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1C24, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x1C2C, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1C34, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x1C36, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1C38, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1CD0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1CD3, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1CD4, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1CE1, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x1CE2, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1CE9, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1CED, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1CEE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1CF4, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1CF5, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1CF7, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x1CF8, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1CFA, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1DC0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1E00, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x200B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::control },
-        { 0x200C, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x200D, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::zwj },
-        { 0x200E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::control },
-        { 0x2010, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2011, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2013, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2017, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2018, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x201A, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x201C, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x201E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2020, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2023, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2024, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2028, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::control },
-        { 0x202F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2030, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2031, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2032, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2034, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2035, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2036, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x203B, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x203C, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x203D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x203E, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x203F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2049, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x204A, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2060, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::control },
-        { 0x2070, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2074, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2075, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x207F, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2080, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2081, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2085, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x20A9, east_asian_width_class_type::halfwidth, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x20AA, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x20AC, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x20AD, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x20D0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x20E3, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::extend },
-        { 0x20E4, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x20F1, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2103, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2104, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2105, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2106, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2109, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x210A, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2113, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2114, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2116, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2117, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2121, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2122, east_asian_width_class_type::ambiguous, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x2123, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2126, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2127, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x212B, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x212C, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2139, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x213A, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2153, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2155, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x215B, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x215F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2160, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x216C, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2170, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x217A, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2189, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x218A, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2190, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2194, east_asian_width_class_type::ambiguous, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x219A, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x21A9, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x21AB, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x21B8, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x21BA, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x21D2, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x21D3, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x21D4, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x21D5, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x21E7, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x21E8, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2200, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2201, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2202, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2204, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2207, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2209, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x220B, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x220C, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x220F, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2210, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2211, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2212, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2215, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2216, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x221A, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x221B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x221D, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2221, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2223, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2224, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2225, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2226, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2227, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x222D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x222E, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x222F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2234, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2238, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x223C, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x223E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2248, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2249, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x224C, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x224D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2252, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2253, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2260, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2262, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2264, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2268, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x226A, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x226C, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x226E, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2270, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2282, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2284, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2286, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2288, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2295, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2296, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2299, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x229A, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x22A5, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x22A6, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x22BF, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x22C0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2312, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2313, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x231A, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x231C, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2328, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x2329, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x232B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2388, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2389, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x23CF, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x23D0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x23E9, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x23ED, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x23F0, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x23F1, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x23F3, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x23F4, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x23F8, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x23FB, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2460, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x24C2, east_asian_width_class_type::ambiguous, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x24C3, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x24EA, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x24EB, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x254C, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2550, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2574, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2580, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2590, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2592, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2596, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x25A0, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x25A2, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x25A3, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x25AA, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x25AC, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x25B2, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x25B4, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x25B6, east_asian_width_class_type::ambiguous, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x25B7, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x25B8, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x25BC, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x25BE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x25C0, east_asian_width_class_type::ambiguous, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x25C1, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x25C2, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x25C6, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x25C9, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x25CB, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x25CC, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x25CE, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x25D2, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x25E2, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x25E6, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x25EF, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x25F0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x25FB, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x25FD, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x25FF, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2600, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x2605, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2606, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2607, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2609, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x260A, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x260E, east_asian_width_class_type::ambiguous, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x260F, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2610, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2611, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x2612, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2613, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2614, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x2616, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2618, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x2619, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x261C, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x261D, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x261E, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x261F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2620, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x2621, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2622, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x2624, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2626, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x2627, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x262A, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x262B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x262E, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x2630, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2638, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x263B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2640, east_asian_width_class_type::ambiguous, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x2641, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2642, east_asian_width_class_type::ambiguous, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x2643, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2648, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x2654, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x265F, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x2660, east_asian_width_class_type::ambiguous, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x2661, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2662, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2663, east_asian_width_class_type::ambiguous, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x2664, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2665, east_asian_width_class_type::ambiguous, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x2666, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x2667, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2668, east_asian_width_class_type::ambiguous, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x2669, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x266B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x266C, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x266E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x266F, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2670, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x267B, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x267C, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x267E, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x267F, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x2680, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2686, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2690, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2692, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x2693, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x2694, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x2698, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2699, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x269A, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x269B, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x269D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x269E, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x26A0, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x26A1, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x26A2, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x26A7, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x26A8, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x26AA, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x26AC, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x26B0, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x26B2, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x26BD, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x26BF, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x26C0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x26C4, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x26C6, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x26C8, east_asian_width_class_type::ambiguous, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x26C9, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x26CE, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x26CF, east_asian_width_class_type::ambiguous, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x26D0, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x26D1, east_asian_width_class_type::ambiguous, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x26D2, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x26D3, east_asian_width_class_type::ambiguous, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x26D4, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x26D5, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x26E2, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x26E3, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x26E4, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x26E8, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x26E9, east_asian_width_class_type::ambiguous, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x26EA, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x26EB, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x26F0, east_asian_width_class_type::ambiguous, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x26F2, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x26F4, east_asian_width_class_type::ambiguous, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x26F5, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x26F6, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x26F7, east_asian_width_class_type::ambiguous, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x26FA, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x26FB, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x26FD, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x26FE, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2700, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2702, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x2703, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2705, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x2706, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2708, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x270A, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x270C, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x270E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x270F, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x2710, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2712, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x2713, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2714, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x2715, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2716, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x2717, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x271D, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x271E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2721, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x2722, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2728, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x2729, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2733, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x2735, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x273D, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x273E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2744, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x2745, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2747, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x2748, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x274C, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x274D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x274E, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x274F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2753, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x2756, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2757, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x2758, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2763, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x2765, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2768, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2776, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2780, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2795, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x2798, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x27A1, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x27A2, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x27B0, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x27B1, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x27BF, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x27C0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x27E6, east_asian_width_class_type::narrow, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x27EE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2934, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x2936, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2985, east_asian_width_class_type::narrow, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2987, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2B05, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x2B08, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2B1B, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x2B1D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2B50, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x2B51, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2B55, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x2B56, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2B5A, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2CEF, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x2CF2, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2D7F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x2D80, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2DE0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x2E00, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2E80, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2E9A, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2E9B, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2EF4, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2F00, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2FD6, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2FF0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2FFC, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x3000, east_asian_width_class_type::fullwidth, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x3001, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x302A, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x3030, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x3031, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x303D, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x303E, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x303F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x3041, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x3097, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x3099, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x309B, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x3100, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x3105, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x3130, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x3131, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x318F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x3190, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x31E4, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x31F0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x321F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x3220, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x3248, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x3250, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x3297, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x3298, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x3299, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x329A, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x4DC0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x4E00, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
-        { 0xA48D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0xA490, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
-        { 0xA4C7, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0xA66F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0xA673, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0xA674, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0xA67E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0xA69E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0xA6A0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0xA6F0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0xA6F2, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0xA802, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0xA803, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0xA806, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0xA807, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0xA80B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0xA80C, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0xA823, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0xA825, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0xA827, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0xA828, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0xA82C, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0xA82D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0xA880, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0xA882, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0xA8B4, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0xA8C4, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0xA8C6, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0xA8E0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0xA8F2, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0xA8FF, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0xA900, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0xA926, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0xA92E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0xA947, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0xA952, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0xA954, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0xA960, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::l },
-        { 0xA97D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0xA980, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0xA983, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0xA984, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0xA9B3, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0xA9B4, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0xA9B6, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0xA9BA, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0xA9BC, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0xA9BE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0xA9C1, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0xA9E5, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0xA9E6, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0xAA29, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0xAA2F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0xAA31, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0xAA33, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0xAA35, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0xAA37, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0xAA43, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0xAA44, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0xAA4C, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0xAA4D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0xAA4E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0xAA7C, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0xAA7D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0xAAB0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0xAAB1, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0xAAB2, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0xAAB5, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0xAAB7, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0xAAB9, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0xAABE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0xAAC0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0xAAC1, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0xAAC2, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0xAAEB, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0xAAEC, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0xAAEE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0xAAF0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0xAAF5, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0xAAF6, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0xAAF7, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0xABE3, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0xABE5, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0xABE6, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0xABE8, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0xABE9, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0xABEB, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0xABEC, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0xABED, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0xABEE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0xAC00, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xAC01, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xAC1C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xAC1D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xAC38, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xAC39, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xAC54, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xAC55, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xAC70, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xAC71, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xAC8C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xAC8D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xACA8, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xACA9, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xACC4, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xACC5, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xACE0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xACE1, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xACFC, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xACFD, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xAD18, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xAD19, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xAD34, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xAD35, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xAD50, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xAD51, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xAD6C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xAD6D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xAD88, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xAD89, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xADA4, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xADA5, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xADC0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xADC1, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xADDC, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xADDD, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xADF8, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xADF9, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xAE14, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xAE15, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xAE30, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xAE31, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xAE4C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xAE4D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xAE68, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xAE69, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xAE84, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xAE85, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xAEA0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xAEA1, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xAEBC, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xAEBD, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xAED8, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xAED9, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xAEF4, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xAEF5, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xAF10, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xAF11, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xAF2C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xAF2D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xAF48, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xAF49, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xAF64, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xAF65, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xAF80, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xAF81, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xAF9C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xAF9D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xAFB8, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xAFB9, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xAFD4, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xAFD5, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xAFF0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xAFF1, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB00C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB00D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB028, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB029, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB044, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB045, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB060, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB061, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB07C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB07D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB098, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB099, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB0B4, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB0B5, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB0D0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB0D1, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB0EC, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB0ED, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB108, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB109, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB124, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB125, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB140, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB141, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB15C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB15D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB178, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB179, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB194, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB195, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB1B0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB1B1, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB1CC, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB1CD, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB1E8, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB1E9, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB204, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB205, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB220, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB221, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB23C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB23D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB258, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB259, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB274, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB275, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB290, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB291, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB2AC, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB2AD, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB2C8, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB2C9, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB2E4, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB2E5, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB300, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB301, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB31C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB31D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB338, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB339, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB354, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB355, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB370, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB371, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB38C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB38D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB3A8, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB3A9, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB3C4, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB3C5, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB3E0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB3E1, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB3FC, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB3FD, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB418, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB419, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB434, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB435, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB450, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB451, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB46C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB46D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB488, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB489, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB4A4, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB4A5, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB4C0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB4C1, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB4DC, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB4DD, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB4F8, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB4F9, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB514, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB515, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB530, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB531, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB54C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB54D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB568, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB569, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB584, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB585, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB5A0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB5A1, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB5BC, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB5BD, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB5D8, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB5D9, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB5F4, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB5F5, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB610, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB611, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB62C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB62D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB648, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB649, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB664, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB665, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB680, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB681, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB69C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB69D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB6B8, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB6B9, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB6D4, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB6D5, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB6F0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB6F1, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB70C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB70D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB728, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB729, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB744, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB745, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB760, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB761, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB77C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB77D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB798, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB799, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB7B4, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB7B5, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB7D0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB7D1, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB7EC, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB7ED, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB808, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB809, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB824, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB825, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB840, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB841, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB85C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB85D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB878, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB879, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB894, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB895, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB8B0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB8B1, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB8CC, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB8CD, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB8E8, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB8E9, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB904, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB905, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB920, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB921, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB93C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB93D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB958, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB959, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB974, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB975, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB990, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB991, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB9AC, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB9AD, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB9C8, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB9C9, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xB9E4, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xB9E5, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xBA00, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xBA01, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xBA1C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xBA1D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xBA38, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xBA39, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xBA54, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xBA55, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xBA70, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xBA71, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xBA8C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xBA8D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xBAA8, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xBAA9, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xBAC4, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xBAC5, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xBAE0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xBAE1, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xBAFC, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xBAFD, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xBB18, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xBB19, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xBB34, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xBB35, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xBB50, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xBB51, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xBB6C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xBB6D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xBB88, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xBB89, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xBBA4, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xBBA5, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xBBC0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xBBC1, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xBBDC, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xBBDD, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xBBF8, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xBBF9, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xBC14, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xBC15, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xBC30, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xBC31, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xBC4C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xBC4D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xBC68, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xBC69, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xBC84, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xBC85, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xBCA0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xBCA1, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xBCBC, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xBCBD, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xBCD8, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xBCD9, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xBCF4, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xBCF5, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xBD10, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xBD11, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xBD2C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xBD2D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xBD48, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xBD49, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xBD64, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xBD65, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xBD80, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xBD81, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xBD9C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xBD9D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xBDB8, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xBDB9, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xBDD4, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xBDD5, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xBDF0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xBDF1, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xBE0C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xBE0D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xBE28, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xBE29, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xBE44, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xBE45, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xBE60, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xBE61, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xBE7C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xBE7D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xBE98, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xBE99, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xBEB4, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xBEB5, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xBED0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xBED1, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xBEEC, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xBEED, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xBF08, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xBF09, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xBF24, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xBF25, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xBF40, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xBF41, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xBF5C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xBF5D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xBF78, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xBF79, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xBF94, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xBF95, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xBFB0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xBFB1, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xBFCC, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xBFCD, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xBFE8, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xBFE9, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC004, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC005, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC020, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC021, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC03C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC03D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC058, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC059, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC074, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC075, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC090, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC091, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC0AC, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC0AD, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC0C8, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC0C9, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC0E4, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC0E5, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC100, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC101, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC11C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC11D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC138, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC139, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC154, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC155, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC170, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC171, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC18C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC18D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC1A8, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC1A9, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC1C4, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC1C5, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC1E0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC1E1, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC1FC, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC1FD, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC218, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC219, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC234, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC235, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC250, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC251, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC26C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC26D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC288, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC289, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC2A4, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC2A5, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC2C0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC2C1, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC2DC, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC2DD, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC2F8, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC2F9, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC314, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC315, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC330, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC331, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC34C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC34D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC368, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC369, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC384, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC385, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC3A0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC3A1, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC3BC, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC3BD, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC3D8, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC3D9, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC3F4, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC3F5, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC410, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC411, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC42C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC42D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC448, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC449, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC464, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC465, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC480, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC481, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC49C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC49D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC4B8, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC4B9, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC4D4, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC4D5, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC4F0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC4F1, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC50C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC50D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC528, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC529, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC544, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC545, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC560, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC561, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC57C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC57D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC598, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC599, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC5B4, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC5B5, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC5D0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC5D1, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC5EC, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC5ED, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC608, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC609, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC624, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC625, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC640, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC641, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC65C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC65D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC678, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC679, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC694, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC695, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC6B0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC6B1, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC6CC, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC6CD, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC6E8, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC6E9, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC704, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC705, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC720, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC721, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC73C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC73D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC758, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC759, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC774, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC775, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC790, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC791, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC7AC, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC7AD, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC7C8, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC7C9, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC7E4, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC7E5, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC800, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC801, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC81C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC81D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC838, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC839, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC854, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC855, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC870, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC871, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC88C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC88D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC8A8, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC8A9, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC8C4, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC8C5, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC8E0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC8E1, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC8FC, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC8FD, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC918, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC919, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC934, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC935, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC950, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC951, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC96C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC96D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC988, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC989, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC9A4, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC9A5, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC9C0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC9C1, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC9DC, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC9DD, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xC9F8, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xC9F9, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xCA14, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xCA15, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xCA30, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xCA31, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xCA4C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xCA4D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xCA68, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xCA69, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xCA84, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xCA85, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xCAA0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xCAA1, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xCABC, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xCABD, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xCAD8, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xCAD9, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xCAF4, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xCAF5, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xCB10, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xCB11, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xCB2C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xCB2D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xCB48, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xCB49, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xCB64, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xCB65, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xCB80, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xCB81, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xCB9C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xCB9D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xCBB8, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xCBB9, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xCBD4, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xCBD5, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xCBF0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xCBF1, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xCC0C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xCC0D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xCC28, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xCC29, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xCC44, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xCC45, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xCC60, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xCC61, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xCC7C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xCC7D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xCC98, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xCC99, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xCCB4, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xCCB5, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xCCD0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xCCD1, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xCCEC, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xCCED, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xCD08, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xCD09, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xCD24, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xCD25, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xCD40, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xCD41, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xCD5C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xCD5D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xCD78, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xCD79, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xCD94, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xCD95, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xCDB0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xCDB1, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xCDCC, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xCDCD, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xCDE8, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xCDE9, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xCE04, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xCE05, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xCE20, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xCE21, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xCE3C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xCE3D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xCE58, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xCE59, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xCE74, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xCE75, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xCE90, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xCE91, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xCEAC, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xCEAD, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xCEC8, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xCEC9, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xCEE4, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xCEE5, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xCF00, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xCF01, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xCF1C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xCF1D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xCF38, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xCF39, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xCF54, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xCF55, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xCF70, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xCF71, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xCF8C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xCF8D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xCFA8, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xCFA9, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xCFC4, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xCFC5, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xCFE0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xCFE1, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xCFFC, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xCFFD, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xD018, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xD019, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xD034, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xD035, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xD050, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xD051, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xD06C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xD06D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xD088, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xD089, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xD0A4, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xD0A5, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xD0C0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xD0C1, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xD0DC, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xD0DD, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xD0F8, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xD0F9, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xD114, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xD115, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xD130, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xD131, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xD14C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xD14D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xD168, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xD169, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xD184, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xD185, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xD1A0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xD1A1, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xD1BC, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xD1BD, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xD1D8, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xD1D9, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xD1F4, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xD1F5, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xD210, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xD211, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xD22C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xD22D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xD248, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xD249, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xD264, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xD265, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xD280, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xD281, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xD29C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xD29D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xD2B8, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xD2B9, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xD2D4, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xD2D5, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xD2F0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xD2F1, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xD30C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xD30D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xD328, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xD329, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xD344, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xD345, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xD360, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xD361, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xD37C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xD37D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xD398, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xD399, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xD3B4, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xD3B5, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xD3D0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xD3D1, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xD3EC, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xD3ED, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xD408, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xD409, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xD424, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xD425, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xD440, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xD441, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xD45C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xD45D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xD478, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xD479, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xD494, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xD495, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xD4B0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xD4B1, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xD4CC, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xD4CD, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xD4E8, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xD4E9, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xD504, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xD505, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xD520, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xD521, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xD53C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xD53D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xD558, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xD559, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xD574, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xD575, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xD590, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xD591, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xD5AC, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xD5AD, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xD5C8, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xD5C9, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xD5E4, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xD5E5, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xD600, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xD601, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xD61C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xD61D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xD638, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xD639, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xD654, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xD655, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xD670, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xD671, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xD68C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xD68D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xD6A8, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xD6A9, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xD6C4, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xD6C5, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xD6E0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xD6E1, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xD6FC, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xD6FD, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xD718, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xD719, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xD734, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xD735, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xD750, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xD751, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xD76C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xD76D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xD788, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
-        { 0xD789, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
-        { 0xD7A4, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0xD7B0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::v },
-        { 0xD7C7, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0xD7CB, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::t },
-        { 0xD7FC, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0xE000, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0xF900, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
-        { 0xFB00, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0xFB1E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0xFB1F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0xFE00, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0xFE0F, east_asian_width_class_type::ambiguous, emoji_type::emoji, grapheme_break_property_type::extend },
-        { 0xFE10, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
-        { 0xFE1A, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0xFE20, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0xFE30, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
-        { 0xFE53, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0xFE54, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
-        { 0xFE67, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0xFE68, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
-        { 0xFE6C, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0xFEFF, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::control },
-        { 0xFF00, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0xFF01, east_asian_width_class_type::fullwidth, emoji_type::normal, grapheme_break_property_type::other },
-        { 0xFF61, east_asian_width_class_type::halfwidth, emoji_type::normal, grapheme_break_property_type::other },
-        { 0xFF9E, east_asian_width_class_type::halfwidth, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0xFFA0, east_asian_width_class_type::halfwidth, emoji_type::normal, grapheme_break_property_type::other },
-        { 0xFFBF, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0xFFC2, east_asian_width_class_type::halfwidth, emoji_type::normal, grapheme_break_property_type::other },
-        { 0xFFC8, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0xFFCA, east_asian_width_class_type::halfwidth, emoji_type::normal, grapheme_break_property_type::other },
-        { 0xFFD0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0xFFD2, east_asian_width_class_type::halfwidth, emoji_type::normal, grapheme_break_property_type::other },
-        { 0xFFD8, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0xFFDA, east_asian_width_class_type::halfwidth, emoji_type::normal, grapheme_break_property_type::other },
-        { 0xFFDD, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0xFFE0, east_asian_width_class_type::fullwidth, emoji_type::normal, grapheme_break_property_type::other },
-        { 0xFFE7, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0xFFE8, east_asian_width_class_type::halfwidth, emoji_type::normal, grapheme_break_property_type::other },
-        { 0xFFEF, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0xFFF0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::control },
-        { 0xFFFC, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0xFFFD, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0xFFFE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x101FD, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x101FE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x102E0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x102E1, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x10376, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1037B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x10A01, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x10A04, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x10A05, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x10A07, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x10A0C, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x10A10, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x10A38, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x10A3B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x10A3F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x10A40, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x10AE5, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x10AE7, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x10D24, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x10D28, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x10EAB, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x10EAD, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x10F46, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x10F51, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x10F82, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x10F86, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x11000, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x11001, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x11002, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x11003, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x11038, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x11047, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x11070, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x11071, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x11073, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x11075, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1107F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x11082, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x11083, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x110B0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x110B3, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x110B7, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x110B9, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x110BB, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x110BD, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::prepend },
-        { 0x110BE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x110C2, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x110C3, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x110CD, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::prepend },
-        { 0x110CE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x11100, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x11103, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x11127, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1112C, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x1112D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x11135, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x11145, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x11147, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x11173, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x11174, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x11180, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x11182, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x11183, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x111B3, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x111B6, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x111BF, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x111C1, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x111C2, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::prepend },
-        { 0x111C4, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x111C9, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x111CD, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x111CE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x111CF, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x111D0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1122C, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x1122F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x11232, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x11234, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x11235, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x11236, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x11238, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1123E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1123F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x112DF, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x112E0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x112E3, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x112EB, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x11300, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x11302, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x11304, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1133B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1133D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1133E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1133F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x11340, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x11341, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x11345, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x11347, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x11349, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1134B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x1134E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x11357, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x11358, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x11362, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x11364, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x11366, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1136D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x11370, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x11375, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x11435, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x11438, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x11440, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x11442, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x11445, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x11446, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x11447, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1145E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1145F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x114B0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x114B1, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x114B3, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x114B9, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x114BA, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x114BB, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x114BD, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x114BE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x114BF, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x114C1, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x114C2, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x114C4, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x115AF, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x115B0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x115B2, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x115B6, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x115B8, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x115BC, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x115BE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x115BF, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x115C1, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x115DC, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x115DE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x11630, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x11633, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1163B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x1163D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1163E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x1163F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x11641, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x116AB, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x116AC, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x116AD, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x116AE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x116B0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x116B6, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x116B7, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x116B8, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1171D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x11720, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x11722, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x11726, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x11727, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1172C, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1182C, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x1182F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x11838, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x11839, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1183B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x11930, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x11931, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x11936, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x11937, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x11939, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1193B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1193D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x1193E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1193F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::prepend },
-        { 0x11940, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x11941, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::prepend },
-        { 0x11942, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x11943, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x11944, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x119D1, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x119D4, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x119D8, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x119DA, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x119DC, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x119E0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x119E1, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x119E4, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x119E5, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x11A01, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x11A0B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x11A33, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x11A39, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x11A3A, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::prepend },
-        { 0x11A3B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x11A3F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x11A47, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x11A48, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x11A51, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x11A57, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x11A59, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x11A5C, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x11A84, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::prepend },
-        { 0x11A8A, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x11A97, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x11A98, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x11A9A, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x11C2F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x11C30, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x11C37, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x11C38, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x11C3E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x11C3F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x11C40, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x11C92, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x11CA8, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x11CA9, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x11CAA, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x11CB1, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x11CB2, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x11CB4, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x11CB5, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x11CB7, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x11D31, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x11D37, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x11D3A, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x11D3B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x11D3C, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x11D3E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x11D3F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x11D46, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::prepend },
-        { 0x11D47, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x11D48, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x11D8A, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x11D8F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x11D90, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x11D92, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x11D93, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x11D95, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x11D96, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x11D97, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x11D98, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x11EF3, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x11EF5, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x11EF7, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x13430, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::control },
-        { 0x13439, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x16AF0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x16AF5, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x16B30, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x16B37, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x16F4F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x16F50, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x16F51, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x16F88, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x16F8F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x16F93, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x16FE0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x16FE4, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x16FE5, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x16FF0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x16FF2, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x17000, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x187F8, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x18800, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x18CD6, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x18D00, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x18D09, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1AFF0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1AFF4, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1AFF5, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1AFFC, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1AFFD, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1AFFF, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1B000, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1B123, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1B150, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1B153, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1B164, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1B168, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1B170, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1B2FC, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1BC9D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1BC9F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1BCA0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::control },
-        { 0x1BCA4, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1CF00, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1CF2E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1CF30, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1CF47, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1D165, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1D166, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x1D167, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1D16A, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1D16D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
-        { 0x1D16E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1D173, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::control },
-        { 0x1D17B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1D183, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1D185, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1D18C, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1D1AA, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1D1AE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1D242, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1D245, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1DA00, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1DA37, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1DA3B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1DA6D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1DA75, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1DA76, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1DA84, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1DA85, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1DA9B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1DAA0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1DAA1, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1DAB0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1E000, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1E007, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1E008, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1E019, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1E01B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1E022, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1E023, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1E025, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1E026, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1E02B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1E130, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1E137, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1E2AE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1E2AF, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1E2EC, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1E2F0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1E8D0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1E8D7, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1E944, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0x1E94B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F000, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F004, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1F005, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F0CF, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1F0D0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F100, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F10B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F10D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F110, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F12E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F12F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F130, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F16A, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F16C, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F170, east_asian_width_class_type::ambiguous, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1F172, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F17E, east_asian_width_class_type::ambiguous, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1F180, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F18E, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1F18F, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F191, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1F19B, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F1AD, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F1E6, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::regional },
-        { 0x1F200, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F201, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1F203, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F210, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F21A, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1F21B, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F22F, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1F230, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F232, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1F23B, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F23C, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F240, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F249, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F250, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1F252, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F260, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F266, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F300, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1F321, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1F322, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F324, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1F32D, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1F336, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1F337, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1F37D, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1F37E, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1F394, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F396, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1F398, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F399, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1F39C, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F39E, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1F3A0, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1F3CB, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1F3CF, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1F3D4, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1F3E0, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1F3F1, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F3F3, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1F3F4, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1F3F5, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1F3F6, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F3F7, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1F3F8, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1F3FB, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::extend },
-        { 0x1F400, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1F43F, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1F440, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1F441, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1F442, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1F4FD, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1F4FE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F4FF, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1F53E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F546, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F549, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1F54B, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1F54F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F550, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1F568, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F56F, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1F571, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F573, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1F57A, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1F57B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F587, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1F588, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F58A, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1F58E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F590, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1F591, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F595, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1F597, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F5A4, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1F5A5, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1F5A6, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F5A8, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1F5A9, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F5B1, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1F5B3, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F5BC, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1F5BD, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F5C2, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1F5C5, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F5D1, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1F5D4, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F5DC, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1F5DF, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F5E1, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1F5E2, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F5E3, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1F5E4, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F5E8, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1F5E9, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F5EF, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1F5F0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F5F3, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1F5F4, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F5FA, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1F5FB, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1F650, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F680, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1F6C6, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F6CB, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1F6CC, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1F6CD, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1F6D0, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1F6D3, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F6D5, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1F6D8, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F6DD, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1F6E0, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1F6E6, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F6E9, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1F6EA, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F6EB, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1F6ED, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F6F0, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1F6F1, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F6F3, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1F6F4, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1F6FD, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F700, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F774, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F780, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F7D5, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F7E0, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1F7EC, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F7F0, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1F7F1, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F800, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F80C, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F810, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F848, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F850, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F85A, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F860, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F888, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F890, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F8AE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F900, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F90C, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1F93B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F93C, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1F946, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1F947, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1FA00, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1FA70, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1FA75, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1FA78, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1FA7D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1FA80, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1FA87, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1FA90, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1FAAD, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1FAB0, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1FABB, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1FAC0, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1FAC6, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1FAD0, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1FADA, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1FAE0, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1FAE8, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1FAF0, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
-        { 0x1FAF7, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1FB00, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1FC00, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x1FFFE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x20000, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x2FFFE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x30000, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x3FFFE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0xE0000, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::control },
-        { 0xE0020, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::extend },
-        { 0xE0080, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::control },
-        { 0xE0100, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::extend },
-        { 0xE01F0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::control },
-        { 0xE1000, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0xF0000, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0xFFFFE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x100000, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
-        { 0x10FFFE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
-    };
-    // clang-format on
-
-
-}
+/*! \file
+    \brief A character property map.
+
+    This file is generated by tool/make_character_property_map_cpp.py.
+
+    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
+*/
+
+#include <cstddef>
+
+#include "tetengo.text.grapheme_splitting.character_property_map.hpp"
+
+
+namespace tetengo::text::grapheme_splitting
+{
+    const std::size_t character_property_map_size = 2452;
+
+    // clang-format off
+    const character_property_map_element_type character_property_map[] = {
+        { 0x0000, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::control },
+        { 0x000A, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::lf },
+        { 0x000B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::control },
+        { 0x000D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::cr },
+        { 0x000E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::control },
+        { 0x0020, east_asian_width_class_type::narrow, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0023, east_asian_width_class_type::narrow, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x0024, east_asian_width_class_type::narrow, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x002A, east_asian_width_class_type::narrow, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x002B, east_asian_width_class_type::narrow, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0030, east_asian_width_class_type::narrow, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x003A, east_asian_width_class_type::narrow, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x007F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::control },
+        { 0x00A0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x00A1, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x00A2, east_asian_width_class_type::narrow, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x00A4, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x00A5, east_asian_width_class_type::narrow, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x00A7, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x00A9, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x00AA, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x00AB, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x00AC, east_asian_width_class_type::narrow, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x00AD, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::control },
+        { 0x00AE, east_asian_width_class_type::ambiguous, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x00AF, east_asian_width_class_type::narrow, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x00B0, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x00B5, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x00B6, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x00BB, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x00BC, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x00C0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x00C6, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x00C7, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x00D0, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x00D1, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x00D7, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x00D9, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x00DE, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x00E2, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x00E6, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x00E7, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x00E8, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x00EB, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x00EC, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x00EE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x00F0, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x00F1, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x00F2, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x00F4, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x00F7, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x00FB, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x00FC, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x00FD, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x00FE, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x00FF, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0101, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0102, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0111, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0112, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0113, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0114, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x011B, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x011C, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0126, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0128, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x012B, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x012C, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0131, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0134, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0138, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0139, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x013F, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0143, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0144, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0145, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0148, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x014C, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x014D, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x014E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0152, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0154, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0166, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0168, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x016B, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x016C, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x01CE, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x01CF, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x01D0, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x01D1, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x01D2, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x01D3, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x01D4, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x01D5, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x01D6, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x01D7, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x01D8, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x01D9, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x01DA, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x01DB, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x01DC, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x01DD, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0251, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0252, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0261, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0262, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x02C4, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x02C5, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x02C7, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x02C8, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x02C9, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x02CC, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x02CD, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x02CE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x02D0, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x02D1, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x02D8, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x02DC, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x02DD, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x02DE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x02DF, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x02E0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0300, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0370, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0391, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x03A2, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x03A3, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x03AA, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x03B1, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x03C2, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x03C3, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x03CA, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0401, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0402, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0410, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0450, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0451, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0452, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0483, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x048A, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0591, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x05BE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x05BF, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x05C0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x05C1, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x05C3, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x05C4, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x05C6, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x05C7, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x05C8, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0600, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::prepend },
+        { 0x0606, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0610, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x061B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x061C, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::control },
+        { 0x061D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x064B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0660, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0670, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0671, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x06D6, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x06DD, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::prepend },
+        { 0x06DE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x06DF, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x06E5, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x06E7, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x06E9, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x06EA, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x06EE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x070F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::prepend },
+        { 0x0710, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0711, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0712, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0730, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x074B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x07A6, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x07B1, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x07EB, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x07F4, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x07FD, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x07FE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0816, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x081A, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x081B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0824, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0825, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0828, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0829, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x082E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0859, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x085C, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0890, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::prepend },
+        { 0x0892, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0898, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x08A0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x08CA, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x08E2, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::prepend },
+        { 0x08E3, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0903, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x0904, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x093A, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x093B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x093C, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x093D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x093E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x0941, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0949, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x094D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x094E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x0950, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0951, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0958, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0962, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0964, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0981, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0982, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x0984, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x09BC, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x09BD, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x09BE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x09BF, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x09C1, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x09C5, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x09C7, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x09C9, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x09CB, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x09CD, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x09CE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x09D7, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x09D8, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x09E2, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x09E4, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x09FE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x09FF, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0A01, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0A03, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x0A04, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0A3C, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0A3D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0A3E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x0A41, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0A43, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0A47, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0A49, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0A4B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0A4E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0A51, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0A52, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0A70, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0A72, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0A75, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0A76, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0A81, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0A83, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x0A84, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0ABC, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0ABD, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0ABE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x0AC1, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0AC6, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0AC7, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0AC9, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x0ACA, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0ACB, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x0ACD, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0ACE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0AE2, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0AE4, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0AFA, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0B00, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0B01, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0B02, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x0B04, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0B3C, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0B3D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0B3E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0B40, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x0B41, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0B45, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0B47, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x0B49, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0B4B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x0B4D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0B4E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0B55, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0B58, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0B62, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0B64, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0B82, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0B83, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0BBE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0BBF, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x0BC0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0BC1, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x0BC3, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0BC6, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x0BC9, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0BCA, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x0BCD, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0BCE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0BD7, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0BD8, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0C00, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0C01, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x0C04, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0C05, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0C3C, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0C3D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0C3E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0C41, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x0C45, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0C46, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0C49, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0C4A, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0C4E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0C55, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0C57, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0C62, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0C64, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0C81, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0C82, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x0C84, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0CBC, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0CBD, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0CBE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x0CBF, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0CC0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x0CC2, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0CC3, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x0CC5, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0CC6, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0CC7, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x0CC9, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0CCA, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x0CCC, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0CCE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0CD5, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0CD7, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0CE2, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0CE4, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0D00, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0D02, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x0D04, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0D3B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0D3D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0D3E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0D3F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x0D41, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0D45, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0D46, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x0D49, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0D4A, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x0D4D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0D4E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::prepend },
+        { 0x0D4F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0D57, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0D58, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0D62, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0D64, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0D81, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0D82, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x0D84, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0DCA, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0DCB, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0DCF, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0DD0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x0DD2, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0DD5, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0DD6, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0DD7, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0DD8, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x0DDF, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0DE0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0DF2, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x0DF4, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0E31, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0E32, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0E33, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x0E34, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0E3B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0E47, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0E4F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0EB1, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0EB2, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0EB3, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x0EB4, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0EBD, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0EC8, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0ECE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0F18, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0F1A, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0F35, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0F36, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0F37, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0F38, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0F39, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0F3A, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0F3E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x0F40, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0F71, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0F7F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x0F80, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0F85, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0F86, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0F88, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0F8D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0F98, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0F99, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0FBD, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x0FC6, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x0FC7, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x102D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1031, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x1032, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1038, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1039, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x103B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x103D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x103F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1056, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x1058, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x105A, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x105E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1061, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1071, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1075, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1082, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1083, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1084, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x1085, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1087, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x108D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x108E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x109D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x109E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1100, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::l },
+        { 0x1160, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::v },
+        { 0x11A8, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::t },
+        { 0x1200, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x135D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1360, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1712, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1715, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x1716, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1732, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1734, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x1735, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1752, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1754, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1772, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1774, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x17B4, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x17B6, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x17B7, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x17BE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x17C6, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x17C7, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x17C9, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x17D4, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x17DD, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x17DE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x180B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x180E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::control },
+        { 0x180F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1810, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1885, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1887, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x18A9, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x18AA, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1920, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1923, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x1927, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1929, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x192C, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1930, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x1932, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1933, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x1939, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x193C, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1A17, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1A19, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x1A1B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1A1C, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1A55, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x1A56, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1A57, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x1A58, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1A5F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1A60, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1A61, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1A62, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1A63, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1A65, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1A6D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x1A73, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1A7D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1A7F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1A80, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1AB0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1ACF, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1B00, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1B04, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x1B05, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1B34, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1B3B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x1B3C, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1B3D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x1B42, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1B43, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x1B45, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1B6B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1B74, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1B80, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1B82, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x1B83, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1BA1, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x1BA2, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1BA6, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x1BA8, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1BAA, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x1BAB, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1BAE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1BE6, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1BE7, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x1BE8, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1BEA, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x1BED, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1BEE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x1BEF, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1BF2, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x1BF4, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1C24, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x1C2C, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1C34, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x1C36, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1C38, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1CD0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1CD3, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1CD4, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1CE1, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x1CE2, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1CE9, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1CED, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1CEE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1CF4, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1CF5, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1CF7, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x1CF8, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1CFA, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1DC0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1E00, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x200B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::control },
+        { 0x200C, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x200D, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::zwj },
+        { 0x200E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::control },
+        { 0x2010, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2011, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2013, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2017, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2018, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x201A, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x201C, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x201E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2020, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2023, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2024, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2028, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::control },
+        { 0x202F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2030, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2031, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2032, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2034, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2035, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2036, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x203B, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x203C, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x203D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x203E, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x203F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2049, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x204A, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2060, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::control },
+        { 0x2070, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2074, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2075, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x207F, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2080, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2081, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2085, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x20A9, east_asian_width_class_type::halfwidth, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x20AA, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x20AC, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x20AD, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x20D0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x20E3, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::extend },
+        { 0x20E4, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x20F1, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2103, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2104, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2105, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2106, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2109, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x210A, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2113, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2114, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2116, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2117, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2121, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2122, east_asian_width_class_type::ambiguous, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x2123, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2126, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2127, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x212B, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x212C, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2139, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x213A, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2153, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2155, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x215B, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x215F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2160, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x216C, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2170, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x217A, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2189, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x218A, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2190, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2194, east_asian_width_class_type::ambiguous, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x219A, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x21A9, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x21AB, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x21B8, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x21BA, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x21D2, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x21D3, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x21D4, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x21D5, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x21E7, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x21E8, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2200, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2201, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2202, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2204, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2207, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2209, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x220B, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x220C, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x220F, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2210, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2211, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2212, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2215, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2216, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x221A, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x221B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x221D, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2221, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2223, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2224, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2225, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2226, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2227, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x222D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x222E, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x222F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2234, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2238, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x223C, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x223E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2248, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2249, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x224C, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x224D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2252, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2253, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2260, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2262, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2264, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2268, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x226A, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x226C, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x226E, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2270, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2282, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2284, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2286, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2288, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2295, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2296, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2299, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x229A, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x22A5, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x22A6, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x22BF, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x22C0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2312, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2313, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x231A, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x231C, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2328, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x2329, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x232B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2388, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2389, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x23CF, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x23D0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x23E9, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x23ED, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x23F0, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x23F1, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x23F3, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x23F4, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x23F8, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x23FB, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2460, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x24C2, east_asian_width_class_type::ambiguous, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x24C3, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x24EA, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x24EB, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x254C, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2550, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2574, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2580, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2590, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2592, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2596, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x25A0, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x25A2, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x25A3, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x25AA, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x25AC, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x25B2, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x25B4, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x25B6, east_asian_width_class_type::ambiguous, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x25B7, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x25B8, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x25BC, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x25BE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x25C0, east_asian_width_class_type::ambiguous, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x25C1, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x25C2, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x25C6, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x25C9, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x25CB, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x25CC, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x25CE, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x25D2, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x25E2, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x25E6, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x25EF, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x25F0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x25FB, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x25FD, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x25FF, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2600, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x2605, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2606, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2607, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2609, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x260A, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x260E, east_asian_width_class_type::ambiguous, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x260F, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2610, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2611, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x2612, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2613, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2614, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x2616, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2618, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x2619, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x261C, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x261D, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x261E, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x261F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2620, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x2621, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2622, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x2624, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2626, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x2627, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x262A, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x262B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x262E, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x2630, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2638, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x263B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2640, east_asian_width_class_type::ambiguous, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x2641, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2642, east_asian_width_class_type::ambiguous, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x2643, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2648, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x2654, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x265F, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x2660, east_asian_width_class_type::ambiguous, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x2661, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2662, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2663, east_asian_width_class_type::ambiguous, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x2664, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2665, east_asian_width_class_type::ambiguous, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x2666, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x2667, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2668, east_asian_width_class_type::ambiguous, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x2669, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x266B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x266C, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x266E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x266F, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2670, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x267B, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x267C, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x267E, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x267F, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x2680, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2686, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2690, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2692, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x2693, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x2694, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x2698, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2699, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x269A, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x269B, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x269D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x269E, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x26A0, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x26A1, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x26A2, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x26A7, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x26A8, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x26AA, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x26AC, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x26B0, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x26B2, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x26BD, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x26BF, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x26C0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x26C4, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x26C6, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x26C8, east_asian_width_class_type::ambiguous, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x26C9, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x26CE, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x26CF, east_asian_width_class_type::ambiguous, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x26D0, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x26D1, east_asian_width_class_type::ambiguous, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x26D2, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x26D3, east_asian_width_class_type::ambiguous, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x26D4, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x26D5, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x26E2, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x26E3, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x26E4, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x26E8, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x26E9, east_asian_width_class_type::ambiguous, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x26EA, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x26EB, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x26F0, east_asian_width_class_type::ambiguous, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x26F2, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x26F4, east_asian_width_class_type::ambiguous, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x26F5, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x26F6, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x26F7, east_asian_width_class_type::ambiguous, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x26FA, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x26FB, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x26FD, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x26FE, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2700, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2702, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x2703, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2705, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x2706, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2708, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x270A, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x270C, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x270E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x270F, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x2710, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2712, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x2713, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2714, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x2715, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2716, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x2717, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x271D, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x271E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2721, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x2722, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2728, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x2729, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2733, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x2735, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x273D, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x273E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2744, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x2745, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2747, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x2748, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x274C, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x274D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x274E, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x274F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2753, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x2756, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2757, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x2758, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2763, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x2765, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2768, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2776, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2780, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2795, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x2798, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x27A1, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x27A2, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x27B0, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x27B1, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x27BF, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x27C0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x27E6, east_asian_width_class_type::narrow, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x27EE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2934, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x2936, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2985, east_asian_width_class_type::narrow, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2987, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2B05, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x2B08, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2B1B, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x2B1D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2B50, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x2B51, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2B55, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x2B56, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2B5A, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2CEF, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x2CF2, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2D7F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x2D80, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2DE0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x2E00, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2E80, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2E9A, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2E9B, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2EF4, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2F00, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2FD6, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2FF0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2FFC, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x3000, east_asian_width_class_type::fullwidth, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x3001, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x302A, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x3030, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x3031, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x303D, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x303E, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x303F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x3041, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x3097, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x3099, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x309B, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x3100, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x3105, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x3130, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x3131, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x318F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x3190, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x31E4, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x31F0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x321F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x3220, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x3248, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x3250, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x3297, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x3298, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x3299, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x329A, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x4DC0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x4E00, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
+        { 0xA48D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0xA490, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
+        { 0xA4C7, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0xA66F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0xA673, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0xA674, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0xA67E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0xA69E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0xA6A0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0xA6F0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0xA6F2, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0xA802, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0xA803, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0xA806, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0xA807, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0xA80B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0xA80C, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0xA823, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0xA825, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0xA827, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0xA828, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0xA82C, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0xA82D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0xA880, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0xA882, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0xA8B4, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0xA8C4, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0xA8C6, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0xA8E0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0xA8F2, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0xA8FF, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0xA900, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0xA926, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0xA92E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0xA947, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0xA952, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0xA954, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0xA960, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::l },
+        { 0xA97D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0xA980, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0xA983, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0xA984, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0xA9B3, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0xA9B4, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0xA9B6, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0xA9BA, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0xA9BC, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0xA9BE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0xA9C1, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0xA9E5, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0xA9E6, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0xAA29, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0xAA2F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0xAA31, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0xAA33, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0xAA35, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0xAA37, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0xAA43, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0xAA44, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0xAA4C, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0xAA4D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0xAA4E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0xAA7C, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0xAA7D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0xAAB0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0xAAB1, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0xAAB2, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0xAAB5, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0xAAB7, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0xAAB9, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0xAABE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0xAAC0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0xAAC1, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0xAAC2, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0xAAEB, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0xAAEC, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0xAAEE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0xAAF0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0xAAF5, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0xAAF6, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0xAAF7, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0xABE3, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0xABE5, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0xABE6, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0xABE8, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0xABE9, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0xABEB, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0xABEC, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0xABED, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0xABEE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0xAC00, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xAC01, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xAC1C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xAC1D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xAC38, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xAC39, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xAC54, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xAC55, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xAC70, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xAC71, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xAC8C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xAC8D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xACA8, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xACA9, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xACC4, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xACC5, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xACE0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xACE1, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xACFC, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xACFD, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xAD18, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xAD19, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xAD34, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xAD35, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xAD50, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xAD51, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xAD6C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xAD6D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xAD88, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xAD89, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xADA4, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xADA5, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xADC0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xADC1, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xADDC, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xADDD, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xADF8, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xADF9, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xAE14, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xAE15, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xAE30, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xAE31, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xAE4C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xAE4D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xAE68, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xAE69, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xAE84, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xAE85, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xAEA0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xAEA1, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xAEBC, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xAEBD, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xAED8, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xAED9, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xAEF4, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xAEF5, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xAF10, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xAF11, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xAF2C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xAF2D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xAF48, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xAF49, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xAF64, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xAF65, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xAF80, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xAF81, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xAF9C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xAF9D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xAFB8, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xAFB9, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xAFD4, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xAFD5, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xAFF0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xAFF1, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB00C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB00D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB028, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB029, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB044, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB045, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB060, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB061, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB07C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB07D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB098, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB099, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB0B4, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB0B5, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB0D0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB0D1, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB0EC, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB0ED, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB108, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB109, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB124, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB125, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB140, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB141, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB15C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB15D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB178, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB179, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB194, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB195, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB1B0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB1B1, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB1CC, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB1CD, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB1E8, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB1E9, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB204, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB205, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB220, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB221, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB23C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB23D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB258, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB259, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB274, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB275, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB290, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB291, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB2AC, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB2AD, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB2C8, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB2C9, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB2E4, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB2E5, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB300, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB301, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB31C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB31D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB338, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB339, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB354, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB355, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB370, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB371, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB38C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB38D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB3A8, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB3A9, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB3C4, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB3C5, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB3E0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB3E1, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB3FC, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB3FD, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB418, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB419, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB434, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB435, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB450, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB451, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB46C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB46D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB488, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB489, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB4A4, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB4A5, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB4C0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB4C1, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB4DC, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB4DD, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB4F8, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB4F9, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB514, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB515, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB530, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB531, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB54C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB54D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB568, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB569, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB584, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB585, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB5A0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB5A1, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB5BC, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB5BD, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB5D8, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB5D9, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB5F4, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB5F5, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB610, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB611, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB62C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB62D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB648, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB649, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB664, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB665, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB680, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB681, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB69C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB69D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB6B8, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB6B9, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB6D4, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB6D5, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB6F0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB6F1, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB70C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB70D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB728, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB729, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB744, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB745, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB760, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB761, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB77C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB77D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB798, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB799, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB7B4, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB7B5, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB7D0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB7D1, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB7EC, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB7ED, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB808, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB809, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB824, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB825, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB840, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB841, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB85C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB85D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB878, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB879, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB894, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB895, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB8B0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB8B1, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB8CC, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB8CD, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB8E8, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB8E9, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB904, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB905, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB920, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB921, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB93C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB93D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB958, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB959, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB974, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB975, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB990, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB991, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB9AC, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB9AD, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB9C8, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB9C9, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xB9E4, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xB9E5, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xBA00, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xBA01, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xBA1C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xBA1D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xBA38, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xBA39, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xBA54, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xBA55, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xBA70, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xBA71, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xBA8C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xBA8D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xBAA8, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xBAA9, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xBAC4, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xBAC5, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xBAE0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xBAE1, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xBAFC, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xBAFD, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xBB18, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xBB19, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xBB34, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xBB35, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xBB50, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xBB51, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xBB6C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xBB6D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xBB88, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xBB89, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xBBA4, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xBBA5, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xBBC0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xBBC1, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xBBDC, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xBBDD, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xBBF8, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xBBF9, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xBC14, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xBC15, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xBC30, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xBC31, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xBC4C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xBC4D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xBC68, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xBC69, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xBC84, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xBC85, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xBCA0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xBCA1, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xBCBC, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xBCBD, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xBCD8, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xBCD9, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xBCF4, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xBCF5, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xBD10, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xBD11, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xBD2C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xBD2D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xBD48, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xBD49, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xBD64, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xBD65, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xBD80, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xBD81, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xBD9C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xBD9D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xBDB8, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xBDB9, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xBDD4, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xBDD5, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xBDF0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xBDF1, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xBE0C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xBE0D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xBE28, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xBE29, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xBE44, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xBE45, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xBE60, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xBE61, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xBE7C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xBE7D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xBE98, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xBE99, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xBEB4, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xBEB5, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xBED0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xBED1, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xBEEC, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xBEED, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xBF08, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xBF09, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xBF24, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xBF25, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xBF40, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xBF41, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xBF5C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xBF5D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xBF78, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xBF79, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xBF94, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xBF95, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xBFB0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xBFB1, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xBFCC, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xBFCD, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xBFE8, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xBFE9, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC004, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC005, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC020, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC021, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC03C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC03D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC058, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC059, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC074, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC075, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC090, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC091, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC0AC, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC0AD, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC0C8, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC0C9, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC0E4, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC0E5, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC100, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC101, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC11C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC11D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC138, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC139, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC154, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC155, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC170, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC171, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC18C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC18D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC1A8, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC1A9, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC1C4, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC1C5, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC1E0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC1E1, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC1FC, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC1FD, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC218, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC219, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC234, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC235, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC250, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC251, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC26C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC26D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC288, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC289, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC2A4, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC2A5, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC2C0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC2C1, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC2DC, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC2DD, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC2F8, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC2F9, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC314, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC315, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC330, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC331, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC34C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC34D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC368, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC369, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC384, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC385, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC3A0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC3A1, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC3BC, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC3BD, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC3D8, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC3D9, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC3F4, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC3F5, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC410, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC411, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC42C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC42D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC448, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC449, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC464, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC465, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC480, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC481, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC49C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC49D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC4B8, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC4B9, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC4D4, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC4D5, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC4F0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC4F1, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC50C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC50D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC528, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC529, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC544, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC545, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC560, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC561, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC57C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC57D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC598, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC599, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC5B4, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC5B5, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC5D0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC5D1, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC5EC, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC5ED, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC608, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC609, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC624, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC625, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC640, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC641, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC65C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC65D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC678, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC679, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC694, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC695, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC6B0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC6B1, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC6CC, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC6CD, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC6E8, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC6E9, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC704, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC705, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC720, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC721, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC73C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC73D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC758, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC759, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC774, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC775, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC790, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC791, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC7AC, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC7AD, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC7C8, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC7C9, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC7E4, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC7E5, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC800, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC801, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC81C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC81D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC838, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC839, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC854, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC855, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC870, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC871, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC88C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC88D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC8A8, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC8A9, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC8C4, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC8C5, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC8E0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC8E1, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC8FC, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC8FD, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC918, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC919, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC934, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC935, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC950, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC951, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC96C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC96D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC988, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC989, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC9A4, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC9A5, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC9C0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC9C1, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC9DC, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC9DD, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xC9F8, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xC9F9, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xCA14, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xCA15, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xCA30, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xCA31, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xCA4C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xCA4D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xCA68, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xCA69, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xCA84, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xCA85, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xCAA0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xCAA1, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xCABC, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xCABD, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xCAD8, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xCAD9, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xCAF4, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xCAF5, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xCB10, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xCB11, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xCB2C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xCB2D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xCB48, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xCB49, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xCB64, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xCB65, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xCB80, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xCB81, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xCB9C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xCB9D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xCBB8, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xCBB9, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xCBD4, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xCBD5, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xCBF0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xCBF1, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xCC0C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xCC0D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xCC28, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xCC29, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xCC44, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xCC45, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xCC60, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xCC61, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xCC7C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xCC7D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xCC98, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xCC99, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xCCB4, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xCCB5, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xCCD0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xCCD1, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xCCEC, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xCCED, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xCD08, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xCD09, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xCD24, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xCD25, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xCD40, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xCD41, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xCD5C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xCD5D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xCD78, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xCD79, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xCD94, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xCD95, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xCDB0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xCDB1, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xCDCC, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xCDCD, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xCDE8, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xCDE9, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xCE04, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xCE05, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xCE20, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xCE21, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xCE3C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xCE3D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xCE58, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xCE59, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xCE74, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xCE75, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xCE90, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xCE91, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xCEAC, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xCEAD, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xCEC8, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xCEC9, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xCEE4, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xCEE5, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xCF00, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xCF01, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xCF1C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xCF1D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xCF38, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xCF39, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xCF54, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xCF55, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xCF70, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xCF71, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xCF8C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xCF8D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xCFA8, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xCFA9, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xCFC4, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xCFC5, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xCFE0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xCFE1, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xCFFC, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xCFFD, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xD018, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xD019, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xD034, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xD035, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xD050, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xD051, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xD06C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xD06D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xD088, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xD089, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xD0A4, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xD0A5, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xD0C0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xD0C1, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xD0DC, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xD0DD, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xD0F8, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xD0F9, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xD114, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xD115, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xD130, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xD131, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xD14C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xD14D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xD168, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xD169, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xD184, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xD185, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xD1A0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xD1A1, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xD1BC, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xD1BD, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xD1D8, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xD1D9, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xD1F4, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xD1F5, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xD210, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xD211, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xD22C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xD22D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xD248, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xD249, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xD264, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xD265, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xD280, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xD281, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xD29C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xD29D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xD2B8, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xD2B9, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xD2D4, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xD2D5, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xD2F0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xD2F1, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xD30C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xD30D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xD328, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xD329, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xD344, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xD345, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xD360, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xD361, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xD37C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xD37D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xD398, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xD399, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xD3B4, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xD3B5, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xD3D0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xD3D1, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xD3EC, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xD3ED, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xD408, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xD409, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xD424, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xD425, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xD440, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xD441, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xD45C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xD45D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xD478, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xD479, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xD494, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xD495, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xD4B0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xD4B1, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xD4CC, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xD4CD, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xD4E8, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xD4E9, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xD504, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xD505, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xD520, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xD521, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xD53C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xD53D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xD558, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xD559, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xD574, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xD575, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xD590, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xD591, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xD5AC, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xD5AD, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xD5C8, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xD5C9, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xD5E4, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xD5E5, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xD600, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xD601, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xD61C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xD61D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xD638, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xD639, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xD654, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xD655, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xD670, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xD671, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xD68C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xD68D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xD6A8, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xD6A9, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xD6C4, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xD6C5, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xD6E0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xD6E1, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xD6FC, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xD6FD, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xD718, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xD719, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xD734, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xD735, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xD750, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xD751, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xD76C, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xD76D, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xD788, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lv },
+        { 0xD789, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::lvt },
+        { 0xD7A4, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0xD7B0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::v },
+        { 0xD7C7, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0xD7CB, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::t },
+        { 0xD7FC, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0xE000, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0xF900, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
+        { 0xFB00, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0xFB1E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0xFB1F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0xFE00, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0xFE0F, east_asian_width_class_type::ambiguous, emoji_type::emoji, grapheme_break_property_type::extend },
+        { 0xFE10, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
+        { 0xFE1A, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0xFE20, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0xFE30, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
+        { 0xFE53, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0xFE54, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
+        { 0xFE67, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0xFE68, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
+        { 0xFE6C, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0xFEFF, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::control },
+        { 0xFF00, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0xFF01, east_asian_width_class_type::fullwidth, emoji_type::normal, grapheme_break_property_type::other },
+        { 0xFF61, east_asian_width_class_type::halfwidth, emoji_type::normal, grapheme_break_property_type::other },
+        { 0xFF9E, east_asian_width_class_type::halfwidth, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0xFFA0, east_asian_width_class_type::halfwidth, emoji_type::normal, grapheme_break_property_type::other },
+        { 0xFFBF, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0xFFC2, east_asian_width_class_type::halfwidth, emoji_type::normal, grapheme_break_property_type::other },
+        { 0xFFC8, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0xFFCA, east_asian_width_class_type::halfwidth, emoji_type::normal, grapheme_break_property_type::other },
+        { 0xFFD0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0xFFD2, east_asian_width_class_type::halfwidth, emoji_type::normal, grapheme_break_property_type::other },
+        { 0xFFD8, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0xFFDA, east_asian_width_class_type::halfwidth, emoji_type::normal, grapheme_break_property_type::other },
+        { 0xFFDD, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0xFFE0, east_asian_width_class_type::fullwidth, emoji_type::normal, grapheme_break_property_type::other },
+        { 0xFFE7, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0xFFE8, east_asian_width_class_type::halfwidth, emoji_type::normal, grapheme_break_property_type::other },
+        { 0xFFEF, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0xFFF0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::control },
+        { 0xFFFC, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0xFFFD, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0xFFFE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x101FD, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x101FE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x102E0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x102E1, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x10376, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1037B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x10A01, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x10A04, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x10A05, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x10A07, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x10A0C, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x10A10, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x10A38, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x10A3B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x10A3F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x10A40, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x10AE5, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x10AE7, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x10D24, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x10D28, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x10EAB, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x10EAD, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x10F46, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x10F51, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x10F82, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x10F86, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x11000, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x11001, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x11002, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x11003, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x11038, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x11047, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x11070, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x11071, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x11073, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x11075, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1107F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x11082, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x11083, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x110B0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x110B3, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x110B7, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x110B9, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x110BB, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x110BD, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::prepend },
+        { 0x110BE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x110C2, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x110C3, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x110CD, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::prepend },
+        { 0x110CE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x11100, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x11103, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x11127, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1112C, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x1112D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x11135, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x11145, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x11147, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x11173, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x11174, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x11180, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x11182, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x11183, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x111B3, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x111B6, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x111BF, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x111C1, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x111C2, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::prepend },
+        { 0x111C4, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x111C9, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x111CD, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x111CE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x111CF, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x111D0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1122C, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x1122F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x11232, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x11234, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x11235, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x11236, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x11238, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1123E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1123F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x112DF, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x112E0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x112E3, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x112EB, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x11300, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x11302, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x11304, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1133B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1133D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1133E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1133F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x11340, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x11341, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x11345, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x11347, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x11349, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1134B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x1134E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x11357, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x11358, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x11362, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x11364, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x11366, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1136D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x11370, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x11375, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x11435, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x11438, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x11440, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x11442, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x11445, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x11446, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x11447, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1145E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1145F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x114B0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x114B1, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x114B3, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x114B9, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x114BA, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x114BB, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x114BD, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x114BE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x114BF, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x114C1, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x114C2, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x114C4, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x115AF, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x115B0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x115B2, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x115B6, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x115B8, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x115BC, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x115BE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x115BF, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x115C1, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x115DC, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x115DE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x11630, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x11633, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1163B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x1163D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1163E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x1163F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x11641, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x116AB, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x116AC, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x116AD, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x116AE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x116B0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x116B6, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x116B7, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x116B8, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1171D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x11720, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x11722, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x11726, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x11727, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1172C, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1182C, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x1182F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x11838, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x11839, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1183B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x11930, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x11931, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x11936, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x11937, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x11939, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1193B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1193D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x1193E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1193F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::prepend },
+        { 0x11940, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x11941, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::prepend },
+        { 0x11942, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x11943, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x11944, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x119D1, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x119D4, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x119D8, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x119DA, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x119DC, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x119E0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x119E1, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x119E4, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x119E5, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x11A01, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x11A0B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x11A33, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x11A39, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x11A3A, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::prepend },
+        { 0x11A3B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x11A3F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x11A47, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x11A48, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x11A51, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x11A57, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x11A59, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x11A5C, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x11A84, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::prepend },
+        { 0x11A8A, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x11A97, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x11A98, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x11A9A, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x11C2F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x11C30, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x11C37, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x11C38, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x11C3E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x11C3F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x11C40, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x11C92, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x11CA8, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x11CA9, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x11CAA, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x11CB1, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x11CB2, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x11CB4, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x11CB5, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x11CB7, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x11D31, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x11D37, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x11D3A, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x11D3B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x11D3C, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x11D3E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x11D3F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x11D46, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::prepend },
+        { 0x11D47, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x11D48, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x11D8A, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x11D8F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x11D90, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x11D92, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x11D93, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x11D95, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x11D96, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x11D97, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x11D98, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x11EF3, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x11EF5, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x11EF7, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x13430, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::control },
+        { 0x13439, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x16AF0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x16AF5, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x16B30, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x16B37, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x16F4F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x16F50, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x16F51, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x16F88, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x16F8F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x16F93, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x16FE0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x16FE4, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x16FE5, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x16FF0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x16FF2, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x17000, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x187F8, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x18800, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x18CD6, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x18D00, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x18D09, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1AFF0, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1AFF4, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1AFF5, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1AFFC, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1AFFD, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1AFFF, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1B000, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1B123, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1B150, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1B153, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1B164, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1B168, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1B170, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1B2FC, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1BC9D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1BC9F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1BCA0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::control },
+        { 0x1BCA4, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1CF00, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1CF2E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1CF30, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1CF47, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1D165, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1D166, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x1D167, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1D16A, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1D16D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::spacing_mark },
+        { 0x1D16E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1D173, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::control },
+        { 0x1D17B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1D183, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1D185, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1D18C, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1D1AA, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1D1AE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1D242, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1D245, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1DA00, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1DA37, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1DA3B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1DA6D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1DA75, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1DA76, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1DA84, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1DA85, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1DA9B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1DAA0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1DAA1, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1DAB0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1E000, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1E007, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1E008, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1E019, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1E01B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1E022, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1E023, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1E025, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1E026, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1E02B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1E130, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1E137, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1E2AE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1E2AF, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1E2EC, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1E2F0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1E8D0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1E8D7, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1E944, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0x1E94B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F000, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F004, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1F005, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F0CF, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1F0D0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F100, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F10B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F10D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F110, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F12E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F12F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F130, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F16A, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F16C, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F170, east_asian_width_class_type::ambiguous, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1F172, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F17E, east_asian_width_class_type::ambiguous, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1F180, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F18E, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1F18F, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F191, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1F19B, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F1AD, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F1E6, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::regional },
+        { 0x1F200, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F201, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1F203, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F210, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F21A, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1F21B, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F22F, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1F230, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F232, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1F23B, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F23C, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F240, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F249, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F250, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1F252, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F260, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F266, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F300, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1F321, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1F322, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F324, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1F32D, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1F336, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1F337, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1F37D, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1F37E, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1F394, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F396, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1F398, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F399, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1F39C, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F39E, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1F3A0, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1F3CB, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1F3CF, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1F3D4, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1F3E0, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1F3F1, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F3F3, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1F3F4, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1F3F5, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1F3F6, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F3F7, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1F3F8, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1F3FB, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::extend },
+        { 0x1F400, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1F43F, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1F440, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1F441, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1F442, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1F4FD, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1F4FE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F4FF, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1F53E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F546, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F549, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1F54B, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1F54F, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F550, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1F568, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F56F, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1F571, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F573, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1F57A, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1F57B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F587, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1F588, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F58A, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1F58E, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F590, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1F591, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F595, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1F597, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F5A4, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1F5A5, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1F5A6, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F5A8, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1F5A9, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F5B1, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1F5B3, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F5BC, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1F5BD, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F5C2, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1F5C5, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F5D1, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1F5D4, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F5DC, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1F5DF, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F5E1, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1F5E2, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F5E3, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1F5E4, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F5E8, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1F5E9, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F5EF, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1F5F0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F5F3, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1F5F4, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F5FA, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1F5FB, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1F650, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F680, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1F6C6, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F6CB, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1F6CC, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1F6CD, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1F6D0, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1F6D3, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F6D5, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1F6D8, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F6DD, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1F6E0, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1F6E6, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F6E9, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1F6EA, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F6EB, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1F6ED, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F6F0, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1F6F1, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F6F3, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1F6F4, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1F6FD, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F700, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F774, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F780, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F7D5, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F7E0, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1F7EC, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F7F0, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1F7F1, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F800, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F80C, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F810, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F848, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F850, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F85A, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F860, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F888, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F890, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F8AE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F900, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F90C, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1F93B, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F93C, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1F946, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1F947, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1FA00, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1FA70, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1FA75, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1FA78, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1FA7D, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1FA80, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1FA87, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1FA90, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1FAAD, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1FAB0, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1FABB, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1FAC0, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1FAC6, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1FAD0, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1FADA, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1FAE0, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1FAE8, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1FAF0, east_asian_width_class_type::wide, emoji_type::emoji, grapheme_break_property_type::other },
+        { 0x1FAF7, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1FB00, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1FC00, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x1FFFE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x20000, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x2FFFE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x30000, east_asian_width_class_type::wide, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x3FFFE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0xE0000, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::control },
+        { 0xE0020, east_asian_width_class_type::neutral, emoji_type::emoji, grapheme_break_property_type::extend },
+        { 0xE0080, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::control },
+        { 0xE0100, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::extend },
+        { 0xE01F0, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::control },
+        { 0xE1000, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0xF0000, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0xFFFFE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x100000, east_asian_width_class_type::ambiguous, emoji_type::normal, grapheme_break_property_type::other },
+        { 0x10FFFE, east_asian_width_class_type::neutral, emoji_type::normal, grapheme_break_property_type::other },
+    };
+    // clang-format on
+
+
+}
@@ -1,24 +1,24 @@
-/*! \file
-    \brief The usage of character encoding conversion.
-
-    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
-*/
-
-
-#if !defined(USAGETETENGO_TEXT_ENCODING_C_H)
-#define USAGETETENGO_TEXT_ENCODING_C_H
-
-
-#if defined(__cplusplus)
-extern "C" {
-#endif
-
-void usage_tetengo_text_encoding();
-
-
-#if defined(__cplusplus)
-}
-#endif
-
-
-#endif
+/*! \file
+    \brief The usage of character encoding conversion.
+
+    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
+*/
+
+
+#if !defined(USAGETETENGO_TEXT_ENCODING_C_H)
+#define USAGETETENGO_TEXT_ENCODING_C_H
+
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+void usage_tetengo_text_encoding();
+
+
+#if defined(__cplusplus)
+}
+#endif
+
+
+#endif
@@ -1,20 +1,20 @@
-/*! \file
-    \brief The usage of character encoding conversion.
-
-    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
-*/
-
-
-#if !defined(USAGETETENGO_TEXT_ENCODING_CPP_HPP)
-#define USAGETETENGO_TEXT_ENCODING_CPP_HPP
-
-
-namespace usage_tetengo::text
-{
-    void encoding();
-
-
-}
-
-
-#endif
+/*! \file
+    \brief The usage of character encoding conversion.
+
+    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
+*/
+
+
+#if !defined(USAGETETENGO_TEXT_ENCODING_CPP_HPP)
+#define USAGETETENGO_TEXT_ENCODING_CPP_HPP
+
+
+namespace usage_tetengo::text
+{
+    void encoding();
+
+
+}
+
+
+#endif
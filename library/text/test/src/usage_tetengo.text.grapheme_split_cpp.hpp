@@ -1,20 +1,20 @@
-/*! \file
-    \brief The usage of grapheme splitting.
-
-    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
-*/
-
-
-#if !defined(USAGETETENGO_TEXT_GRAPHEMESPLIT_CPP_HPP)
-#define USAGETETENGO_TEXT_GRAPHEMESPLIT_CPP_HPP
-
-
-namespace usage_tetengo::text
-{
-    void grapheme_split();
-
-
-}
-
-
-#endif
+/*! \file
+    \brief The usage of grapheme splitting.
+
+    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
+*/
+
+
+#if !defined(USAGETETENGO_TEXT_GRAPHEMESPLIT_CPP_HPP)
+#define USAGETETENGO_TEXT_GRAPHEMESPLIT_CPP_HPP
+
+
+namespace usage_tetengo::text
+{
+    void grapheme_split();
+
+
+}
+
+
+#endif
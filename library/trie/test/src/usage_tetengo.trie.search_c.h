@@ -1,24 +1,24 @@
-/*! \file
-    \brief The usage of trie search.
-
-    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
-*/
-
-
-#if !defined(USAGETETENGO_TRIE_SEARCH_C_H)
-#define USAGETETENGO_TRIE_SEARCH_C_H
-
-
-#if defined(__cplusplus)
-extern "C" {
-#endif
-
-void usage_tetengo_trie_search();
-
-
-#if defined(__cplusplus)
-}
-#endif
-
-
-#endif
+/*! \file
+    \brief The usage of trie search.
+
+    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
+*/
+
+
+#if !defined(USAGETETENGO_TRIE_SEARCH_C_H)
+#define USAGETETENGO_TRIE_SEARCH_C_H
+
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+void usage_tetengo_trie_search();
+
+
+#if defined(__cplusplus)
+}
+#endif
+
+
+#endif
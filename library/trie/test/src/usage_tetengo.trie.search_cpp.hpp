@@ -1,20 +1,20 @@
-/*! \file
-    \brief The usage of trie search.
-
-    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
-*/
-
-
-#if !defined(USAGETETENGO_TRIE_SEARCH_CPP_HPP)
-#define USAGETETENGO_TRIE_SEARCH_CPP_HPP
-
-
-namespace usage_tetengo::trie
-{
-    void search();
-
-
-}
-
-
-#endif
+/*! \file
+    \brief The usage of trie search.
+
+    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
+*/
+
+
+#if !defined(USAGETETENGO_TRIE_SEARCH_CPP_HPP)
+#define USAGETETENGO_TRIE_SEARCH_CPP_HPP
+
+
+namespace usage_tetengo::trie
+{
+    void search();
+
+
+}
+
+
+#endif
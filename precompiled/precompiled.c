@@ -1,7 +1,7 @@
-/*! \file
-    \brief The precompiled header.
-
-    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
-*/
-
-#include <stddef.h>
+/*! \file
+    \brief The precompiled header.
+
+    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
+*/
+
+#include <stddef.h>
@@ -1,5 +1,5 @@
-/*! \file
-    \brief The precompiled header.
-
-    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
-*/
+/*! \file
+    \brief The precompiled header.
+
+    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
+*/
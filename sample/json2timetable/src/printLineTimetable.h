@@ -1,21 +1,21 @@
-/*! \file
-    \brief A line timetable printing.
-
-    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
-*/
-
-#if !defined(PRINTLINETIMETABLE_H)
-#define PRINTLINETIMETABLE_H
-
-#include "timetable.h"
-
-
-/*!
-    \brief Prints a line timetable.
-
-    \param p_timetable A pointer to a timetable.
-*/
-void print_line_timetable(const timetable_t* p_timetable);
-
-
-#endif
+/*! \file
+    \brief A line timetable printing.
+
+    Copyright (C) 2019-2025 kaoru  https://www.tetengo.org/
+*/
+
+#if !defined(PRINTLINETIMETABLE_H)
+#define PRINTLINETIMETABLE_H
+
+#include "timetable.h"
+
+
+/*!
+    \brief Prints a line timetable.
+
+    \param p_timetable A pointer to a timetable.
+*/
+void print_line_timetable(const timetable_t* p_timetable);
+
+
+#endif